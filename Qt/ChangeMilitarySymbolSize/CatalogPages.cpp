@@ -0,0 +1,142 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QFile>
+#include <QRegularExpression>
+#include <QTextStream>
+
+#include "CatalogPages.h"
+
+namespace {
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+}
+
+CatalogPages CatalogPages::builtIn() {
+    CatalogPages pages;
+
+    pages.append(91, QStringList()
+          << "SUPP-----------" << "SFPP-----------" << "SNPP-----------" << "SHPP-----------"
+          << "SUPPS----------" << "SFPPS----------" << "SNPPS----------" << "SHPPS----------"
+          << "SUPPV----------" << "SFPPV----------" << "SNPPV----------" << "SHPPV----------"
+          << "SUPPT----------" << "SFPPT----------" << "SNPPT----------" << "SHPPT----------"
+          << "SUPPL----------" << "SFPPL----------" << "SNPPL----------" << "SHPPL----------"
+          << "SUAP-----------" << "SFAP-----------" << "SNAP-----------" << "SHAP-----------");
+
+    pages.append(92, QStringList()
+          << "SUAPM----------" << "SFAPM----------" << "SNAPM----------" << "SHAPM----------"
+          << "SUAPMF---------" << "SFAPMF---------" << "SNAPMF---------" << "SHAPMF---------"
+          << "SUAPMFB--------" << "SFAPMFB--------" << "SNAPMFB--------" << "SHAPMFB--------"
+          << "SUAPMFF--------" << "SFAPMFF--------" << "SNAPMFF--------" << "SHAPMFF--------"
+          << "SUAPMFFI-------" << "SFAPMFFI-------" << "SNAPMFFI-------" << "SHAPMFFI-------");
+
+    pages.append(93, QStringList()
+          << "SUAPMFT--------" << "SFAPMFT--------" << "SNAPMFT--------" << "SHAPMFT--------"
+          << "SUAPMFA--------" << "SFAPMFA--------" << "SNAPMFA--------" << "SHAPMFA--------"
+          << "SUAPMFL--------" << "SFAPMFL--------" << "SNAPMFL--------" << "SHAPMFL--------"
+          << "SUAPMFK--------" << "SFAPMFK--------" << "SNAPMFK--------" << "SHAPMFK--------"
+          << "SUAPMFKB-------" << "SFAPMFKB-------" << "SNAPMFKB-------" << "SHAPMFKB-------");
+
+    pages.append(94, QStringList()
+          << "SUAPMFKD-------" << "SFAPMFKD-------" << "SNAPMFKD-------" << "SHAPMFKD-------"
+          << "SUAPMFC--------" << "SFAPMFC--------" << "SNAPMFC--------" << "SHAPMFC--------"
+          << "SUAPMFCL-------" << "SFAPMFCL-------" << "SNAPMFCL-------" << "SHAPMFCL-------"
+          << "SUAPMFCM-------" << "SFAPMFCM-------" << "SNAPMFCM-------" << "SHAPMFCM-------"
+          << "SUAPMFCH-------" << "SFAPMFCH-------" << "SNAPMFCH-------" << "SHAPMFCH-------");
+
+    pages.append(95, QStringList()
+          << "SUAPMFJ--------" << "SFAPMFJ--------" << "SNAPMFJ--------" << "SHAPMFJ--------"
+          << "SUAPMFO--------" << "SFAPMFO--------" << "SNAPMFO--------" << "SHAPMFO--------"
+          << "SUAPMFR--------" << "SFAPMFR--------" << "SNAPMFR--------" << "SHAPMFR--------"
+          << "SUAPMFRW-------" << "SFAPMFRW-------" << "SNAPMFRW-------" << "SHAPMFRW-------"
+          << "SUAPMFRZ-------" << "SFAPMFRZ-------" << "SNAPMFRZ-------" << "SHAPMFRZ-------");
+
+    pages.append(96, QStringList()
+          << "SUAPMFRX-------" << "SFAPMFRX-------" << "SNAPMFRX-------" << "SHAPMFRX-------"
+          << "SUAPMFP--------" << "SFAPMFP--------" << "SNAPMFP--------" << "SHAPMFP--------"
+          << "SUAPMFPN-------" << "SFAPMFPN-------" << "SNAPMFPN-------" << "SHAPMFPN-------"
+          << "SUAPMFPM-------" << "SFAPMFPM-------" << "SNAPMFPM-------" << "SHAPMFPM-------"
+          << "SUAPMFU--------" << "SFAPMFU--------" << "SNAPMFU--------" << "SHAPMFU--------");
+
+    return pages;
+}
+
+bool CatalogPages::load(const QString& path, QString* errorMessage /* = nullptr */) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return fail(errorMessage, file.errorString());
+
+    static const QRegularExpression separators("[\\s,]+");
+
+    QVector<Page> pages;
+    QTextStream stream(&file);
+    int lineNumber = 0;
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        lineNumber++;
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        if (line.startsWith(QStringLiteral("page "), Qt::CaseInsensitive)) {
+            bool ok = false;
+            Page page;
+            page.number = line.mid(5).trimmed().toInt(&ok);
+            if (!ok)
+                return fail(errorMessage, QString("Invalid page number at %1:%2").arg(path).arg(lineNumber));
+
+            pages.append(page);
+            continue;
+        }
+
+        if (pages.isEmpty()) {
+            Page page;
+            page.number = 1;
+            pages.append(page);
+        }
+
+        pages.last().codes += line.split(separators, QString::SkipEmptyParts);
+    }
+
+    m_pages = pages;
+    return true;
+}
+
+void CatalogPages::append(int number, const QStringList& codes) {
+    Page page;
+    page.number = number;
+    page.codes = codes;
+    m_pages.append(page);
+}
+
+int CatalogPages::count() const {
+    return m_pages.size();
+}
+
+bool CatalogPages::isEmpty() const {
+    return m_pages.isEmpty();
+}
+
+const CatalogPages::Page& CatalogPages::at(int index) const {
+    return m_pages.at(index);
+}
+
+int CatalogPages::indexOf(int number) const {
+    for (int i = 0; i < m_pages.size(); i++) {
+        if (m_pages.at(i).number == number)
+            return i;
+    }
+
+    return -1;
+}
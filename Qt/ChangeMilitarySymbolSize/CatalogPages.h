@@ -0,0 +1,52 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef CATALOGPAGES_H
+#define CATALOGPAGES_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// The catalog as numbered pages of codes, browsed one page at a time.
+//
+// A catalog file has one or more codes per line, separated by spaces or
+// commas. A "page <number>" line starts a page, codes before the first
+// one are on page 1. Empty lines and lines starting with # are skipped.
+class CatalogPages
+{
+public:
+    struct Page {
+        int number = 0;
+        QStringList codes;
+    };
+
+    // Pages 91 to 96 of the air symbols
+    static CatalogPages builtIn();
+
+    // Replaces the pages with those of a catalog file
+    bool load(const QString& path, QString* errorMessage = nullptr);
+
+    void append(int number, const QStringList& codes);
+
+    int count() const;
+    bool isEmpty() const;
+    const Page& at(int index) const;
+
+    // -1 if there is no page with that number
+    int indexOf(int number) const;
+
+private:
+    QVector<Page> m_pages;
+};
+
+#endif // CATALOGPAGES_H
@@ -23,27 +23,66 @@
 #include "FeatureCollectionTable.h"
 #include "FeatureCollectionLayer.h"
 #include "FeatureCollection.h"
+#include "FeatureLayer.h"
 
 #include "Point.h"
+#include "Viewpoint.h"
 #include "GeometryEngine.h"
 #include "SpatialReference.h"
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <QDir>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QMouseEvent>
+#include <QSaveFile>
+#include <QTimer>
 
+#include "AllocationProfiler.h"
+#include "ColumnarFile.h"
+#include "InteractionReplay.h"
+#include "RendererComparison.h"
+#include "SymbolEngine.h"
 #include "ChangeMilitarySymbolSize.h"
 
 using namespace Esri::ArcGISRuntime;
 
+namespace {
+    // Snapshot flags
+    const quint32 SnapshotAutoSize = 0x1;
+
+    // Quiet time after the last change of the catalog file before it is
+    // reloaded
+    const int CatalogSettleMs = 100;
+}
+
 ChangeMilitarySymbolSize::ChangeMilitarySymbolSize(QQuickItem* parent /* = nullptr */):
-    QQuickItem(parent)
+    QQuickItem(parent),
+    m_telemetry(new RenderTelemetry(this)),
+    m_pipeline(new LoadPipeline(this))
 {
+    connect(this, &QQuickItem::windowChanged, m_telemetry, &RenderTelemetry::setWindow);
+
+    m_telemetry->setCounterSource([this]() {
+        TelemetryCounters counters;
+        if (m_dTable && m_uTable)
+            counters.featureCount = static_cast<int>(m_dTable->numberOfFeatures() + m_uTable->numberOfFeatures());
+        if (m_uRend)
+            counters.uniqueValueCount = m_uRend->uniqueValues()->size();
+        counters.symbolCacheHits = m_symbolCache.hits();
+        counters.pendingIngest = m_pendingIngest;
+        return counters;
+    });
 }
 
 ChangeMilitarySymbolSize::~ChangeMilitarySymbolSize()
 {
+    // Stop the page preparation before the symbol cache it reads goes away
+    m_pipeline->cancel();
 }
 
 void ChangeMilitarySymbolSize::componentComplete()
@@ -72,214 +111,946 @@ void ChangeMilitarySymbolSize::componentComplete()
     const QString stylePath = QDir::currentPath() + QStringLiteral("/styles/mil2525c_b2.stylx");
     qDebug() << "Style Path: " << stylePath;
 
+    m_stylePath = stylePath;
+
+    QString sharedError;
+    if (m_sharedSymbols.attach(stylePath, &sharedError))
+        m_symbolCache.setShared(&m_sharedSymbols);
+    else
+        qWarning() << "Shared symbol cache unavailable:" << sharedError;
+
     DictionarySymbolStyle* style = new DictionarySymbolStyle(QString("mil2525c_b2"), stylePath, this);
 
     m_dRend = new DictionaryRenderer(style, this);
     m_uRend = new UniqueValueRenderer(this);
     m_uRend->setFieldNames(QStringList() << FieldName);
 
-    // Create the fields for the Feature Collection table
-    QList<Field> fields;
-    fields.push_back(Field::createText(FieldName, FieldName, 15));
-
-    // Create the Feature Collection Tables
-    //m_dTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference::wgs84(), this);
-    //m_uTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference::wgs84(), this);
-    m_dTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference::webMercator(), this);
-    m_uTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference::webMercator(), this);
+    // Create the Feature Collection Tables, in Web Mercator
+    m_dTable = PageSymbolEngine::createTable(FieldName, this);
+    m_uTable = PageSymbolEngine::createTable(FieldName, this);
 
     // Assign the renderers to the tables
     m_dTable->setRenderer(m_dRend);
     m_uTable->setRenderer(m_uRend);
 
-    // Create a feature collection and the tables
-    m_uCollection = new FeatureCollection(this);
-    m_uCollection->tables()->append(m_dTable);
+    // Track the features still being added to the tables
+    connect(m_dTable, &FeatureTable::addFeatureCompleted, this, [this](QUuid, bool) {
+        m_pendingIngest--;
+    });
+    connect(m_uTable, &FeatureTable::addFeatureCompleted, this, [this](QUuid, bool) {
+        m_pendingIngest--;
+    });
+
+    // Add a feature collection for each renderer to the map, with its table
+    m_layers = PageSymbolEngine::createLayers(m_map, this);
+    PageSymbolEngine::addTables(m_layers, m_dTable, m_uTable);
+
+    // Resolve clicks and hovers from the local index instead of identifying
+    connect(m_mapView, &MapQuickView::mouseClicked, this, [this](QMouseEvent& mouseEvent) {
+        SymbolHitTester::Hit hit = hitTest(mouseEvent);
+        selectFeature(hit.feature);
+        emit symbolSelected(hit.sidc);
+    });
 
-    m_dCollection = new FeatureCollection(this);
-    m_dCollection->tables()->append(m_uTable);
+    // Only a change of band touches the renderer while zooming
+    connect(m_mapView, &MapQuickView::mapScaleChanged, this, &ChangeMilitarySymbolSize::updateSizeBand);
 
-    // Add the collections to the map
-    m_dLayer = new FeatureCollectionLayer(m_dCollection, this);
-    m_uLayer = new FeatureCollectionLayer(m_uCollection, this);
-    m_map->operationalLayers()->append(m_dLayer);
-    m_map->operationalLayers()->append(m_uLayer);
+    connect(m_mapView, &MapQuickView::mouseMoved, this, [this](QMouseEvent& mouseEvent) {
+        SymbolHitTester::Hit hit = hitTest(mouseEvent);
+        if (hit.sidc != m_hoveredSidc) {
+            m_hoveredSidc = hit.sidc;
+            emit symbolHovered(m_hoveredSidc);
+        }
+    });
 
     connect(style, &DictionarySymbolStyle::doneLoading, this, [this](Error error){
        if (!error.isEmpty())
            return;
 
-        createFeatures();
+        loadCatalog();
+        if (!restoreSnapshot())
+            showPage(0);
+        m_featuresCreated = true;
+        updateSizeBand();
+
+        if (!m_comparisonReport.isEmpty())
+            runComparison(m_comparisonReport);
+
+        if (m_replayPending) {
+            m_replayPending = false;
+            m_replay->start(m_replayBaseline, m_replayReport);
+        }
     });
 
     style->load();
 }
 
-void ChangeMilitarySymbolSize::createFeatures() {
+void ChangeMilitarySymbolSize::loadCatalog() {
+    static const int CatalogStage = AllocationProfiler::stage("catalog");
+    AllocationScope allocationScope(CatalogStage);
 
-    QStringList codes;
-    int count;
-    int quotient;
+    m_catalog = CatalogPages::builtIn();
 
+    if (!m_catalogPath.isEmpty()) {
+        CatalogPages catalog;
+        QString error;
+        if (catalog.load(m_catalogPath, &error) && !catalog.isEmpty())
+            m_catalog = catalog;
+        else
+            qDebug() << "Catalog not loaded, showing the built-in pages: " << error;
 
-    // Page 91
-    qDebug() << "Page 91";
-    codes << "SUPP-----------" << "SFPP-----------" << "SNPP-----------" << "SHPP-----------"
-          << "SUPPS----------" << "SFPPS----------" << "SNPPS----------" << "SHPPS----------"
-          << "SUPPV----------" << "SFPPV----------" << "SNPPV----------" << "SHPPV----------"
-          << "SUPPT----------" << "SFPPT----------" << "SNPPT----------" << "SHPPT----------"
-          << "SUPPL----------" << "SFPPL----------" << "SNPPL----------" << "SHPPL----------"
-          << "SUAP-----------" << "SFAP-----------" << "SNAP-----------" << "SHAP-----------";
+        watchCatalog();
+    }
+}
 
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
-        }
+void ChangeMilitarySymbolSize::setCatalogPath(const QString& path) {
+    m_catalogPath = path;
+}
+
+void ChangeMilitarySymbolSize::watchCatalog() {
+    if (!m_catalogWatcher) {
+        m_catalogWatcher = new QFileSystemWatcher(this);
+
+        // Editors save in several writes, reload once they are done
+        m_catalogTimer = new QTimer(this);
+        m_catalogTimer->setSingleShot(true);
+        m_catalogTimer->setInterval(CatalogSettleMs);
+
+        connect(m_catalogWatcher, &QFileSystemWatcher::fileChanged, m_catalogTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
+        connect(m_catalogTimer, &QTimer::timeout, this, &ChangeMilitarySymbolSize::reloadCatalog);
+    }
+
+    // A save that replaces the file drops it from the watcher
+    if (!m_catalogWatcher->files().contains(m_catalogPath))
+        m_catalogWatcher->addPath(m_catalogPath);
+}
+
+void ChangeMilitarySymbolSize::reloadCatalog() {
+    watchCatalog();
+
+    const QString path = m_catalogPath;
+    m_pipeline->run<CatalogPages>("catalog", [path]() {
+        CatalogPages catalog;
+        QString error;
+        if (!catalog.load(path, &error))
+            qDebug() << "Catalog not reloaded: " << error;
+        return catalog;
+    }, [this](const CatalogPages& catalog) {
+        // Most likely caught halfway through a save, the next change
+        // reloads it
+        if (!catalog.isEmpty())
+            applyCatalog(catalog);
+    });
+}
+
+void ChangeMilitarySymbolSize::applyCatalog(const CatalogPages& catalog) {
+    // No page is shown before the style is loaded
+    if (m_page < 0)
+        return;
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    // Stay on the page with the same number, or as close as the new
+    // catalog goes
+    int index = catalog.indexOf(pageNumber());
+    if (index < 0)
+        index = qMin(m_page, catalog.count() - 1);
+
+    m_catalog = catalog;
+
+    // The neighbours are prepared again from the new catalog, the current
+    // page is changed in place
+    BuiltPage current = m_builtPages.take(m_page);
+    m_page = index;
+    m_builtPages.insert(m_page, current);
+    releasePages(true);
+
+    int added = 0;
+    int removed = 0;
+    applyPageDelta(m_catalog.at(m_page).codes, &added, &removed);
+
+    prefetchPages();
+    emit pageChanged();
+
+    qDebug() << "Catalog reloaded in" << elapsed.elapsed() << "ms," << added << "added," << removed << "removed";
+}
+
+int ChangeMilitarySymbolSize::pageIndex() const {
+    return m_page;
+}
+
+int ChangeMilitarySymbolSize::pageNumber() const {
+    return m_page >= 0 ? m_catalog.at(m_page).number : 0;
+}
+
+int ChangeMilitarySymbolSize::pageCount() const {
+    return m_catalog.count();
+}
+
+void ChangeMilitarySymbolSize::nextPage() {
+    // No page is shown before the style is loaded
+    if (m_page >= 0)
+        showPage(m_page + 1);
+}
+
+void ChangeMilitarySymbolSize::previousPage() {
+    if (m_page >= 0)
+        showPage(m_page - 1);
+}
+
+void ChangeMilitarySymbolSize::showPage(int index) {
+    if (index < 0 || index >= m_catalog.count() || index == m_page)
+        return;
+
+    static const int PageStage = AllocationProfiler::stage("page");
+    AllocationScope allocationScope(PageStage);
+
+    // Built here only on the first page, a restored page or a jump past
+    // the neighbours
+    if (!m_builtPages.contains(index))
+        m_builtPages.insert(index, buildPage(planPage(index, m_catalog.at(index).codes, QPointF(m_startX, m_startY), &m_symbolCache)));
+
+    hidePage();
+    exposePage(index);
+    m_page = index;
+
+    releasePages(false);
+    prefetchPages();
+
+    emit pageChanged();
+}
+
+ChangeMilitarySymbolSize::PagePlan ChangeMilitarySymbolSize::planPage(int index, const QStringList& codes, const QPointF& origin, SymbolCache* cache) {
+    PagePlan plan;
+    plan.index = index;
+
+    // Four to a row, 100 meters apart, every page in the same place
+    const PageLayout page(origin, codes.size());
+    plan.positions = PageSymbolEngine::layout(page, codes.size());
+    plan.codes = codes.mid(0, plan.positions.size());
+
+    for (const QString& code : plan.codes)
+        plan.json.append(cache->find(code));
+
+    return plan;
+}
+
+ChangeMilitarySymbolSize::BuiltPage ChangeMilitarySymbolSize::buildPage(const PagePlan& plan) {
+    BuiltPage built;
+    built.codes = plan.codes;
+    built.positions = plan.positions;
+
+    Feature* scratch = nullptr;
+    for (int i = 0; i < plan.codes.size(); i++)
+        built.values.append(createValue(plan.codes.at(i), plan.json.at(i), &scratch, &built.dictionarySize));
+
+    if (scratch)
+        scratch->deleteLater();
+
+    return built;
+}
+
+UniqueValue* ChangeMilitarySymbolSize::createValue(const QString& sidc, QString json, Feature** scratch, double* dictionarySize) {
+    static const int SymbolizeStage = AllocationProfiler::stage("symbolize");
+    AllocationScope symbolizeScope(SymbolizeStage);
+
+    // The dictionary only resolves the codes no instance has cached, from
+    // a feature that is never added
+    if (json.isNull()) {
+        if (!*scratch)
+            *scratch = m_dTable->createFeature(this);
+        (*scratch)->attributes()->replaceAttribute(FieldName, sidc);
+
+        Feature* feature = *scratch;
+        json = m_symbolCache.resolve(sidc, [this, feature]() {
+            return m_dRend->symbol(feature)->toJson();
+        });
     }
-    updateStartLocation();
-
-    /*
-    // Page 92
-    qDebug() << "Page 92";
-    codes << "SUAPM----------" << "SFAPM----------" << "SNAPM----------" << "SHAPM----------"
-          << "SUAPMF---------" << "SFAPMF---------" << "SNAPMF---------" << "SHAPMF---------"
-          << "SUAPMFB--------" << "SFAPMFB--------" << "SNAPMFB--------" << "SHAPMFB--------"
-          << "SUAPMFF--------" << "SFAPMFF--------" << "SNAPMFF--------" << "SHAPMFF--------"
-          << "SUAPMFFI-------" << "SFAPMFFI-------" << "SNAPMFFI-------" << "SHAPMFFI-------";
-
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
+
+    MultilayerPointSymbol* symbol = PageSymbolEngine::uniqueValueSymbol(json, this);
+    *dictionarySize = symbol->size();
+    symbol->setSize(m_symbolSize);
+
+    return new UniqueValue(sidc, sidc, QVariantList() << sidc, symbol, this);
+}
+
+ChangeMilitarySymbolSize::ShownFeature ChangeMilitarySymbolSize::showFeature(const QString& sidc, const QPointF& position) {
+    // The unique value feature 50 meters east
+    m_pendingIngest += 2;
+    const PageSymbolEngine::Features features = PageSymbolEngine::addFeatures(m_dTable, m_uTable, FieldName, sidc, position, QPointF(position.x() + 50, position.y()), this);
+
+    ShownFeature shown;
+    shown.dFeature = features.dFeature;
+    shown.uFeature = features.uFeature;
+    shown.symbol = m_filter.addSymbol(sidc, QList<Feature*>() << shown.dFeature << shown.uFeature);
+    m_hitTester.addFeature(shown.dFeature, sidc, position.x(), position.y(), DictionaryGroup, shown.symbol);
+    m_hitTester.addFeature(shown.uFeature, sidc, position.x() + 50, position.y(), UniqueValueGroup, shown.symbol);
+
+    return shown;
+}
+
+void ChangeMilitarySymbolSize::hideFeature(const ShownFeature& shown, const QPointF& position, QList<Feature*>* dFeatures, QList<Feature*>* uFeatures) {
+    m_hitTester.removeFeature(shown.dFeature, position.x(), position.y());
+    m_hitTester.removeFeature(shown.uFeature, position.x() + 50, position.y());
+    m_filter.removeSymbol(shown.symbol);
+
+    dFeatures->append(shown.dFeature);
+    uFeatures->append(shown.uFeature);
+}
+
+void ChangeMilitarySymbolSize::deleteFeatures(const QList<Feature*>& dFeatures, const QList<Feature*>& uFeatures, const QSet<UniqueValue*>& values) {
+    // One delete per table
+    if (!dFeatures.isEmpty()) {
+        m_dTable->deleteFeatures(dFeatures);
+        m_uTable->deleteFeatures(uFeatures);
+    }
+    for (Feature* feature : dFeatures + uFeatures)
+        feature->deleteLater();
+
+    // Imported unique values stay in the renderer
+    if (!values.isEmpty()) {
+        for (int i = m_uRend->uniqueValues()->size() - 1; i >= 0; i--) {
+            if (values.contains(m_uRend->uniqueValues()->at(i)))
+                m_uRend->uniqueValues()->removeAt(i);
         }
     }
-    updateStartLocation();
-
-    // Page 93
-    qDebug() << "Page 93";
-    codes << "SUAPMFT--------" << "SFAPMFT--------" << "SNAPMFT--------" << "SHAPMFT--------"
-          << "SUAPMFA--------" << "SFAPMFA--------" << "SNAPMFA--------" << "SHAPMFA--------"
-          << "SUAPMFL--------" << "SFAPMFL--------" << "SNAPMFL--------" << "SHAPMFL--------"
-          << "SUAPMFK--------" << "SFAPMFK--------" << "SNAPMFK--------" << "SHAPMFK--------"
-          << "SUAPMFKB-------" << "SFAPMFKB-------" << "SNAPMFKB-------" << "SHAPMFKB-------";
-
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
+}
+
+void ChangeMilitarySymbolSize::hidePage() {
+    if (m_page < 0)
+        return;
+
+    const BuiltPage& page = m_builtPages[m_page];
+
+    QList<Feature*> dFeatures;
+    QList<Feature*> uFeatures;
+    QSet<UniqueValue*> values;
+    for (int i = 0; i < m_shownFeatures.size(); i++) {
+        if (!page.values.at(i))
+            continue;
+
+        hideFeature(m_shownFeatures.at(i), page.positions.at(i), &dFeatures, &uFeatures);
+        values.insert(page.values.at(i));
+    }
+    m_shownFeatures.clear();
+
+    // The unique values stay with the page
+    deleteFeatures(dFeatures, uFeatures, values);
+
+    m_codes.clear();
+    m_positions.clear();
+}
+
+void ChangeMilitarySymbolSize::exposePage(int index) {
+    static const int IngestStage = AllocationProfiler::stage("ingest");
+    AllocationScope ingestScope(IngestStage);
+
+    const BuiltPage& page = m_builtPages[index];
+
+    for (int i = 0; i < page.codes.size(); i++) {
+        if (!page.values.at(i)) {
+            m_shownFeatures.append(ShownFeature());
+            continue;
         }
+
+        m_shownFeatures.append(showFeature(page.codes.at(i), page.positions.at(i)));
+        m_uRend->uniqueValues()->append(page.values.at(i));
     }
-    updateStartLocation();
-
-    // Page 94
-    qDebug() << "Page 94";
-    codes << "SUAPMFKD-------" << "SFAPMFKD-------" << "SNAPMFKD-------" << "SHAPMFKD-------"
-          << "SUAPMFC--------" << "SFAPMFC--------" << "SNAPMFC--------" << "SHAPMFC--------"
-          << "SUAPMFCL-------" << "SFAPMFCL-------" << "SNAPMFCL-------" << "SHAPMFCL-------"
-          << "SUAPMFCM-------" << "SFAPMFCM-------" << "SNAPMFCM-------" << "SHAPMFCM-------"
-          << "SUAPMFCH-------" << "SFAPMFCH-------" << "SNAPMFCH-------" << "SHAPMFCH-------";
-
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
+
+    refreshPage(page);
+}
+
+void ChangeMilitarySymbolSize::applyPageDelta(const QStringList& codes, int* added, int* removed) {
+    static const int IngestStage = AllocationProfiler::stage("ingest");
+    AllocationScope ingestScope(IngestStage);
+
+    BuiltPage& page = m_builtPages[m_page];
+
+    // Every shown code still wanted keeps its feature and unique value
+    QHash<QString, int> wanted;
+    for (const QString& code : codes)
+        wanted[code]++;
+
+    QList<Feature*> dFeatures;
+    QList<Feature*> uFeatures;
+    QSet<UniqueValue*> values;
+    QVector<int> freeSlots;
+    for (int i = 0; i < page.codes.size(); i++) {
+        if (!page.values.at(i)) {
+            freeSlots.append(i);
+            continue;
+        }
+
+        auto it = wanted.find(page.codes.at(i));
+        if (it != wanted.end() && it.value() > 0) {
+            it.value()--;
+            continue;
         }
+
+        hideFeature(m_shownFeatures.at(i), page.positions.at(i), &dFeatures, &uFeatures);
+        values.insert(page.values.at(i));
+
+        page.values[i]->symbol()->setParent(page.values[i]);
+        page.values[i]->deleteLater();
+        page.values[i] = nullptr;
+        page.codes[i] = QString();
+        m_shownFeatures[i] = ShownFeature();
+        freeSlots.append(i);
     }
-    updateStartLocation();
-
-    // Page 95
-    qDebug() << "Page 95";
-    codes << "SUAPMFJ--------" << "SFAPMFJ--------" << "SNAPMFJ--------" << "SHAPMFJ--------"
-          << "SUAPMFO--------" << "SFAPMFO--------" << "SNAPMFO--------" << "SHAPMFO--------"
-          << "SUAPMFR--------" << "SFAPMFR--------" << "SNAPMFR--------" << "SHAPMFR--------"
-          << "SUAPMFRW-------" << "SFAPMFRW-------" << "SNAPMFRW-------" << "SHAPMFRW-------"
-          << "SUAPMFRZ-------" << "SFAPMFRZ-------" << "SNAPMFRZ-------" << "SHAPMFRZ-------";
-
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
+
+    deleteFeatures(dFeatures, uFeatures, values);
+    *removed = values.size();
+
+    // The added codes fill the freed slots first, then extend the page
+    const PageLayout layout(QPointF(m_startX, m_startY), qMax(1, codes.size()));
+    Feature* scratch = nullptr;
+    *added = 0;
+
+    for (const QString& code : codes) {
+        auto it = wanted.find(code);
+        if (it.value() == 0)
+            continue;
+        it.value()--;
+
+        int slot = page.codes.size();
+        if (!freeSlots.isEmpty()) {
+            slot = freeSlots.takeFirst();
+        } else {
+            page.codes.append(QString());
+            page.positions.append(layout.position(slot));
+            page.values.append(nullptr);
+            m_shownFeatures.append(ShownFeature());
         }
+
+        UniqueValue* value = createValue(code, m_symbolCache.find(code), &scratch, &page.dictionarySize);
+        page.codes[slot] = code;
+        page.values[slot] = value;
+        m_shownFeatures[slot] = showFeature(code, page.positions.at(slot));
+        m_uRend->uniqueValues()->append(value);
+        (*added)++;
+    }
+
+    if (scratch)
+        scratch->deleteLater();
+
+    refreshPage(page);
+}
+
+void ChangeMilitarySymbolSize::refreshPage(const BuiltPage& page) {
+    // The features of the export, without the empty slots
+    m_codes.clear();
+    m_positions.clear();
+    for (int i = 0; i < page.codes.size(); i++) {
+        if (!page.values.at(i))
+            continue;
+        m_codes.append(page.codes.at(i));
+        m_positions.append(page.positions.at(i));
     }
-    updateStartLocation();
-
-    // Page 96
-    qDebug() << "Page 96";
-    codes << "SUAPMFRX-------" << "SFAPMFRX-------" << "SNAPMFRX-------" << "SHAPMFRX-------"
-          << "SUAPMFP--------" << "SFAPMFP--------" << "SNAPMFP--------" << "SHAPMFP--------"
-          << "SUAPMFPN-------" << "SFAPMFPN-------" << "SNAPMFPN-------" << "SHAPMFPN-------"
-          << "SUAPMFPM-------" << "SFAPMFPM-------" << "SNAPMFPM-------" << "SHAPMFPM-------"
-          << "SUAPMFU--------" << "SFAPMFU--------" << "SNAPMFU--------" << "SHAPMFU--------";
-
-    count = 0;
-    while(!codes.isEmpty()) {
-        for (int n = 0; n < 4; n++) {
-            quotient = count / 4;
-            createFeature(codes.takeFirst(), m_startX + (n * 100), m_startY - (quotient * 100));
-            count++;
+
+    // A page prepared before the last resize still has the old size
+    PageSymbolEngine::resize(m_uRend, m_symbolSize);
+    m_hitTester.setGroupSymbolSize(DictionaryGroup, page.dictionarySize);
+
+    if (!m_filter.expression().isEmpty())
+        m_filter.apply(m_filter.expression(), QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer);
+
+    // Only the band shown is rebuilt with the unique values of the page,
+    // the others when they are next shown
+    clearBandRenderers();
+    updateSizeBand();
+}
+
+void ChangeMilitarySymbolSize::releasePages(bool keepCurrentOnly) {
+    for (auto it = m_builtPages.begin(); it != m_builtPages.end();) {
+        const int distance = qAbs(it.key() - m_page);
+        if (distance == 0 || (!keepCurrentOnly && distance == 1)) {
+            ++it;
+            continue;
         }
+
+        // Not in the renderer, the symbols are children of the values
+        for (UniqueValue* value : it->values) {
+            if (!value)
+                continue;
+            value->symbol()->setParent(value);
+            value->deleteLater();
+        }
+        it = m_builtPages.erase(it);
     }
-    updateStartLocation();
-    */
 }
 
-void ChangeMilitarySymbolSize::createFeature(QString sidc, double x, double y) {
-    Feature* dFeature = m_dTable->createFeature(this);
-    Feature* uFeature = m_uTable->createFeature(this);
+void ChangeMilitarySymbolSize::prefetchPages() {
+    const QPointF origin(m_startX, m_startY);
+    SymbolCache* cache = &m_symbolCache;
 
-    //Point dPoint = Point(x, y, SpatialReference::wgs84());
-    //Point uPoint = Point(x + 0.5, y, SpatialReference::wgs84());
-    Point dPoint = Point(x, y, SpatialReference::webMercator());
-    Point uPoint = Point(x + 50, y, SpatialReference::webMercator());
+    for (int index : { m_page + 1, m_page - 1 }) {
+        if (index < 0 || index >= m_catalog.count() || m_builtPages.contains(index) || m_pendingPages.contains(index))
+            continue;
 
-    dFeature->setGeometry(dPoint);
-    uFeature->setGeometry(uPoint);
+        m_pendingPages.insert(index);
 
-    dFeature->attributes()->replaceAttribute(FieldName, sidc);
-    uFeature->attributes()->replaceAttribute(FieldName, sidc);
+        const QStringList codes = m_catalog.at(index).codes;
+        m_pipeline->run<PagePlan>("page", [index, codes, origin, cache]() {
+            return planPage(index, codes, origin, cache);
+        }, [this, index](const PagePlan& plan) {
+            m_pendingPages.remove(index);
 
-    m_dTable->addFeature(dFeature);
-    m_uTable->addFeature(uFeature);
+            // Paged past it, shown before it was ready, or planned from a
+            // catalog that has since been reloaded
+            if (qAbs(index - m_page) > 1 || m_builtPages.contains(index) ||
+                index >= m_catalog.count() || plan.codes != m_catalog.at(index).codes) {
+                prefetchPages();
+                return;
+            }
+
+            m_builtPages.insert(index, buildPage(plan));
+        });
+    }
+}
 
-    MultilayerPointSymbol* symbol = (MultilayerPointSymbol*) MultilayerPointSymbol::fromJson(m_dRend->symbol(dFeature)->toJson());
-    symbol->setSize(44);
+void ChangeMilitarySymbolSize::importFeature(const QString& sidc, const QPointF& position, Feature** scratch) {
+    // Not part of any page, so never hidden
+    double dictionarySize = 0.0;
+    m_uRend->uniqueValues()->append(createValue(sidc, m_symbolCache.find(sidc), scratch, &dictionarySize));
+    showFeature(sidc, position);
 
-    UniqueValue* uval = new UniqueValue(sidc, sidc, QVariantList() << sidc, symbol, this);
-    m_uRend->uniqueValues()->append(uval);
+    m_importedCodes.append(sidc);
+    m_importedPositions.append(position);
 }
 
-void ChangeMilitarySymbolSize::updateStartLocation() {
-    //m_startX += 5;
-    m_startX += 500;
+bool ChangeMilitarySymbolSize::restoreSnapshot() {
+    if (m_snapshotPath.isEmpty())
+        return false;
+
+    SnapshotReader reader;
+    QString error;
+    if (!reader.open(m_snapshotPath, SnapshotReader::fingerprint(m_stylePath), &error)) {
+        qDebug() << "Rebuilding, snapshot not used: " << error;
+        return false;
+    }
+
+    // Symbols come from the snapshot instead of the dictionary
+    for (int i = 0; i < reader.codeCount(); i++) {
+        const QString json = reader.symbolJsonAt(i);
+        if (!json.isEmpty())
+            m_symbolCache.insert(reader.codeAt(i), json);
+    }
+
+    const SnapshotState state = reader.state();
+    if (state.symbolSize > 0)
+        m_symbolSize = state.symbolSize;
+
+    // The page comes back from the catalog, the rows are the imported
+    // features
+    showPage(qBound(0, state.page, m_catalog.count() - 1));
+
+    Feature* scratch = nullptr;
+    for (int row = 0; row < reader.featureCount(); row++)
+        importFeature(reader.code(row), reader.dPoint(row), &scratch);
+
+    if (scratch)
+        scratch->deleteLater();
+
+    m_hitTester.setGroupSymbolSize(UniqueValueGroup, m_symbolSize);
+
+    if (state.viewScale > 0.0)
+        m_mapView->setViewpoint(Viewpoint(Point(state.viewX, state.viewY, SpatialReference(state.viewWkid)), state.viewScale));
+
+    setAutoSize(state.flags & SnapshotAutoSize);
+
+    return true;
+}
+
+bool ChangeMilitarySymbolSize::saveSnapshot(const QString& path) {
+    SnapshotWriter writer;
+
+    SnapshotState state;
+    const Viewpoint viewpoint = m_mapView->currentViewpoint(ViewpointType::CenterAndScale);
+    const Point center(viewpoint.targetGeometry());
+    state.viewX = center.x();
+    state.viewY = center.y();
+    state.viewWkid = center.spatialReference().wkid();
+    state.viewScale = viewpoint.targetScale();
+    state.symbolSize = m_symbolSize;
+    state.flags = m_autoSize ? SnapshotAutoSize : 0;
+    state.page = qMax(0, m_page);
+    writer.setState(state);
+
+    // The pages are in the catalog, only the imported features are stored
+    for (int i = 0; i < m_importedCodes.size(); i++) {
+        const QPointF dPoint = m_importedPositions.at(i);
+        writer.addFeature(m_importedCodes.at(i), dPoint, QPointF(dPoint.x() + 50, dPoint.y()));
+    }
+
+    const QHash<QString, QString> symbols = m_symbolCache.symbols();
+    for (auto it = symbols.constBegin(); it != symbols.constEnd(); ++it)
+        writer.setSymbolJson(it.key(), it.value());
+
+    QString error;
+    if (!writer.write(path, SnapshotReader::fingerprint(m_stylePath), &error)) {
+        qDebug() << "Snapshot not saved: " << error;
+        return false;
+    }
+
+    return true;
+}
+
+bool ChangeMilitarySymbolSize::exportColumns(const QString& path) {
+    // The page shown and the imported features
+    const QStringList codes = m_codes + m_importedCodes;
+    const QVector<QPointF> positions = m_positions + m_importedPositions;
+
+    QVector<double> x(positions.size());
+    QVector<double> y(positions.size());
+    QVector<double> ux(positions.size());
+    for (int i = 0; i < positions.size(); i++) {
+        x[i] = positions.at(i).x();
+        y[i] = positions.at(i).y();
+        ux[i] = x.at(i) + 50;
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "Columns not exported: " << file.errorString();
+        return false;
+    }
+
+    ColumnarWriter writer(&file);
+    const bool written = writer.begin()
+        && writer.writeTable(ColumnBatch::DictionaryTable, x, y, codes)
+        && writer.writeTable(ColumnBatch::UniqueValueTable, ux, y, codes)
+        && writer.finish();
+
+    if (!written || !file.commit()) {
+        qDebug() << "Columns not exported: " << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+bool ChangeMilitarySymbolSize::importColumns(const QString& path) {
+    if (!m_featuresCreated)
+        return false;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "Columns not imported: " << file.errorString();
+        return false;
+    }
+
+    ColumnarReader reader(&file);
+    QString error;
+    if (!reader.open(&error)) {
+        qDebug() << "Columns not imported: " << error;
+        return false;
+    }
+
+    // The unique value table sits next to the dictionary table, only the
+    // dictionary table rows are needed
+    static const int IngestStage = AllocationProfiler::stage("ingest");
+    AllocationScope ingestScope(IngestStage);
+
+    ColumnBatch batch;
+    Feature* scratch = nullptr;
+    while (reader.next(&batch, &error)) {
+        if (batch.table != ColumnBatch::DictionaryTable)
+            continue;
+
+        for (int row = 0; row < batch.rowCount(); row++)
+            importFeature(reader.dictionary().at(batch.codes.at(row)), QPointF(batch.x.at(row), batch.y.at(row)), &scratch);
+    }
+
+    if (scratch)
+        scratch->deleteLater();
+
+    if (!error.isEmpty()) {
+        qDebug() << "Columns not imported: " << error;
+        return false;
+    }
+
+    if (!m_filter.expression().isEmpty())
+        m_filter.apply(m_filter.expression(), QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer);
+
+    // Rebuilt with the new unique values on the next band switch
+    clearBandRenderers();
+    updateSizeBand();
+
+    return true;
+}
+
+void ChangeMilitarySymbolSize::setSnapshotPath(const QString& path) {
+    m_snapshotPath = path;
 }
 
 void ChangeMilitarySymbolSize::btnUPressed() {
-    m_uLayer->setVisible(!m_uLayer->isVisible());
+    m_layers.uLayer->setVisible(!m_layers.uLayer->isVisible());
+
+    if (m_replay) {
+        InteractionReplay::Action action;
+        action.type = InteractionReplay::ToggleUniqueValue;
+        m_replay->record(action);
+    }
 }
 
 void ChangeMilitarySymbolSize::btnDPressed() {
-    m_dLayer->setVisible(!m_dLayer->isVisible());
+    m_layers.dLayer->setVisible(!m_layers.dLayer->isVisible());
+
+    if (m_replay) {
+        InteractionReplay::Action action;
+        action.type = InteractionReplay::ToggleDictionary;
+        m_replay->record(action);
+    }
 }
 
 void ChangeMilitarySymbolSize::btnSPressed(int position) {
-    for(int i = 0; i < m_uRend->uniqueValues()->size(); i++) {
+    static const int ResizeStage = AllocationProfiler::stage("resize");
+    AllocationScope allocationScope(ResizeStage);
+
+    // Change the symbol sizes where they are
+    PageSymbolEngine::resize(m_uRend, position);
+
+    m_symbolSize = position;
+    if (!m_autoSize)
+        m_hitTester.setGroupSymbolSize(UniqueValueGroup, position);
+
+    if (m_replay) {
+        InteractionReplay::Action action;
+        action.type = InteractionReplay::Resize;
+        action.size = position;
+        m_replay->record(action);
+    }
+}
+
+bool ChangeMilitarySymbolSize::autoSize() const {
+    return m_autoSize;
+}
+
+void ChangeMilitarySymbolSize::setAutoSize(bool autoSize) {
+    if (m_autoSize == autoSize)
+        return;
+
+    m_autoSize = autoSize;
+    m_sizeBand = -1;
+
+    if (m_autoSize) {
+        updateSizeBand();
+    } else {
+        // Back to the renderer sized by the slider
+        if (m_uTable && m_uRend)
+            m_uTable->setRenderer(m_uRend);
+        m_hitTester.setGroupSymbolSize(UniqueValueGroup, m_symbolSize);
+    }
+
+    emit autoSizeChanged();
+}
+
+bool ChangeMilitarySymbolSize::setSizeCurve(const QString& spec) {
+    QString error;
+    if (!m_sizeCurve.parse(spec, &error)) {
+        qDebug() << error;
+        return false;
+    }
+
+    // Rebuilt on the next band switch
+    clearBandRenderers();
+    updateSizeBand();
+
+    return true;
+}
+
+UniqueValueRenderer* ChangeMilitarySymbolSize::bandRenderer(int band) {
+    if (m_bandRenderers.isEmpty()) {
+        m_bandSizes = m_sizeCurve.sizes(m_scaleBands);
+        m_bandRenderers.fill(nullptr, m_scaleBands.count());
+    }
+
+    if (m_bandRenderers.at(band))
+        return m_bandRenderers.at(band);
+
+    static const int ResizeStage = AllocationProfiler::stage("resize");
+    AllocationScope allocationScope(ResizeStage);
+
+    // A band gets a copy of the unique values sized for its scales the
+    // first time it is shown, so later zoom steps into it only swap the
+    // renderer of the table
+    UniqueValueRenderer* renderer = new UniqueValueRenderer(this);
+    renderer->setFieldNames(m_uRend->fieldNames());
+
+    for (int i = 0; i < m_uRend->uniqueValues()->size(); i++) {
         UniqueValue* uval = m_uRend->uniqueValues()->at(i);
 
-        // Change the symbol size
-        MultilayerPointSymbol* symbol = (MultilayerPointSymbol*) uval->symbol();
-        symbol->setSize(position);
+        MultilayerPointSymbol* symbol = (MultilayerPointSymbol*) MultilayerPointSymbol::fromJson(uval->symbol()->toJson(), renderer);
+        symbol->setSize(m_bandSizes.at(band));
+
+        renderer->uniqueValues()->append(new UniqueValue(uval->label(), uval->description(), uval->values(), symbol, renderer));
+    }
+
+    m_bandRenderers[band] = renderer;
+    return renderer;
+}
+
+void ChangeMilitarySymbolSize::clearBandRenderers() {
+    if (m_uTable && m_autoSize)
+        m_uTable->setRenderer(m_uRend);
+
+    // Only the bands already shown were built
+    qDeleteAll(m_bandRenderers);
+    m_bandRenderers.clear();
+    m_sizeBand = -1;
+}
+
+void ChangeMilitarySymbolSize::updateSizeBand() {
+    if (!m_autoSize || !m_featuresCreated)
+        return;
+
+    const int band = m_scaleBands.bandForScale(m_mapView->mapScale());
+    if (band == m_sizeBand)
+        return;
+
+    UniqueValueRenderer* renderer = bandRenderer(band);
+
+    m_sizeBand = band;
+    m_uTable->setRenderer(renderer);
+    m_hitTester.setGroupSymbolSize(UniqueValueGroup, m_bandSizes.at(band));
+}
+
+SymbolHitTester::Hit ChangeMilitarySymbolSize::hitTest(const QMouseEvent& mouseEvent) {
+    // The dictionary table is shown by uLayer, the unique value table by dLayer
+    m_hitTester.setGroupVisible(DictionaryGroup, m_layers.uLayer->isVisible());
+    m_hitTester.setGroupVisible(UniqueValueGroup, m_layers.dLayer->isVisible());
+
+    // Hit test in the spatial reference of the tables, measuring one pixel
+    // to convert the symbol sizes
+    const Point location = GeometryEngine::project(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y()), SpatialReference::webMercator());
+    const Point next = GeometryEngine::project(m_mapView->screenToLocation(mouseEvent.x() + 1, mouseEvent.y()), SpatialReference::webMercator());
+
+    return m_hitTester.hitTest(location.x(), location.y(), std::abs(next.x() - location.x()), [this](int symbol) {
+        return m_filter.isVisible(symbol);
+    });
+}
+
+void ChangeMilitarySymbolSize::selectFeature(Feature* feature) {
+    QList<FeatureCollectionLayer*> layers;
+    layers << m_layers.dLayer << m_layers.uLayer;
+
+    for (FeatureCollectionLayer* collectionLayer : layers) {
+        for (FeatureLayer* layer : collectionLayer->layers()) {
+            layer->clearSelection();
+            if (feature && layer->featureTable() == feature->featureTable())
+                layer->selectFeature(feature);
+        }
+    }
+}
+
+bool ChangeMilitarySymbolSize::applyFilter(const QString& expression) {
+    QString error;
+    if (!m_filter.apply(expression, QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer, &error)) {
+        qDebug() << "Invalid filter: " << error;
+        return false;
+    }
+
+    return true;
+}
+
+QString ChangeMilitarySymbolSize::allocationReport() const {
+    return AllocationProfiler::report();
+}
+
+RenderTelemetry* ChangeMilitarySymbolSize::telemetry() const {
+    return m_telemetry;
+}
+
+void ChangeMilitarySymbolSize::runComparison(const QString& reportPath) {
+    // The comparison sizes the symbols itself
+    setAutoSize(false);
+
+    m_comparisonReport = reportPath;
+
+    // Wait for the catalog, componentComplete will start the comparison
+    if (!m_featuresCreated)
+        return;
+
+    if (!m_comparison) {
+        // uLayer shows the dictionary table and dLayer the unique value table
+        m_comparison = new RendererComparison(m_mapView, m_layers.uLayer, m_layers.dLayer, this);
+        m_comparison->setResizeFunction([this](int size) {
+            btnSPressed(size);
+        });
+
+        connect(m_comparison, &RendererComparison::finished, this, [this](const QString& path) {
+            // Restore the default unique value symbol size
+            btnSPressed(44);
+            m_comparisonReport.clear();
+            emit comparisonFinished(path);
+        });
+    }
+
+    m_comparison->start(reportPath);
+}
+
+InteractionReplay* ChangeMilitarySymbolSize::replay() {
+    if (!m_replay) {
+        m_replay = new InteractionReplay(m_mapView, this);
 
-        uval->setSymbol(symbol);
+        // The buttons and slider of the QML, without recording them again
+        m_replay->setActionFunction([this](const InteractionReplay::Action& action) {
+            switch (action.type) {
+            case InteractionReplay::ToggleUniqueValue:
+                btnUPressed();
+                break;
+            case InteractionReplay::ToggleDictionary:
+                btnDPressed();
+                break;
+            case InteractionReplay::Resize:
+                btnSPressed(action.size);
+                break;
+            default:
+                break;
+            }
+        });
+
+        connect(m_replay, &InteractionReplay::finished, this, &ChangeMilitarySymbolSize::replayFinished);
+    }
+
+    return m_replay;
+}
+
+void ChangeMilitarySymbolSize::startRecording() {
+    replay()->startRecording();
+}
+
+bool ChangeMilitarySymbolSize::saveRecording(const QString& path) {
+    if (!m_replay || !m_replay->isRecording())
+        return false;
+
+    QString error;
+    if (!m_replay->saveScript(path, &error)) {
+        qDebug() << "Interactions not saved: " << error;
+        return false;
     }
+
+    return true;
+}
+
+bool ChangeMilitarySymbolSize::runReplay(const QString& scriptPath, const QString& baselinePath, const QString& reportPath, int repetitions, QString* errorMessage /* = nullptr */) {
+    if (!replay()->loadScript(scriptPath, errorMessage))
+        return false;
+
+    // Sizes come from the script, not the map scale
+    setAutoSize(false);
+
+    m_replay->setRepetitions(repetitions);
+    m_replayBaseline = baselinePath;
+    m_replayReport = reportPath;
+
+    // Wait for the catalog, componentComplete will start the replay
+    if (!m_featuresCreated) {
+        m_replayPending = true;
+        return true;
+    }
+
+    m_replay->start(baselinePath, reportPath);
+    return true;
 }
@@ -26,15 +26,43 @@ namespace Esri {
         class FeatureCollection;
 
         class UniqueValueRenderer;
+        class UniqueValue;
+        class MultilayerPointSymbol;
+        class Feature;
     }
 }
 
+#include <QHash>
 #include <QQuickItem>
+#include <QSet>
+
+#include "CatalogPages.h"
+#include "LoadPipeline.h"
+#include "RenderTelemetry.h"
+#include "ScaleBands.h"
+#include "SessionSnapshot.h"
+#include "SharedSymbolCache.h"
+#include "SymbolCache.h"
+#include "SymbolEngine.h"
+#include "SymbolFilter.h"
+#include "SymbolHitTester.h"
+
+class InteractionReplay;
+class QFileSystemWatcher;
+class QMouseEvent;
+class QTimer;
+class RendererComparison;
 
 class ChangeMilitarySymbolSize : public QQuickItem
 {
     Q_OBJECT
 
+    Q_PROPERTY(RenderTelemetry* telemetry READ telemetry CONSTANT)
+    Q_PROPERTY(bool autoSize READ autoSize WRITE setAutoSize NOTIFY autoSizeChanged)
+    Q_PROPERTY(int pageIndex READ pageIndex NOTIFY pageChanged)
+    Q_PROPERTY(int pageNumber READ pageNumber NOTIFY pageChanged)
+    Q_PROPERTY(int pageCount READ pageCount NOTIFY pageChanged)
+
 public:
     ChangeMilitarySymbolSize(QQuickItem* parent = nullptr);
     ~ChangeMilitarySymbolSize();
@@ -44,6 +72,57 @@ public:
     Q_INVOKABLE void btnUPressed();
     Q_INVOKABLE void btnDPressed();
     Q_INVOKABLE void btnSPressed(int position);
+    Q_INVOKABLE void runComparison(const QString& reportPath);
+
+    // Record the toggles, resizes and navigation of the session to a script
+    void startRecording();
+    Q_INVOKABLE bool saveRecording(const QString& path);
+
+    // Replay a script once the catalog is loaded, repetitions times, and
+    // compare the latency of every action with a baseline
+    bool runReplay(const QString& scriptPath, const QString& baselinePath, const QString& reportPath, int repetitions, QString* errorMessage = nullptr);
+
+    // Pages from a catalog file instead of the built-in ones, reloaded
+    // whenever the file changes
+    void setCatalogPath(const QString& path);
+
+    // Browse the catalog a page at a time, the pages next to the current
+    // one are prepared in the background
+    int pageIndex() const;
+    int pageNumber() const;
+    int pageCount() const;
+    Q_INVOKABLE void showPage(int index);
+    Q_INVOKABLE void nextPage();
+    Q_INVOKABLE void previousPage();
+
+    // Show only the symbols matching a filter such as "hostile & ground"
+    Q_INVOKABLE bool applyFilter(const QString& expression);
+
+    // Allocations per stage, while profiling with --profile-allocations
+    Q_INVOKABLE QString allocationReport() const;
+
+    // Size the unique value symbols from the map scale instead of the slider
+    bool autoSize() const;
+    void setAutoSize(bool autoSize);
+    Q_INVOKABLE bool setSizeCurve(const QString& spec);
+
+    // Restore from this snapshot if it matches, instead of rebuilding
+    void setSnapshotPath(const QString& path);
+    Q_INVOKABLE bool saveSnapshot(const QString& path);
+
+    // Both tables to, or more features from, a columnar feature file
+    Q_INVOKABLE bool exportColumns(const QString& path);
+    Q_INVOKABLE bool importColumns(const QString& path);
+
+    RenderTelemetry* telemetry() const;
+
+signals:
+    void autoSizeChanged();
+    void pageChanged();
+    void comparisonFinished(const QString& reportPath);
+    void replayFinished(int regressions);
+    void symbolHovered(const QString& sidc);
+    void symbolSelected(const QString& sidc);
 
 private:
     Esri::ArcGISRuntime::Map*             m_map = nullptr;
@@ -52,24 +131,127 @@ private:
     Esri::ArcGISRuntime::FeatureCollectionTable* m_dTable = nullptr;
     Esri::ArcGISRuntime::FeatureCollectionTable* m_uTable = nullptr;
 
-    Esri::ArcGISRuntime::FeatureCollection* m_dCollection = nullptr;
-    Esri::ArcGISRuntime::FeatureCollection* m_uCollection = nullptr;
-
-    Esri::ArcGISRuntime::FeatureCollectionLayer* m_dLayer = nullptr;
-    Esri::ArcGISRuntime::FeatureCollectionLayer* m_uLayer = nullptr;
+    PageSymbolEngine::Layers m_layers;
 
     Esri::ArcGISRuntime::DictionaryRenderer* m_dRend = nullptr;
     Esri::ArcGISRuntime::UniqueValueRenderer* m_uRend = nullptr;
 
     const QString FieldName = "sidc";
 
-    void createFeature(QString sidc, double x, double y);
-    void createFeatures();
-    void updateStartLocation();
+    void loadCatalog();
+    void importFeature(const QString& sidc, const QPointF& position, Esri::ArcGISRuntime::Feature** scratch);
+
+    // Laid out with the cached symbols of its codes on the pool, a null
+    // JSON string where a code still has to be resolved
+    struct PagePlan {
+        int index = -1;
+        QStringList codes;
+        QVector<QPointF> positions;
+        QStringList json;
+    };
+
+    // The symbols and unique values of a page, its features are only
+    // created while it is shown. A code removed by a reload leaves an
+    // empty slot, with no unique value, for the next added code.
+    struct BuiltPage {
+        QStringList codes;
+        QVector<QPointF> positions;
+        QList<Esri::ArcGISRuntime::UniqueValue*> values;
+        double dictionarySize = 0.0;
+    };
+
+    struct ShownFeature {
+        Esri::ArcGISRuntime::Feature* dFeature = nullptr;
+        Esri::ArcGISRuntime::Feature* uFeature = nullptr;
+        int symbol = -1;
+    };
+
+    static PagePlan planPage(int index, const QStringList& codes, const QPointF& origin, SymbolCache* cache);
+    BuiltPage buildPage(const PagePlan& plan);
+    Esri::ArcGISRuntime::UniqueValue* createValue(const QString& sidc, QString json, Esri::ArcGISRuntime::Feature** scratch, double* dictionarySize);
+    ShownFeature showFeature(const QString& sidc, const QPointF& position);
+    void hideFeature(const ShownFeature& shown, const QPointF& position, QList<Esri::ArcGISRuntime::Feature*>* dFeatures, QList<Esri::ArcGISRuntime::Feature*>* uFeatures);
+    void deleteFeatures(const QList<Esri::ArcGISRuntime::Feature*>& dFeatures, const QList<Esri::ArcGISRuntime::Feature*>& uFeatures, const QSet<Esri::ArcGISRuntime::UniqueValue*>& values);
+    void hidePage();
+    void exposePage(int index);
+    void refreshPage(const BuiltPage& page);
+    void releasePages(bool keepCurrentOnly);
+    void prefetchPages();
+
+    // Only what changed on the current page is applied, the neighbours are
+    // prepared again
+    void watchCatalog();
+    void reloadCatalog();
+    void applyCatalog(const CatalogPages& catalog);
+    void applyPageDelta(const QStringList& codes, int* added, int* removed);
+
+    SymbolHitTester::Hit hitTest(const QMouseEvent& mouseEvent);
+    void selectFeature(Esri::ArcGISRuntime::Feature* feature);
+
+    Esri::ArcGISRuntime::UniqueValueRenderer* bandRenderer(int band);
+    void clearBandRenderers();
+    void updateSizeBand();
+
+    bool restoreSnapshot();
 
     double m_startX;
     double m_startY;
 
+    RendererComparison* m_comparison = nullptr;
+    QString m_comparisonReport;
+
+    InteractionReplay* m_replay = nullptr;
+    QString m_replayBaseline;
+    QString m_replayReport;
+    bool m_replayPending = false;
+    InteractionReplay* replay();
+    bool m_featuresCreated = false;
+
+    RenderTelemetry* m_telemetry = nullptr;
+    LoadPipeline* m_pipeline = nullptr;
+
+    // The current page and its neighbours at most
+    CatalogPages m_catalog;
+    int m_page = -1;
+    QHash<int, BuiltPage> m_builtPages;
+    QSet<int> m_pendingPages;
+    QVector<ShownFeature> m_shownFeatures;
+
+    QString m_catalogPath;
+    QFileSystemWatcher* m_catalogWatcher = nullptr;
+    QTimer* m_catalogTimer = nullptr;
+
+    // Symbols resolved by any local instance with the same style
+    SharedSymbolCache m_sharedSymbols;
+    SymbolCache m_symbolCache;
+    int m_pendingIngest = 0;
+
+    // Hit testing groups, one per table
+    enum HitGroup { DictionaryGroup = 0, UniqueValueGroup = 1 };
+    SymbolHitTester m_hitTester;
+    SymbolFilter m_filter;
+    QString m_hoveredSidc;
+
+    // Automatic sizing, one renderer per scale band built when first shown
+    bool m_autoSize = false;
+    int m_symbolSize = 44;
+    int m_sizeBand = -1;
+    ScaleBands m_scaleBands;
+    SizeCurve m_sizeCurve;
+    QVector<int> m_bandSizes;
+    QVector<Esri::ArcGISRuntime::UniqueValueRenderer*> m_bandRenderers;
+
+    // Features of the page shown, for the export
+    QStringList m_codes;
+    QVector<QPointF> m_positions;
+
+    // Features imported from columnar files, shown over every page and
+    // kept in the snapshot and the export
+    QStringList m_importedCodes;
+    QVector<QPointF> m_importedPositions;
+    QString m_stylePath;
+    QString m_snapshotPath;
+
 };
 
 #endif // CHANGEMILITARYSYMBOLSIZE_H
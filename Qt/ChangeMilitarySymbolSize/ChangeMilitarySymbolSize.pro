@@ -29,14 +29,21 @@ equals(QT_MAJOR_VERSION, 5) {
 
 ARCGIS_RUNTIME_VERSION = 100.2.1
 include($$PWD/arcgisruntime.pri)
+include($$PWD/../Common/Common.pri)
 
 HEADERS += \
     AppInfo.h \
-    ChangeMilitarySymbolSize.h
+    CatalogPages.h \
+    ChangeMilitarySymbolSize.h \
+    InteractionReplay.h \
+    RendererComparison.h
 
 SOURCES += \
     main.cpp \
-    ChangeMilitarySymbolSize.cpp
+    CatalogPages.cpp \
+    ChangeMilitarySymbolSize.cpp \
+    InteractionReplay.cpp \
+    RendererComparison.cpp
 
 RESOURCES += \
     qml/qml.qrc \
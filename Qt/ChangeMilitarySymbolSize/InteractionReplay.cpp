@@ -0,0 +1,396 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "MapQuickView.h"
+#include "Point.h"
+#include "SpatialReference.h"
+#include "Viewpoint.h"
+
+#include <QQuickWindow>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QFile>
+#include <QHash>
+#include <QDebug>
+
+#include "FrameTimer.h"
+#include "InteractionReplay.h"
+
+using namespace Esri::ArcGISRuntime;
+
+namespace {
+    const int ScriptVersion = 1;
+
+    // Give up waiting for a draw to complete after this long
+    const int SettleTimeout = 5000;
+
+    // An action that has not started a draw this long after its first
+    // frame did not need one
+    const int DrawGrace = 100;
+
+    // Differences below this are noise whatever the tolerance
+    const double MinRegressionMs = 2.0;
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+}
+
+InteractionReplay::InteractionReplay(MapQuickView* mapView, QObject* parent /* = nullptr */):
+    QObject(parent),
+    m_mapView(mapView),
+    m_armed(0),
+    m_frameNs(-1)
+{
+    m_settleTimer.setSingleShot(true);
+    connect(&m_settleTimer, &QTimer::timeout, this, &InteractionReplay::finishAction);
+
+    connect(m_mapView, &MapQuickView::drawStatusChanged, this, [this](DrawStatus status) {
+        if (m_current < 0)
+            return;
+
+        if (status == DrawStatus::InProgress) {
+            m_drawing = true;
+            m_settleTimer.start(SettleTimeout);
+            return;
+        }
+
+        if (!m_drawing)
+            return;
+
+        m_drawing = false;
+        m_drawn = true;
+        m_drawMs = m_timer.nsecsElapsed() / 1.0e6;
+        if (m_frameMs >= 0.0)
+            finishAction();
+    });
+
+    // The viewpoint once a pan or zoom has ended
+    connect(m_mapView, &MapQuickView::navigatingChanged, this, [this]() {
+        if (!m_recording || m_mapView->isNavigating())
+            return;
+
+        const Viewpoint viewpoint = m_mapView->currentViewpoint(ViewpointType::CenterAndScale);
+        const Point center(viewpoint.targetGeometry());
+
+        Action action;
+        action.type = Navigate;
+        action.x = center.x();
+        action.y = center.y();
+        action.scale = viewpoint.targetScale();
+        action.wkid = center.spatialReference().wkid();
+        record(action);
+    });
+}
+
+InteractionReplay::~InteractionReplay()
+{
+    disconnect(m_swapped);
+}
+
+void InteractionReplay::setActionFunction(std::function<void(const Action&)> apply) {
+    m_apply = apply;
+}
+
+void InteractionReplay::startRecording() {
+    m_script.clear();
+    m_recording = true;
+}
+
+bool InteractionReplay::isRecording() const {
+    return m_recording;
+}
+
+void InteractionReplay::record(const Action& action) {
+    if (m_recording)
+        m_script.append(action);
+}
+
+bool InteractionReplay::saveScript(const QString& path, QString* errorMessage /* = nullptr */) const {
+    QJsonArray actions;
+    for (const Action& action : m_script) {
+        QJsonObject entry;
+        entry["type"] = typeName(action.type);
+        if (action.type == Resize)
+            entry["size"] = action.size;
+
+        if (action.type == Navigate) {
+            entry["x"] = action.x;
+            entry["y"] = action.y;
+            entry["scale"] = action.scale;
+            entry["wkid"] = action.wkid;
+        }
+
+        actions.append(entry);
+    }
+
+    QJsonObject script;
+    script["version"] = ScriptVersion;
+    script["actions"] = actions;
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(QJsonDocument(script).toJson()) < 0)
+        return fail(errorMessage, file.errorString());
+
+    return true;
+}
+
+bool InteractionReplay::loadScript(const QString& path, QString* errorMessage /* = nullptr */) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, file.errorString());
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (document.isNull())
+        return fail(errorMessage, parseError.errorString());
+
+    if (document.object().value("version").toInt() != ScriptVersion)
+        return fail(errorMessage, QString("Unsupported interaction script version in %1").arg(path));
+
+    QList<Action> script;
+    for (const QJsonValue& value : document.object().value("actions").toArray()) {
+        const QJsonObject entry = value.toObject();
+
+        Action action;
+        if (!typeFromName(entry.value("type").toString(), &action.type))
+            return fail(errorMessage, QString("Unknown interaction: %1").arg(entry.value("type").toString()));
+
+        action.size = entry.value("size").toInt();
+        action.x = entry.value("x").toDouble();
+        action.y = entry.value("y").toDouble();
+        action.scale = entry.value("scale").toDouble();
+        action.wkid = entry.value("wkid").toInt();
+        script.append(action);
+    }
+
+    if (script.isEmpty())
+        return fail(errorMessage, QString("No interactions in %1").arg(path));
+
+    m_script = script;
+    return true;
+}
+
+void InteractionReplay::setRepetitions(int repetitions) {
+    m_repetitions = qMax(1, repetitions);
+}
+
+void InteractionReplay::setTolerance(double tolerance) {
+    m_tolerance = qMax(0.0, tolerance);
+}
+
+void InteractionReplay::start(const QString& baselinePath, const QString& reportPath) {
+    if (!m_pending.isEmpty() || m_current >= 0 || !m_mapView->window())
+        return;
+
+    m_recording = false;
+    m_baselinePath = baselinePath;
+    m_reportPath = reportPath;
+    m_samples.clear();
+
+    // The whole script once per repetition, so every action starts from
+    // the state the previous one left
+    for (int repetition = 0; repetition < m_repetitions; repetition++) {
+        for (int index = 0; index < m_script.size(); index++)
+            m_pending.append(index);
+    }
+
+    if (!m_swapped)
+        m_swapped = connect(m_mapView->window(), &QQuickWindow::frameSwapped, this, &InteractionReplay::onFrameSwapped, Qt::DirectConnection);
+
+    qDebug() << "Interaction replay: " << m_script.size() << " actions, " << m_repetitions << " times";
+    nextAction();
+}
+
+void InteractionReplay::nextAction() {
+    if (m_pending.isEmpty()) {
+        emit finished(writeReport());
+        return;
+    }
+
+    m_current = m_pending.takeFirst();
+    const Action& action = m_script.at(m_current);
+
+    m_frameMs = -1.0;
+    m_drawMs = -1.0;
+    m_drawing = false;
+    m_drawn = false;
+    m_frameNs.store(-1);
+
+    m_timer.start();
+    m_armed.store(1);
+
+    if (action.type == Navigate)
+        m_mapView->setViewpoint(Viewpoint(Point(action.x, action.y, SpatialReference(action.wkid)), action.scale));
+    else if (m_apply)
+        m_apply(action);
+
+    m_mapView->window()->update();
+    m_settleTimer.start(SettleTimeout);
+}
+
+void InteractionReplay::onFrameSwapped() {
+    // Render thread
+    if (!m_armed.testAndSetOrdered(1, 0))
+        return;
+
+    m_frameNs.store(m_timer.nsecsElapsed());
+    QMetaObject::invokeMethod(this, "onFrame", Qt::QueuedConnection);
+}
+
+void InteractionReplay::onFrame() {
+    if (m_current < 0)
+        return;
+
+    m_frameMs = m_frameNs.load() / 1.0e6;
+
+    if (m_drawn)
+        finishAction();
+    else if (!m_drawing)
+        m_settleTimer.start(DrawGrace);
+}
+
+void InteractionReplay::finishAction() {
+    if (m_current < 0)
+        return;
+
+    m_settleTimer.stop();
+    m_armed.store(0);
+
+    // A timed out action counts as taking the whole timeout
+    const double elapsedMs = m_timer.nsecsElapsed() / 1.0e6;
+
+    Sample sample;
+    sample.index = m_current;
+    sample.frameMs = m_frameMs >= 0.0 ? m_frameMs : elapsedMs;
+    sample.drawMs = m_drawn ? m_drawMs : (m_drawing ? elapsedMs : sample.frameMs);
+    m_samples.append(sample);
+
+    m_current = -1;
+
+    // Let the current frame finish before the next action
+    QTimer::singleShot(0, this, &InteractionReplay::nextAction);
+}
+
+int InteractionReplay::writeReport() {
+    QHash<int, QVector<double>> frameTimes;
+    QHash<int, QVector<double>> drawTimes;
+    for (const Sample& sample : m_samples) {
+        frameTimes[sample.index].append(sample.frameMs);
+        drawTimes[sample.index].append(sample.drawMs);
+    }
+
+    // Medians of the baseline by action, if there is one
+    QHash<int, QJsonObject> baseline;
+    QFile baselineFile(m_baselinePath);
+    const bool compare = !m_baselinePath.isEmpty() && baselineFile.exists();
+    if (compare && baselineFile.open(QIODevice::ReadOnly)) {
+        const QJsonArray actions = QJsonDocument::fromJson(baselineFile.readAll()).object().value("actions").toArray();
+        for (const QJsonValue& value : actions)
+            baseline.insert(value.toObject().value("index").toInt(), value.toObject());
+    }
+
+    int regressions = 0;
+    QJsonArray actions;
+    for (int index = 0; index < m_script.size(); index++) {
+        const QString type = typeName(m_script.at(index).type);
+        const double frameMs = FrameTimer::percentile(frameTimes.value(index), 50);
+        const double drawMs = FrameTimer::percentile(drawTimes.value(index), 50);
+
+        QJsonObject result;
+        result["index"] = index;
+        result["type"] = type;
+        result["frameMedianMs"] = frameMs;
+        result["frameP95Ms"] = FrameTimer::percentile(frameTimes.value(index), 95);
+        result["drawMedianMs"] = drawMs;
+        result["drawP95Ms"] = FrameTimer::percentile(drawTimes.value(index), 95);
+
+        // Only the same action at the same place in the script compares
+        const QJsonObject base = baseline.value(index);
+        if (compare && base.value("type").toString() == type) {
+            const double baseFrameMs = base.value("frameMedianMs").toDouble();
+            const double baseDrawMs = base.value("drawMedianMs").toDouble();
+
+            const bool frameRegressed = frameMs > baseFrameMs * (1.0 + m_tolerance) && frameMs - baseFrameMs > MinRegressionMs;
+            const bool drawRegressed = drawMs > baseDrawMs * (1.0 + m_tolerance) && drawMs - baseDrawMs > MinRegressionMs;
+
+            result["baselineFrameMs"] = baseFrameMs;
+            result["baselineDrawMs"] = baseDrawMs;
+            result["regression"] = frameRegressed || drawRegressed;
+
+            if (frameRegressed || drawRegressed) {
+                regressions++;
+                qDebug() << "Regression: " << index << " " << type << " frame " << frameMs << " ms (baseline " << baseFrameMs
+                         << "), draw " << drawMs << " ms (baseline " << baseDrawMs << ")";
+            }
+        }
+
+        actions.append(result);
+    }
+
+    QJsonObject report;
+    report["created"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report["repetitions"] = m_repetitions;
+    report["tolerance"] = m_tolerance;
+    report["regressions"] = regressions;
+    report["actions"] = actions;
+
+    const QByteArray json = QJsonDocument(report).toJson();
+
+    // The first run becomes the baseline
+    QStringList paths;
+    paths << m_reportPath;
+    if (!compare && !m_baselinePath.isEmpty())
+        paths << m_baselinePath;
+
+    for (const QString& path : paths) {
+        if (path.isEmpty())
+            continue;
+
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qWarning() << "Unable to write interaction report: " << path;
+            continue;
+        }
+
+        file.write(json);
+        qDebug() << "Interaction report: " << path;
+    }
+
+    return regressions;
+}
+
+QString InteractionReplay::typeName(ActionType type) {
+    switch (type) {
+    case ToggleUniqueValue: return QStringLiteral("toggleUniqueValue");
+    case ToggleDictionary: return QStringLiteral("toggleDictionary");
+    case Resize: return QStringLiteral("resize");
+    case Navigate: return QStringLiteral("navigate");
+    }
+
+    return QString();
+}
+
+bool InteractionReplay::typeFromName(const QString& name, ActionType* type) {
+    for (ActionType candidate : { ToggleUniqueValue, ToggleDictionary, Resize, Navigate }) {
+        if (typeName(candidate) == name) {
+            *type = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
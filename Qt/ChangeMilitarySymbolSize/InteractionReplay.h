@@ -0,0 +1,122 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef INTERACTIONREPLAY_H
+#define INTERACTIONREPLAY_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class MapQuickView;
+    }
+}
+
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+#include <functional>
+
+// Records the interactions of the app (renderer toggles, resizes and the
+// viewpoint after each pan or zoom) to a JSON script, and replays a script
+// measuring the latency from each action to the next frame and to the
+// completed draw. The medians of each action are compared with a baseline
+// report, slower actions are flagged as regressions.
+class InteractionReplay : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum ActionType { ToggleUniqueValue, ToggleDictionary, Resize, Navigate };
+
+    struct Action {
+        ActionType type = Navigate;
+        int size = 0;
+        double x = 0.0;
+        double y = 0.0;
+        double scale = 0.0;
+        int wkid = 0;
+    };
+
+    explicit InteractionReplay(Esri::ArcGISRuntime::MapQuickView* mapView, QObject* parent = nullptr);
+    ~InteractionReplay();
+
+    // Applies the toggles and resizes, the viewpoints are set here
+    void setActionFunction(std::function<void(const Action&)> apply);
+
+    // Records every action and the viewpoint after each navigation
+    void startRecording();
+    bool isRecording() const;
+    void record(const Action& action);
+    bool saveScript(const QString& path, QString* errorMessage = nullptr) const;
+
+    bool loadScript(const QString& path, QString* errorMessage = nullptr);
+    void setRepetitions(int repetitions);
+
+    // Slower by more than this fraction of the baseline is a regression
+    void setTolerance(double tolerance);
+
+    // Records the baseline if it does not exist yet, otherwise compares
+    // against it; the report is written either way
+    void start(const QString& baselinePath, const QString& reportPath);
+
+    static QString typeName(ActionType type);
+    static bool typeFromName(const QString& name, ActionType* type);
+
+signals:
+    void finished(int regressions);
+
+private slots:
+    void onFrame();
+
+private:
+    struct Sample {
+        int index = 0;
+        double frameMs = 0.0;
+        double drawMs = 0.0;
+    };
+
+    void nextAction();
+    void onFrameSwapped();
+    void finishAction();
+    int writeReport();
+
+    Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
+    std::function<void(const Action&)> m_apply;
+
+    bool m_recording = false;
+    QList<Action> m_script;
+    int m_repetitions = 5;
+    double m_tolerance = 0.25;
+
+    QString m_baselinePath;
+    QString m_reportPath;
+    QList<int> m_pending;
+    int m_current = -1;
+    QVector<Sample> m_samples;
+
+    // frameSwapped is emitted on the render thread, the first swap after
+    // an action is taken there and handed back to the GUI thread
+    QElapsedTimer m_timer;
+    QAtomicInteger<int> m_armed;
+    QAtomicInteger<qint64> m_frameNs;
+    QMetaObject::Connection m_swapped;
+
+    double m_frameMs = -1.0;
+    double m_drawMs = -1.0;
+    bool m_drawing = false;
+    bool m_drawn = false;
+    QTimer m_settleTimer;
+};
+
+#endif // INTERACTIONREPLAY_H
@@ -0,0 +1,219 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "MapQuickView.h"
+#include "FeatureCollectionLayer.h"
+#include "Viewpoint.h"
+
+#include <QQuickWindow>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QFile>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "FrameTimer.h"
+#include "ProcessMemory.h"
+#include "RendererComparison.h"
+
+using namespace Esri::ArcGISRuntime;
+
+namespace {
+    const QString DictionaryRun = QStringLiteral("dictionary");
+    const QString UniqueValueRun = QStringLiteral("uniqueValue");
+
+    // Give up waiting for a draw to complete after this long
+    const int SettleTimeout = 5000;
+}
+
+RendererComparison::RendererComparison(MapQuickView* mapView, FeatureCollectionLayer* dLayer, FeatureCollectionLayer* uLayer, QObject* parent /* = nullptr */):
+    QObject(parent),
+    m_mapView(mapView),
+    m_dLayer(dLayer),
+    m_uLayer(uLayer)
+{
+    m_scales << 2000 << 5000 << 10000 << 25000;
+    m_sizes << 24 << 44 << 88 << 176;
+
+    m_settleTimer.setSingleShot(true);
+    m_settleTimer.setInterval(SettleTimeout);
+    connect(&m_settleTimer, &QTimer::timeout, this, &RendererComparison::beginSampling);
+
+    connect(m_mapView, &MapQuickView::drawStatusChanged, this, [this](DrawStatus status) {
+        if (status == DrawStatus::Completed && m_settleTimer.isActive()) {
+            m_settleTimer.stop();
+            beginSampling();
+        }
+    });
+}
+
+RendererComparison::~RendererComparison()
+{
+}
+
+void RendererComparison::setScales(const QList<double>& scales) {
+    m_scales = scales;
+}
+
+void RendererComparison::setSymbolSizes(const QList<int>& sizes) {
+    m_sizes = sizes;
+}
+
+void RendererComparison::setFramesPerRun(int frames) {
+    m_framesPerRun = qMax(1, frames);
+}
+
+void RendererComparison::setResizeFunction(std::function<void(int)> resize) {
+    m_resize = resize;
+}
+
+void RendererComparison::start(const QString& reportPath) {
+    if (!m_pending.isEmpty() || !m_mapView->window())
+        return;
+
+    m_reportPath = reportPath;
+    m_results.clear();
+
+    m_center = Point(m_mapView->currentViewpoint(ViewpointType::CenterAndScale).targetGeometry());
+    m_dVisible = m_dLayer->isVisible();
+    m_uVisible = m_uLayer->isVisible();
+
+    // The dictionary renderer resolves its own symbol size, so it only
+    // varies by scale
+    for (double scale : m_scales) {
+        Run dRun;
+        dRun.renderer = DictionaryRun;
+        dRun.scale = scale;
+        m_pending.append(dRun);
+
+        for (int size : m_sizes) {
+            Run uRun;
+            uRun.renderer = UniqueValueRun;
+            uRun.scale = scale;
+            uRun.symbolSize = size;
+            m_pending.append(uRun);
+        }
+    }
+
+    if (!m_frameTimer)
+        m_frameTimer = new FrameTimer(m_mapView->window(), this);
+
+    qDebug() << "Renderer comparison: " << m_pending.size() << " runs of " << m_framesPerRun << " frames";
+    nextRun();
+}
+
+void RendererComparison::nextRun() {
+    if (m_pending.isEmpty()) {
+        m_dLayer->setVisible(m_dVisible);
+        m_uLayer->setVisible(m_uVisible);
+        writeReport();
+        emit finished(m_reportPath);
+        return;
+    }
+
+    m_current = m_pending.takeFirst();
+
+    // Show only the renderer under test
+    const bool dictionary = m_current.renderer == DictionaryRun;
+    m_dLayer->setVisible(dictionary);
+    m_uLayer->setVisible(!dictionary);
+
+    if (!dictionary && m_resize)
+        m_resize(m_current.symbolSize);
+
+    m_mapView->setViewpoint(Viewpoint(m_center, m_current.scale));
+
+    // Sample once the new state has finished drawing
+    m_settleTimer.start();
+}
+
+void RendererComparison::beginSampling() {
+    m_current.memoryBefore = ProcessMemory::residentBytes();
+    m_nudge = 0;
+
+    m_frameTimer->reset();
+    m_frameTimer->start();
+
+    // afterAnimating is emitted on the GUI thread once per frame, nudging
+    // the viewpoint there keeps the map redrawing continuously
+    m_animating = connect(m_mapView->window(), &QQuickWindow::afterAnimating, this, &RendererComparison::sampleFrame);
+    m_mapView->window()->update();
+}
+
+void RendererComparison::sampleFrame() {
+    if (m_frameTimer->frameCount() >= m_framesPerRun) {
+        finishRun();
+        return;
+    }
+
+    // Move one device independent pixel back and forth
+    const double offset = (m_nudge++ % 2 == 0 ? 1.0 : -1.0) * m_mapView->unitsPerDIP();
+    Point center(m_center.x() + offset, m_center.y(), m_center.spatialReference());
+
+    m_mapView->setViewpoint(Viewpoint(center, m_current.scale));
+    m_mapView->window()->update();
+}
+
+void RendererComparison::finishRun() {
+    disconnect(m_animating);
+    m_frameTimer->stop();
+
+    m_current.frameTimes = m_frameTimer->samples();
+    m_current.memoryAfter = ProcessMemory::residentBytes();
+
+    qDebug() << m_current.renderer << " scale " << m_current.scale << " size " << m_current.symbolSize
+             << " p50 " << FrameTimer::percentile(m_current.frameTimes, 50)
+             << " p95 " << FrameTimer::percentile(m_current.frameTimes, 95)
+             << " p99 " << FrameTimer::percentile(m_current.frameTimes, 99);
+
+    m_results.append(m_current);
+
+    // Let the current frame finish before changing the state
+    QTimer::singleShot(0, this, &RendererComparison::nextRun);
+}
+
+void RendererComparison::writeReport() {
+    QJsonArray runs;
+    for (const Run& run : m_results) {
+        QJsonObject result;
+        result["renderer"] = run.renderer;
+        result["scale"] = run.scale;
+        result["symbolSize"] = run.symbolSize;
+        result["frames"] = run.frameTimes.size();
+        result["meanMs"] = FrameTimer::mean(run.frameTimes);
+        result["p50Ms"] = FrameTimer::percentile(run.frameTimes, 50);
+        result["p95Ms"] = FrameTimer::percentile(run.frameTimes, 95);
+        result["p99Ms"] = FrameTimer::percentile(run.frameTimes, 99);
+        result["maxMs"] = run.frameTimes.isEmpty() ? 0.0 : *std::max_element(run.frameTimes.constBegin(), run.frameTimes.constEnd());
+        result["memoryBeforeBytes"] = static_cast<double>(run.memoryBefore);
+        result["memoryAfterBytes"] = static_cast<double>(run.memoryAfter);
+        runs.append(result);
+    }
+
+    QJsonObject report;
+    report["created"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report["framesPerRun"] = m_framesPerRun;
+    report["peakMemoryBytes"] = static_cast<double>(ProcessMemory::peakResidentBytes());
+    report["runs"] = runs;
+
+    QFile file(m_reportPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Unable to write comparison report: " << m_reportPath;
+        return;
+    }
+
+    file.write(QJsonDocument(report).toJson());
+    qDebug() << "Comparison report: " << m_reportPath;
+}
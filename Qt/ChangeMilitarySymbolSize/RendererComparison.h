@@ -0,0 +1,100 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef RENDERERCOMPARISON_H
+#define RENDERERCOMPARISON_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class MapQuickView;
+        class FeatureCollectionLayer;
+    }
+}
+
+#include <QObject>
+#include <QList>
+#include <QTimer>
+#include <functional>
+
+#include "Point.h"
+
+class FrameTimer;
+
+// Renders the same catalog with the dictionary and the unique value
+// renderer at several scales and symbol sizes, and writes the frame time
+// distribution and memory use of each run to a JSON report.
+class RendererComparison : public QObject
+{
+    Q_OBJECT
+
+public:
+    RendererComparison(Esri::ArcGISRuntime::MapQuickView* mapView,
+                       Esri::ArcGISRuntime::FeatureCollectionLayer* dLayer,
+                       Esri::ArcGISRuntime::FeatureCollectionLayer* uLayer,
+                       QObject* parent = nullptr);
+    ~RendererComparison();
+
+    void setScales(const QList<double>& scales);
+    void setSymbolSizes(const QList<int>& sizes);
+    void setFramesPerRun(int frames);
+
+    // Applies a symbol size to the unique value renderer
+    void setResizeFunction(std::function<void(int)> resize);
+
+    void start(const QString& reportPath);
+
+signals:
+    void finished(const QString& reportPath);
+
+private:
+    struct Run {
+        QString renderer;
+        double scale = 0.0;
+        int symbolSize = 0;
+
+        QVector<double> frameTimes;
+        qint64 memoryBefore = -1;
+        qint64 memoryAfter = -1;
+    };
+
+    void nextRun();
+    void beginSampling();
+    void sampleFrame();
+    void finishRun();
+    void writeReport();
+
+    Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
+    Esri::ArcGISRuntime::FeatureCollectionLayer* m_dLayer = nullptr;
+    Esri::ArcGISRuntime::FeatureCollectionLayer* m_uLayer = nullptr;
+
+    std::function<void(int)> m_resize;
+
+    QList<double> m_scales;
+    QList<int> m_sizes;
+    int m_framesPerRun = 240;
+
+    QList<Run> m_pending;
+    QList<Run> m_results;
+    Run m_current;
+
+    FrameTimer* m_frameTimer = nullptr;
+    QTimer m_settleTimer;
+    QMetaObject::Connection m_animating;
+
+    Esri::ArcGISRuntime::Point m_center;
+    QString m_reportPath;
+    bool m_dVisible = true;
+    bool m_uVisible = true;
+    int m_nudge = 0;
+};
+
+#endif // RENDERERCOMPARISON_H
@@ -15,6 +15,7 @@
 #include <QGuiApplication>
 #include <QQuickView>
 #include <QCommandLineParser>
+#include <QDebug>
 #include <QDir>
 #include <QMessageBox>
 #include <QQmlEngine>
@@ -27,8 +28,10 @@
 
 #include "MapQuickView.h"
 
+#include "AllocationProfiler.h"
 #include "AppInfo.h"
 #include "ChangeMilitarySymbolSize.h"
+#include "RenderTelemetry.h"
 
 //------------------------------------------------------------------------------
 
@@ -41,6 +44,45 @@
 #define kArgShowDescription             "Show option maximized | minimized | fullscreen | normal | default"
 #define kArgShowDefault                 "show"
 
+#define kArgCompareName                 "compare"
+#define kArgCompareValueName            "reportFile"
+#define kArgCompareDescription          "Compare the dictionary and unique value renderers, write the report to reportFile and exit"
+
+#define kArgProfileAllocationsName      "profile-allocations"
+#define kArgProfileAllocationsValueName "reportFile"
+#define kArgProfileAllocationsDescription "Count the allocations of every load stage and write them to reportFile on exit"
+
+#define kArgRecordName                  "record"
+#define kArgRecordValueName             "scriptFile"
+#define kArgRecordDescription           "Record the renderer toggles, resizes and navigation to scriptFile on exit"
+
+#define kArgReplayName                  "replay"
+#define kArgReplayValueName             "scriptFile"
+#define kArgReplayDescription           "Replay the interactions of scriptFile, measure the latency of each and exit, with 2 if any regressed"
+
+#define kArgReplayBaselineName          "replay-baseline"
+#define kArgReplayBaselineValueName     "baselineFile"
+#define kArgReplayBaselineDescription   "Latencies to compare the replay with, recorded by the first replay if missing"
+#define kArgReplayBaselineDefault       "replay-baseline.json"
+
+#define kArgReplayReportName            "replay-report"
+#define kArgReplayReportValueName       "reportFile"
+#define kArgReplayReportDescription     "Latencies of the replay and the regressions against the baseline"
+#define kArgReplayReportDefault         "replay-report.json"
+
+#define kArgReplayRepeatName            "replay-repeat"
+#define kArgReplayRepeatValueName       "count"
+#define kArgReplayRepeatDescription     "Times the whole script is replayed, the latencies are the medians"
+#define kArgReplayRepeatDefault         "5"
+
+#define kArgSnapshotName                "snapshot"
+#define kArgSnapshotValueName           "snapshotFile"
+#define kArgSnapshotDescription         "Restore the session from this snapshot if it matches, and save it on exit"
+
+#define kArgCatalogName                 "catalog"
+#define kArgCatalogValueName            "catalogFile"
+#define kArgCatalogDescription          "Show the pages of catalogFile instead of the built-in ones, and apply its changes while running"
+
 #define kShowMaximized                  "maximized"
 #define kShowMinimized                  "minimized"
 #define kShowFullScreen                 "fullscreen"
@@ -96,6 +138,9 @@ int main(int argc, char *argv[])
     // Register the ChangeMilitarySymbolSize (QQuickItem) for QML
     qmlRegisterType<ChangeMilitarySymbolSize>("Esri.ChangeMilitarySymbolSize", 1, 0, "ChangeMilitarySymbolSize");
 
+    // Register the telemetry exposed by the item for the overlay
+    qmlRegisterUncreatableType<RenderTelemetry>("Esri.ChangeMilitarySymbolSize", 1, 0, "RenderTelemetry", "RenderTelemetry is provided by the app item");
+
     // Intialize application view
     QQuickView view;
     view.setResizeMode(QQuickView::SizeRootObjectToView);
@@ -124,15 +169,49 @@ int main(int argc, char *argv[])
 #if !defined(Q_OS_IOS) && !defined(Q_OS_ANDROID)
     // Process command line
     QCommandLineOption showOption(kArgShowName, kArgShowDescription, kArgShowValueName, kArgShowDefault);
+    QCommandLineOption compareOption(kArgCompareName, kArgCompareDescription, kArgCompareValueName);
+    QCommandLineOption profileAllocationsOption(kArgProfileAllocationsName, kArgProfileAllocationsDescription, kArgProfileAllocationsValueName);
+    QCommandLineOption recordOption(kArgRecordName, kArgRecordDescription, kArgRecordValueName);
+    QCommandLineOption replayOption(kArgReplayName, kArgReplayDescription, kArgReplayValueName);
+    QCommandLineOption replayBaselineOption(kArgReplayBaselineName, kArgReplayBaselineDescription, kArgReplayBaselineValueName, kArgReplayBaselineDefault);
+    QCommandLineOption replayReportOption(kArgReplayReportName, kArgReplayReportDescription, kArgReplayReportValueName, kArgReplayReportDefault);
+    QCommandLineOption replayRepeatOption(kArgReplayRepeatName, kArgReplayRepeatDescription, kArgReplayRepeatValueName, kArgReplayRepeatDefault);
+    QCommandLineOption snapshotOption(kArgSnapshotName, kArgSnapshotDescription, kArgSnapshotValueName);
+    QCommandLineOption catalogOption(kArgCatalogName, kArgCatalogDescription, kArgCatalogValueName);
 
     QCommandLineParser commandLineParser;
 
     commandLineParser.setApplicationDescription(kApplicationDescription);
     commandLineParser.addOption(showOption);
+    commandLineParser.addOption(compareOption);
+    commandLineParser.addOption(profileAllocationsOption);
+    commandLineParser.addOption(recordOption);
+    commandLineParser.addOption(replayOption);
+    commandLineParser.addOption(replayBaselineOption);
+    commandLineParser.addOption(replayReportOption);
+    commandLineParser.addOption(replayRepeatOption);
+    commandLineParser.addOption(snapshotOption);
+    commandLineParser.addOption(catalogOption);
     commandLineParser.addHelpOption();
     commandLineParser.addVersionOption();
     commandLineParser.process(app);
 
+    // Before the style loads, so every stage of the catalog is counted
+    if (commandLineParser.isSet(profileAllocationsOption))
+    {
+        AllocationProfiler::setEnabled(true);
+
+        const QString reportPath = commandLineParser.value(profileAllocationsOption);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [reportPath]()
+        {
+            qDebug().noquote() << AllocationProfiler::report();
+
+            QString reportError;
+            if (!AllocationProfiler::writeReport(reportPath, &reportError))
+                qCritical("%s", qPrintable(reportError));
+        });
+    }
+
     // Show app window
 
     auto showValue = commandLineParser.value(kArgShowName).toLower();
@@ -158,6 +237,81 @@ int main(int argc, char *argv[])
         view.show();
     }
 
+    // The catalog is only built once the style has loaded, so the snapshot
+    // can still be set on the item here
+    if (commandLineParser.isSet(snapshotOption))
+    {
+        ChangeMilitarySymbolSize* item = qobject_cast<ChangeMilitarySymbolSize*>(view.rootObject());
+        if (item)
+        {
+            const QString snapshotPath = commandLineParser.value(snapshotOption);
+            item->setSnapshotPath(snapshotPath);
+
+            QObject::connect(&app, &QCoreApplication::aboutToQuit, item, [item, snapshotPath]()
+            {
+                item->saveSnapshot(snapshotPath);
+            });
+        }
+    }
+
+    if (commandLineParser.isSet(catalogOption))
+    {
+        ChangeMilitarySymbolSize* item = qobject_cast<ChangeMilitarySymbolSize*>(view.rootObject());
+        if (item)
+            item->setCatalogPath(commandLineParser.value(catalogOption));
+    }
+
+    // Run the renderer comparison once the catalog is loaded, then quit
+    if (commandLineParser.isSet(compareOption))
+    {
+        ChangeMilitarySymbolSize* item = qobject_cast<ChangeMilitarySymbolSize*>(view.rootObject());
+        if (item)
+        {
+            QObject::connect(item, &ChangeMilitarySymbolSize::comparisonFinished, &app, &QGuiApplication::quit);
+            item->runComparison(commandLineParser.value(compareOption));
+        }
+    }
+
+    if (commandLineParser.isSet(recordOption))
+    {
+        ChangeMilitarySymbolSize* item = qobject_cast<ChangeMilitarySymbolSize*>(view.rootObject());
+        if (item)
+        {
+            const QString scriptPath = commandLineParser.value(recordOption);
+            item->startRecording();
+
+            QObject::connect(&app, &QCoreApplication::aboutToQuit, item, [item, scriptPath]()
+            {
+                item->saveRecording(scriptPath);
+            });
+        }
+    }
+
+    // Replay once the catalog is loaded, then exit with 2 if any action
+    // regressed
+    if (commandLineParser.isSet(replayOption))
+    {
+        ChangeMilitarySymbolSize* item = qobject_cast<ChangeMilitarySymbolSize*>(view.rootObject());
+        if (item)
+        {
+            QObject::connect(item, &ChangeMilitarySymbolSize::replayFinished, &app, [&app](int regressions)
+            {
+                app.exit(regressions > 0 ? 2 : 0);
+            });
+
+            QString replayError;
+            if (!item->runReplay(commandLineParser.value(replayOption),
+                                 commandLineParser.value(replayBaselineOption),
+                                 commandLineParser.value(replayReportOption),
+                                 commandLineParser.value(replayRepeatOption).toInt(),
+                                 &replayError))
+            {
+                qCritical("%s", qPrintable(replayError));
+                return 1;
+            }
+        }
+    }
+
 #else
     view.show();
 #endif
@@ -16,6 +16,7 @@ import QtQuick.Controls 1.4
 import Esri.ChangeMilitarySymbolSize 1.0
 
 ChangeMilitarySymbolSize {
+    id: app
     width: 800
     height: 600
 
@@ -27,6 +28,16 @@ ChangeMilitarySymbolSize {
         objectName: "mapView"
         // set focus to enable keyboard navigation
         focus: true
+
+        TelemetryOverlay {
+            anchors {
+                top: parent.top
+                right: parent.right
+                margins: 8 * scaleFactor
+            }
+            telemetry: app.telemetry
+            scaleFactor: app.scaleFactor
+        }
     }
 
     Slider {
@@ -78,7 +89,87 @@ ChangeMilitarySymbolSize {
         }
 
         text: "apply resize"
+        enabled: !app.autoSize
         onClicked: btnSPressed(slider.value.toFixed(0))
     }
 
+    CheckBox {
+        id: autoSizeBox
+        anchors {
+            verticalCenter: thirdButton.verticalCenter
+            left: thirdButton.right
+            margins: 8 * scaleFactor
+        }
+
+        text: "size by scale"
+        checked: app.autoSize
+        onClicked: app.autoSize = checked
+    }
+
+    Text {
+        id: symbolLabel
+        anchors {
+            left: parent.left
+            bottom: parent.bottom
+            margins: 8 * scaleFactor
+        }
+        font.family: "Courier"
+    }
+
+    TextField {
+        id: filterField
+        anchors {
+            top: parent.top
+            horizontalCenter: parent.horizontalCenter
+            margins: 8 * scaleFactor
+        }
+        width: 240 * scaleFactor
+        placeholderText: "filter, e.g. hostile & ground"
+        textColor: valid ? "black" : "red"
+
+        property bool valid: true
+
+        onAccepted: valid = applyFilter(text)
+    }
+
+    Button {
+        id: previousPageButton
+        anchors {
+            right: pageLabel.left
+            verticalCenter: pageLabel.verticalCenter
+            margins: 8 * scaleFactor
+        }
+
+        text: "<"
+        enabled: app.pageIndex > 0
+        onClicked: previousPage()
+    }
+
+    Text {
+        id: pageLabel
+        anchors {
+            right: nextPageButton.left
+            verticalCenter: nextPageButton.verticalCenter
+            margins: 8 * scaleFactor
+        }
+
+        text: app.pageIndex >= 0 ? "page " + app.pageNumber + " (" + (app.pageIndex + 1) + "/" + app.pageCount + ")" : ""
+    }
+
+    Button {
+        id: nextPageButton
+        anchors {
+            right: parent.right
+            bottom: parent.bottom
+            margins: 32 * scaleFactor
+        }
+
+        text: ">"
+        enabled: app.pageIndex >= 0 && app.pageIndex < app.pageCount - 1
+        onClicked: nextPage()
+    }
+
+    onSymbolHovered: symbolLabel.text = sidc
+    onSymbolSelected: symbolLabel.text = sidc
+
 }
@@ -0,0 +1,236 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QMutex>
+#include <QSaveFile>
+#include <QStringList>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(Q_OS_WIN) || defined(Q_OS_LINUX)
+#include <malloc.h>
+#elif defined(Q_OS_MAC)
+#include <malloc/malloc.h>
+#endif
+
+#include "AllocationProfiler.h"
+
+namespace {
+    const int MaxStages = 64;
+    const int MaxNameLength = 32;
+
+    struct StageCounters {
+        std::atomic<long long> allocations;
+        std::atomic<long long> bytes;
+        std::atomic<long long> frees;
+        std::atomic<long long> freedBytes;
+        std::atomic<long long> peakLive;
+    };
+
+    // Static storage only, the operators must not allocate themselves
+    StageCounters s_stages[MaxStages];
+    char s_names[MaxStages][MaxNameLength] = { "(none)" };
+    std::atomic<int> s_stageCount(1);
+    std::atomic<bool> s_enabled(false);
+    std::atomic<long long> s_live(0);
+    QBasicMutex s_registerMutex;
+
+    thread_local int t_stage = 0;
+
+    size_t blockSize(void* block) {
+#if defined(Q_OS_WIN)
+        return _msize(block);
+#elif defined(Q_OS_MAC)
+        return malloc_size(block);
+#elif defined(Q_OS_LINUX)
+        return malloc_usable_size(block);
+#else
+        Q_UNUSED(block);
+        return 0;
+#endif
+    }
+
+    void countAllocation(void* block) {
+        StageCounters& stage = s_stages[t_stage];
+        const long long size = static_cast<long long>(blockSize(block));
+
+        stage.allocations.fetch_add(1, std::memory_order_relaxed);
+        stage.bytes.fetch_add(size, std::memory_order_relaxed);
+
+        const long long live = s_live.fetch_add(size, std::memory_order_relaxed) + size;
+        long long peak = stage.peakLive.load(std::memory_order_relaxed);
+        while (live > peak && !stage.peakLive.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    }
+
+    void countFree(void* block) {
+        StageCounters& stage = s_stages[t_stage];
+        const long long size = static_cast<long long>(blockSize(block));
+
+        stage.frees.fetch_add(1, std::memory_order_relaxed);
+        stage.freedBytes.fetch_add(size, std::memory_order_relaxed);
+        s_live.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void* allocate(size_t size) {
+        void* block = std::malloc(size ? size : 1);
+        if (block && s_enabled.load(std::memory_order_relaxed))
+            countAllocation(block);
+        return block;
+    }
+
+    void release(void* block) {
+        if (!block)
+            return;
+        if (s_enabled.load(std::memory_order_relaxed))
+            countFree(block);
+        std::free(block);
+    }
+
+    QString megabytes(long long bytes) {
+        return QString::number(bytes / (1024.0 * 1024.0), 'f', 2);
+    }
+}
+
+void* operator new(size_t size) {
+    void* block = allocate(size);
+    if (!block)
+        throw std::bad_alloc();
+    return block;
+}
+
+void* operator new[](size_t size) {
+    void* block = allocate(size);
+    if (!block)
+        throw std::bad_alloc();
+    return block;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void* block) noexcept {
+    release(block);
+}
+
+void operator delete[](void* block) noexcept {
+    release(block);
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+void AllocationProfiler::setEnabled(bool enabled) {
+    s_enabled.store(enabled);
+}
+
+bool AllocationProfiler::isEnabled() {
+    return s_enabled.load();
+}
+
+void AllocationProfiler::reset() {
+    for (StageCounters& stage : s_stages) {
+        stage.allocations.store(0);
+        stage.bytes.store(0);
+        stage.frees.store(0);
+        stage.freedBytes.store(0);
+        stage.peakLive.store(0);
+    }
+    s_live.store(0);
+}
+
+int AllocationProfiler::stage(const QString& name) {
+    const QByteArray latin1 = name.toLatin1().left(MaxNameLength - 1);
+
+    QMutexLocker lock(&s_registerMutex);
+    const int count = s_stageCount.load();
+    for (int i = 0; i < count; i++) {
+        if (latin1 == s_names[i])
+            return i;
+    }
+
+    // Past the last stage everything is counted as unattributed
+    if (count == MaxStages)
+        return 0;
+
+    std::strncpy(s_names[count], latin1.constData(), MaxNameLength - 1);
+    s_stageCount.store(count + 1);
+    return count;
+}
+
+QString AllocationProfiler::report() {
+    QStringList lines;
+    lines << QString("%1 %2 %3 %4 %5 %6")
+             .arg("stage", -16).arg("allocations", 12).arg("MB", 10)
+             .arg("frees", 12).arg("freed MB", 10).arg("peak MB", 10);
+
+    const int count = s_stageCount.load();
+    for (int i = 0; i < count; i++) {
+        const StageCounters& stage = s_stages[i];
+        if (stage.allocations.load() == 0 && stage.frees.load() == 0)
+            continue;
+
+        lines << QString("%1 %2 %3 %4 %5 %6")
+                 .arg(QString::fromLatin1(s_names[i]), -16)
+                 .arg(stage.allocations.load(), 12)
+                 .arg(megabytes(stage.bytes.load()), 10)
+                 .arg(stage.frees.load(), 12)
+                 .arg(megabytes(stage.freedBytes.load()), 10)
+                 .arg(megabytes(stage.peakLive.load()), 10);
+    }
+
+    // Blocks allocated before the profiler was enabled may be freed after
+    lines << QString("live %1 MB").arg(megabytes(qMax(0LL, s_live.load())));
+
+    return lines.join('\n');
+}
+
+bool AllocationProfiler::writeReport(const QString& path, QString* errorMessage /* = nullptr */) {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text) ||
+        file.write(report().toUtf8().append('\n')) < 0 ||
+        !file.commit()) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+AllocationScope::AllocationScope(int stage):
+    m_previous(t_stage)
+{
+    t_stage = (stage >= 0 && stage < MaxStages) ? stage : 0;
+}
+
+AllocationScope::AllocationScope(const QString& stage):
+    AllocationScope(AllocationProfiler::stage(stage))
+{
+}
+
+AllocationScope::~AllocationScope()
+{
+    t_stage = m_previous;
+}
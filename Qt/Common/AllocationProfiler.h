@@ -0,0 +1,56 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef ALLOCATIONPROFILER_H
+#define ALLOCATIONPROFILER_H
+
+#include <QString>
+
+// Counts the allocations made through the global operator new and
+// delete, attributed to the stage open on the allocating thread. The
+// operators are replaced for the whole app but only count while enabled,
+// at the cost of one atomic load per allocation otherwise.
+//
+// Frees are attributed to the stage open when they happen, and the peak
+// of a stage is the most bytes live in the whole process while it was
+// open on any thread.
+namespace AllocationProfiler {
+    void setEnabled(bool enabled);
+    bool isEnabled();
+
+    void reset();
+
+    // Index of a named stage, registered on first use. Index 0 collects
+    // the allocations outside of any stage.
+    int stage(const QString& name);
+
+    // One line per stage that allocated
+    QString report();
+    bool writeReport(const QString& path, QString* errorMessage = nullptr);
+}
+
+// Opens a stage on this thread for its lifetime, stages nest
+class AllocationScope
+{
+public:
+    explicit AllocationScope(int stage);
+    explicit AllocationScope(const QString& stage);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    int m_previous;
+};
+
+#endif // ALLOCATIONPROFILER_H
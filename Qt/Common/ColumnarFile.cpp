@@ -0,0 +1,264 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QIODevice>
+
+#include <climits>
+#include <cstring>
+
+#include "ColumnarFile.h"
+
+namespace {
+    const char Magic[4] = { 'M', 'S', 'C', 'F' };
+    const quint32 Version = 1;
+
+    // Rows per batch when writing whole tables
+    const int ChunkRows = 65536;
+
+    enum MessageType {
+        EndOfStream = 0,
+        DictionaryDelta = 1,
+        RecordBatch = 2
+    };
+
+    struct MessageHeader {
+        quint32 type;
+        quint32 table;
+        quint64 length;
+    };
+
+    static_assert(sizeof(MessageHeader) == 16, "columnar message layout");
+
+    // Messages are padded so every column starts 8 byte aligned
+    int padding(qint64 length) {
+        return static_cast<int>((8 - (length % 8)) % 8);
+    }
+
+    void appendPadding(QByteArray* body) {
+        body->append(QByteArray(padding(body->size()), '\0'));
+    }
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+
+    bool readExactly(QIODevice* device, char* data, qint64 length) {
+        qint64 done = 0;
+        while (done < length) {
+            const qint64 read = device->read(data + done, length - done);
+            if (read <= 0 && !device->waitForReadyRead(-1))
+                return false;
+            if (read > 0)
+                done += read;
+        }
+
+        return true;
+    }
+
+    // Whether a message body of length bytes can be in the file at all,
+    // checked before anything is allocated for it
+    bool fitsDevice(QIODevice* device, quint64 length) {
+        if (length > quint64(INT_MAX))
+            return false;
+        if (device->isSequential())
+            return true;
+
+        return length <= quint64(qMax<qint64>(0, device->size() - device->pos()));
+    }
+}
+
+ColumnarWriter::ColumnarWriter(QIODevice* device):
+    m_device(device)
+{
+}
+
+bool ColumnarWriter::begin() {
+    char header[8];
+    std::memcpy(header, Magic, sizeof(Magic));
+    std::memcpy(header + 4, &Version, sizeof(Version));
+
+    return m_device->write(header, sizeof(header)) == sizeof(header);
+}
+
+bool ColumnarWriter::writeBatch(int table, const QVector<double>& x, const QVector<double>& y, const QStringList& codes, int start /* = 0 */, int count /* = -1 */) {
+    if (count < 0)
+        count = x.size() - start;
+
+    // Encode the codes, collecting the ones the stream has not seen yet
+    QVector<quint32> indices(count);
+    QStringList added;
+    for (int row = 0; row < count; row++) {
+        const QString& code = codes.at(start + row);
+
+        auto it = m_dictionary.constFind(code);
+        if (it == m_dictionary.constEnd()) {
+            it = m_dictionary.insert(code, m_dictionary.size());
+            added.append(code);
+        }
+
+        indices[row] = it.value();
+    }
+
+    if (!added.isEmpty()) {
+        QByteArray delta;
+        const quint32 addedCount = added.size();
+        delta.append(reinterpret_cast<const char*>(&addedCount), sizeof(addedCount));
+
+        for (const QString& code : added) {
+            const QByteArray latin1 = code.toLatin1();
+            const quint16 length = latin1.size();
+            delta.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            delta.append(latin1);
+        }
+
+        if (!writeMessage(DictionaryDelta, table, delta))
+            return false;
+    }
+
+    const quint64 rows = count;
+
+    QByteArray body;
+    body.reserve(8 + count * (2 * sizeof(double) + sizeof(quint32)) + 8);
+    body.append(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    body.append(reinterpret_cast<const char*>(x.constData() + start), count * sizeof(double));
+    body.append(reinterpret_cast<const char*>(y.constData() + start), count * sizeof(double));
+    body.append(reinterpret_cast<const char*>(indices.constData()), count * sizeof(quint32));
+
+    return writeMessage(RecordBatch, table, body);
+}
+
+bool ColumnarWriter::writeTable(int table, const QVector<double>& x, const QVector<double>& y, const QStringList& codes) {
+    for (int start = 0; start < x.size(); start += ChunkRows) {
+        if (!writeBatch(table, x, y, codes, start, qMin(ChunkRows, x.size() - start)))
+            return false;
+    }
+
+    return true;
+}
+
+bool ColumnarWriter::finish() {
+    return writeMessage(EndOfStream, 0, QByteArray());
+}
+
+bool ColumnarWriter::writeMessage(quint32 type, quint32 table, const QByteArray& body) {
+    QByteArray padded = body;
+    appendPadding(&padded);
+
+    MessageHeader header;
+    header.type = type;
+    header.table = table;
+    header.length = padded.size();
+
+    return m_device->write(reinterpret_cast<const char*>(&header), sizeof(header)) == sizeof(header)
+        && m_device->write(padded) == padded.size();
+}
+
+ColumnarReader::ColumnarReader(QIODevice* device):
+    m_device(device)
+{
+}
+
+bool ColumnarReader::open(QString* errorMessage /* = nullptr */) {
+    char header[8];
+    if (!readExactly(m_device, header, sizeof(header)) || std::memcmp(header, Magic, sizeof(Magic)) != 0)
+        return fail(errorMessage, QStringLiteral("Not a columnar feature file"));
+
+    quint32 version = 0;
+    std::memcpy(&version, header + 4, sizeof(version));
+    if (version != Version)
+        return fail(errorMessage, QString("Columnar file version %1, expected %2").arg(version).arg(Version));
+
+    m_dictionary.clear();
+    return true;
+}
+
+bool ColumnarReader::next(ColumnBatch* batch, QString* errorMessage /* = nullptr */) {
+    const QString damaged = QStringLiteral("Columnar file is truncated or damaged");
+
+    forever {
+        MessageHeader header;
+        if (!readExactly(m_device, reinterpret_cast<char*>(&header), sizeof(header)))
+            return fail(errorMessage, damaged);
+
+        if (header.type == EndOfStream)
+            return false;
+
+        if (!fitsDevice(m_device, header.length))
+            return fail(errorMessage, damaged);
+
+        if (header.type == DictionaryDelta) {
+            QByteArray body(static_cast<int>(header.length), '\0');
+            if (!readExactly(m_device, body.data(), body.size()) || body.size() < 4)
+                return fail(errorMessage, damaged);
+
+            quint32 count = 0;
+            std::memcpy(&count, body.constData(), sizeof(count));
+
+            int offset = sizeof(count);
+            for (quint32 i = 0; i < count; i++) {
+                quint16 length = 0;
+                if (offset + 2 > body.size())
+                    return fail(errorMessage, damaged);
+                std::memcpy(&length, body.constData() + offset, sizeof(length));
+                offset += sizeof(length);
+
+                if (offset + length > body.size())
+                    return fail(errorMessage, damaged);
+                m_dictionary.append(QString::fromLatin1(body.constData() + offset, length));
+                offset += length;
+            }
+
+            continue;
+        }
+
+        if (header.type != RecordBatch)
+            return fail(errorMessage, damaged);
+
+        quint64 rows = 0;
+        if (!readExactly(m_device, reinterpret_cast<char*>(&rows), sizeof(rows)))
+            return fail(errorMessage, damaged);
+
+        const quint64 columns = rows * (2 * sizeof(double) + sizeof(quint32));
+        if (rows > quint64(INT_MAX / sizeof(double)) || sizeof(rows) + columns > header.length)
+            return fail(errorMessage, damaged);
+
+        // Straight into the columns, no per row decoding
+        batch->table = header.table;
+        batch->x.resize(static_cast<int>(rows));
+        batch->y.resize(static_cast<int>(rows));
+        batch->codes.resize(static_cast<int>(rows));
+
+        const quint64 remaining = header.length - sizeof(rows) - columns;
+        if (remaining >= 8)
+            return fail(errorMessage, damaged);
+
+        char skip[8];
+        if (!readExactly(m_device, reinterpret_cast<char*>(batch->x.data()), rows * sizeof(double))
+            || !readExactly(m_device, reinterpret_cast<char*>(batch->y.data()), rows * sizeof(double))
+            || !readExactly(m_device, reinterpret_cast<char*>(batch->codes.data()), rows * sizeof(quint32))
+            || !readExactly(m_device, skip, remaining))
+            return fail(errorMessage, damaged);
+
+        for (quint32 code : batch->codes) {
+            if (code >= quint32(m_dictionary.size()))
+                return fail(errorMessage, damaged);
+        }
+
+        return true;
+    }
+}
+
+const QStringList& ColumnarReader::dictionary() const {
+    return m_dictionary;
+}
@@ -0,0 +1,83 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef COLUMNARFILE_H
+#define COLUMNARFILE_H
+
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+class QIODevice;
+
+// Feature columns of one table, as written and read in chunks
+struct ColumnBatch {
+    enum Table {
+        DictionaryTable = 0,
+        UniqueValueTable = 1
+    };
+
+    int table = DictionaryTable;
+    QVector<double> x;
+    QVector<double> y;
+
+    // Indices into the dictionary of the stream
+    QVector<quint32> codes;
+
+    int rowCount() const { return x.size(); }
+};
+
+// Streams feature tables as columns, in the spirit of the Arrow IPC stream
+// format: a sequence of 8 byte aligned messages, dictionary deltas that
+// introduce new codes, then record batches holding one x, one y and one
+// dictionary encoded code column each. Nothing is created per row.
+class ColumnarWriter
+{
+public:
+    explicit ColumnarWriter(QIODevice* device);
+
+    bool begin();
+
+    // Writes rows [start, start + count) of the columns as one batch
+    bool writeBatch(int table, const QVector<double>& x, const QVector<double>& y, const QStringList& codes, int start = 0, int count = -1);
+
+    // Writes columns in batches of 65536 rows
+    bool writeTable(int table, const QVector<double>& x, const QVector<double>& y, const QStringList& codes);
+
+    bool finish();
+
+private:
+    bool writeMessage(quint32 type, quint32 table, const QByteArray& body);
+
+    QIODevice* m_device;
+    QHash<QString, quint32> m_dictionary;
+};
+
+class ColumnarReader
+{
+public:
+    explicit ColumnarReader(QIODevice* device);
+
+    bool open(QString* errorMessage = nullptr);
+
+    // Reads the next batch, false at the end of the stream or on an error
+    bool next(ColumnBatch* batch, QString* errorMessage = nullptr);
+
+    // Codes introduced so far
+    const QStringList& dictionary() const;
+
+private:
+    QIODevice* m_device;
+    QStringList m_dictionary;
+};
+
+#endif // COLUMNARFILE_H
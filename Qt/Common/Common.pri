@@ -0,0 +1,42 @@
+#-------------------------------------------------
+#  Copyright 2016 ESRI
+#
+#  All rights reserved under the copyright laws of the United States
+#  and applicable international laws, treaties, and conventions.
+#
+#  You may freely redistribute and use this sample code, with or
+#  without modification, provided you include the original copyright
+#  notice and use restrictions.
+#
+#  See the Sample code usage restrictions document for further information.
+#-------------------------------------------------
+
+# Links the library of the code shared by the military symbol sample
+# apps, built by Common.pro before the apps (see Qt.pro)
+
+QT += concurrent sql
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+win32:CONFIG(release, debug|release): COMMON_LIB_DIR = $$OUT_PWD/../Common/release
+else:win32:CONFIG(debug, debug|release): COMMON_LIB_DIR = $$OUT_PWD/../Common/debug
+else: COMMON_LIB_DIR = $$OUT_PWD/../Common
+
+LIBS += -L$$COMMON_LIB_DIR -lMilitarySymbols
+
+win32-msvc* {
+    PRE_TARGETDEPS += $$COMMON_LIB_DIR/MilitarySymbols.lib
+}
+else {
+    PRE_TARGETDEPS += $$COMMON_LIB_DIR/libMilitarySymbols.a
+}
+
+# Resources of a static library are not linked in, the apps compile them
+RESOURCES += \
+    $$PWD/qml/common.qrc \
+    $$PWD/data/data.qrc
+
+win32 {
+    LIBS += Psapi.lib
+}
@@ -0,0 +1,92 @@
+#-------------------------------------------------
+#  Copyright 2016 ESRI
+#
+#  All rights reserved under the copyright laws of the United States
+#  and applicable international laws, treaties, and conventions.
+#
+#  You may freely redistribute and use this sample code, with or
+#  without modification, provided you include the original copyright
+#  notice and use restrictions.
+#
+#  See the Sample code usage restrictions document for further information.
+#-------------------------------------------------
+
+# Library of the code shared by the military symbol sample apps, linked
+# by each app through Common.pri
+
+TEMPLATE = lib
+
+QT += core gui opengl network positioning sensors qml quick concurrent sql
+CONFIG += c++11 staticlib
+
+TARGET = MilitarySymbols
+
+equals(QT_MAJOR_VERSION, 5) {
+    lessThan(QT_MINOR_VERSION, 9) {
+        error("$$TARGET requires Qt 5.9.2")
+    }
+    equals(QT_MINOR_VERSION, 9) : lessThan(QT_PATCH_VERSION, 2) {
+        error("$$TARGET requires Qt 5.9.2")
+    }
+}
+
+ARCGIS_RUNTIME_VERSION = 100.2.1
+include($$PWD/arcgisruntime.pri)
+
+HEADERS += \
+    AllocationProfiler.h \
+    ColumnarFile.h \
+    CompressedBitmap.h \
+    FeatureFeed.h \
+    FrameTimer.h \
+    IntervalIndex.h \
+    LineGeneralizer.h \
+    LoadPipeline.h \
+    MpscQueue.h \
+    ProcessMemory.h \
+    QuadTree.h \
+    RenderTelemetry.h \
+    ResidencyLru.h \
+    ScaleBands.h \
+    SessionSnapshot.h \
+    ShardPlanner.h \
+    SharedSymbolCache.h \
+    SidcBitmapIndex.h \
+    SidcConverter.h \
+    SidcPatternSpace.h \
+    SidcWorkload.h \
+    SymbolCache.h \
+    SymbolEngine.h \
+    SymbolFilter.h \
+    SymbolHitTester.h \
+    SymbolSearchIndex.h \
+    TilePyramid.h \
+    TrackPlayback.h
+
+SOURCES += \
+    AllocationProfiler.cpp \
+    ColumnarFile.cpp \
+    CompressedBitmap.cpp \
+    FeatureFeed.cpp \
+    FrameTimer.cpp \
+    IntervalIndex.cpp \
+    LineGeneralizer.cpp \
+    LoadPipeline.cpp \
+    ProcessMemory.cpp \
+    RenderTelemetry.cpp \
+    ResidencyLru.cpp \
+    ScaleBands.cpp \
+    SessionSnapshot.cpp \
+    ShardPlanner.cpp \
+    SharedSymbolCache.cpp \
+    SidcBitmapIndex.cpp \
+    SidcConverter.cpp \
+    SidcPatternSpace.cpp \
+    SidcWorkload.cpp \
+    SymbolCache.cpp \
+    SymbolEngine.cpp \
+    SymbolFilter.cpp \
+    SymbolHitTester.cpp \
+    SymbolSearchIndex.cpp \
+    TilePyramid.cpp \
+    TrackPlayback.cpp
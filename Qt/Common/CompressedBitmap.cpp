@@ -0,0 +1,397 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+
+#include "CompressedBitmap.h"
+
+namespace {
+    inline quint16 highBits(quint32 value) { return static_cast<quint16>(value >> 16); }
+    inline quint16 lowBits(quint32 value) { return static_cast<quint16>(value & 0xFFFF); }
+
+    inline bool testBit(const QVector<quint64>& bits, quint16 low) {
+        return (bits.at(low >> 6) >> (low & 63)) & 1;
+    }
+}
+
+CompressedBitmap::CompressedBitmap()
+{
+}
+
+CompressedBitmap CompressedBitmap::range(quint32 count) {
+    CompressedBitmap bitmap;
+
+    for (quint32 start = 0; start < count; start += 65536) {
+        Container container;
+        container.key = highBits(start);
+        container.cardinality = static_cast<int>(qMin<quint32>(65536, count - start));
+
+        if (container.cardinality <= ArrayLimit) {
+            container.array.reserve(container.cardinality);
+            for (int i = 0; i < container.cardinality; i++)
+                container.array.append(static_cast<quint16>(i));
+        } else {
+            container.bits.fill(0, BitsetWords);
+            const int full = container.cardinality / 64;
+            for (int w = 0; w < full; w++)
+                container.bits[w] = ~Q_UINT64_C(0);
+            if (container.cardinality % 64)
+                container.bits[full] = (Q_UINT64_C(1) << (container.cardinality % 64)) - 1;
+        }
+
+        bitmap.m_containers.append(container);
+    }
+
+    return bitmap;
+}
+
+int CompressedBitmap::find(quint16 key) const {
+    // Appends in ascending order are the common case
+    if (!m_containers.isEmpty() && m_containers.last().key == key)
+        return m_containers.size() - 1;
+
+    int lo = 0;
+    int hi = m_containers.size() - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const quint16 k = m_containers.at(mid).key;
+        if (k == key)
+            return mid;
+        if (k < key)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return -(lo + 1);
+}
+
+void CompressedBitmap::add(quint32 value) {
+    const quint16 key = highBits(value);
+    const quint16 low = lowBits(value);
+
+    int index = find(key);
+    if (index < 0) {
+        index = -index - 1;
+        Container container;
+        container.key = key;
+        m_containers.insert(index, container);
+    }
+
+    Container& container = m_containers[index];
+
+    if (container.isBitset()) {
+        quint64& word = container.bits[low >> 6];
+        const quint64 mask = Q_UINT64_C(1) << (low & 63);
+        if (!(word & mask)) {
+            word |= mask;
+            container.cardinality++;
+        }
+        return;
+    }
+
+    QVector<quint16>& array = container.array;
+    if (array.isEmpty() || array.last() < low) {
+        array.append(low);
+    } else {
+        auto it = std::lower_bound(array.begin(), array.end(), low);
+        if (it != array.end() && *it == low)
+            return;
+        array.insert(it, low);
+    }
+    container.cardinality++;
+
+    if (container.cardinality > ArrayLimit)
+        toBitset(container);
+}
+
+void CompressedBitmap::remove(quint32 value) {
+    const int index = find(highBits(value));
+    if (index < 0)
+        return;
+
+    const quint16 low = lowBits(value);
+    Container& container = m_containers[index];
+
+    if (container.isBitset()) {
+        quint64& word = container.bits[low >> 6];
+        const quint64 mask = Q_UINT64_C(1) << (low & 63);
+        if (!(word & mask))
+            return;
+        word &= ~mask;
+        container.cardinality--;
+    } else {
+        auto it = std::lower_bound(container.array.begin(), container.array.end(), low);
+        if (it == container.array.end() || *it != low)
+            return;
+        container.array.erase(it);
+        container.cardinality--;
+    }
+
+    if (container.cardinality == 0)
+        m_containers.remove(index);
+    else
+        normalize(container);
+}
+
+bool CompressedBitmap::contains(quint32 value) const {
+    const int index = find(highBits(value));
+    if (index < 0)
+        return false;
+
+    const quint16 low = lowBits(value);
+    const Container& container = m_containers.at(index);
+
+    if (container.isBitset())
+        return testBit(container.bits, low);
+
+    return std::binary_search(container.array.constBegin(), container.array.constEnd(), low);
+}
+
+void CompressedBitmap::clear() {
+    m_containers.clear();
+}
+
+int CompressedBitmap::cardinality() const {
+    int total = 0;
+    for (const Container& container : m_containers)
+        total += container.cardinality;
+    return total;
+}
+
+bool CompressedBitmap::isEmpty() const {
+    return m_containers.isEmpty();
+}
+
+void CompressedBitmap::toBitset(Container& container) {
+    if (container.isBitset())
+        return;
+
+    container.bits.fill(0, BitsetWords);
+    for (quint16 low : container.array)
+        container.bits[low >> 6] |= Q_UINT64_C(1) << (low & 63);
+    container.array.clear();
+    container.array.squeeze();
+}
+
+void CompressedBitmap::normalize(Container& container) {
+    if (container.isBitset() && container.cardinality <= ArrayLimit) {
+        QVector<quint16> array;
+        array.reserve(container.cardinality);
+        for (int w = 0; w < BitsetWords; w++) {
+            quint64 word = container.bits.at(w);
+            while (word) {
+                array.append(static_cast<quint16>(w * 64 + qCountTrailingZeroBits(word)));
+                word &= word - 1;
+            }
+        }
+        container.bits.clear();
+        container.bits.squeeze();
+        container.array = array;
+    } else if (!container.isBitset() && container.cardinality > ArrayLimit) {
+        toBitset(container);
+    }
+}
+
+CompressedBitmap::Container CompressedBitmap::intersect(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+
+    if (a.isBitset() && b.isBitset()) {
+        result.bits.resize(BitsetWords);
+        for (int w = 0; w < BitsetWords; w++) {
+            result.bits[w] = a.bits.at(w) & b.bits.at(w);
+            result.cardinality += qPopulationCount(result.bits.at(w));
+        }
+    } else if (a.isBitset() || b.isBitset()) {
+        const Container& array = a.isBitset() ? b : a;
+        const Container& bitset = a.isBitset() ? a : b;
+        for (quint16 low : array.array) {
+            if (testBit(bitset.bits, low))
+                result.array.append(low);
+        }
+        result.cardinality = result.array.size();
+    } else {
+        std::set_intersection(a.array.constBegin(), a.array.constEnd(), b.array.constBegin(), b.array.constEnd(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    }
+
+    normalize(result);
+    return result;
+}
+
+CompressedBitmap::Container CompressedBitmap::unite(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+
+    if (a.isBitset() || b.isBitset()) {
+        result.bits = a.isBitset() ? a.bits : b.bits;
+        const Container& other = a.isBitset() ? b : a;
+
+        if (other.isBitset()) {
+            for (int w = 0; w < BitsetWords; w++)
+                result.bits[w] |= other.bits.at(w);
+        } else {
+            for (quint16 low : other.array)
+                result.bits[low >> 6] |= Q_UINT64_C(1) << (low & 63);
+        }
+
+        for (quint64 word : result.bits)
+            result.cardinality += qPopulationCount(word);
+    } else {
+        result.array.reserve(a.array.size() + b.array.size());
+        std::set_union(a.array.constBegin(), a.array.constEnd(), b.array.constBegin(), b.array.constEnd(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    }
+
+    normalize(result);
+    return result;
+}
+
+CompressedBitmap::Container CompressedBitmap::subtract(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+
+    if (a.isBitset()) {
+        result.bits = a.bits;
+
+        if (b.isBitset()) {
+            for (int w = 0; w < BitsetWords; w++)
+                result.bits[w] &= ~b.bits.at(w);
+        } else {
+            for (quint16 low : b.array)
+                result.bits[low >> 6] &= ~(Q_UINT64_C(1) << (low & 63));
+        }
+
+        for (quint64 word : result.bits)
+            result.cardinality += qPopulationCount(word);
+    } else if (b.isBitset()) {
+        for (quint16 low : a.array) {
+            if (!testBit(b.bits, low))
+                result.array.append(low);
+        }
+        result.cardinality = result.array.size();
+    } else {
+        std::set_difference(a.array.constBegin(), a.array.constEnd(), b.array.constBegin(), b.array.constEnd(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    }
+
+    normalize(result);
+    return result;
+}
+
+CompressedBitmap CompressedBitmap::operator&(const CompressedBitmap& other) const {
+    CompressedBitmap result;
+
+    int i = 0;
+    int j = 0;
+    while (i < m_containers.size() && j < other.m_containers.size()) {
+        const Container& a = m_containers.at(i);
+        const Container& b = other.m_containers.at(j);
+
+        if (a.key < b.key) {
+            i++;
+        } else if (b.key < a.key) {
+            j++;
+        } else {
+            Container c = intersect(a, b);
+            if (c.cardinality > 0)
+                result.m_containers.append(c);
+            i++;
+            j++;
+        }
+    }
+
+    return result;
+}
+
+CompressedBitmap CompressedBitmap::operator|(const CompressedBitmap& other) const {
+    CompressedBitmap result;
+
+    int i = 0;
+    int j = 0;
+    while (i < m_containers.size() || j < other.m_containers.size()) {
+        if (j >= other.m_containers.size() || (i < m_containers.size() && m_containers.at(i).key < other.m_containers.at(j).key)) {
+            result.m_containers.append(m_containers.at(i++));
+        } else if (i >= m_containers.size() || other.m_containers.at(j).key < m_containers.at(i).key) {
+            result.m_containers.append(other.m_containers.at(j++));
+        } else {
+            result.m_containers.append(unite(m_containers.at(i++), other.m_containers.at(j++)));
+        }
+    }
+
+    return result;
+}
+
+CompressedBitmap CompressedBitmap::andNot(const CompressedBitmap& other) const {
+    CompressedBitmap result;
+
+    int j = 0;
+    for (const Container& a : m_containers) {
+        while (j < other.m_containers.size() && other.m_containers.at(j).key < a.key)
+            j++;
+
+        if (j < other.m_containers.size() && other.m_containers.at(j).key == a.key) {
+            Container c = subtract(a, other.m_containers.at(j));
+            if (c.cardinality > 0)
+                result.m_containers.append(c);
+        } else {
+            result.m_containers.append(a);
+        }
+    }
+
+    return result;
+}
+
+bool CompressedBitmap::operator==(const CompressedBitmap& other) const {
+    if (m_containers.size() != other.m_containers.size())
+        return false;
+
+    for (int i = 0; i < m_containers.size(); i++) {
+        const Container& a = m_containers.at(i);
+        const Container& b = other.m_containers.at(i);
+        if (a.key != b.key || a.cardinality != b.cardinality || a.array != b.array || a.bits != b.bits)
+            return false;
+    }
+
+    return true;
+}
+
+void CompressedBitmap::forEach(const std::function<void(quint32)>& visit) const {
+    for (const Container& container : m_containers) {
+        const quint32 base = static_cast<quint32>(container.key) << 16;
+
+        if (container.isBitset()) {
+            for (int w = 0; w < BitsetWords; w++) {
+                quint64 word = container.bits.at(w);
+                while (word) {
+                    visit(base + w * 64 + qCountTrailingZeroBits(word));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            for (quint16 low : container.array)
+                visit(base + low);
+        }
+    }
+}
+
+QVector<quint32> CompressedBitmap::toVector() const {
+    QVector<quint32> values;
+    values.reserve(cardinality());
+    forEach([&values](quint32 value) {
+        values.append(value);
+    });
+    return values;
+}
@@ -0,0 +1,79 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef COMPRESSEDBITMAP_H
+#define COMPRESSEDBITMAP_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <functional>
+
+// Compressed set of 32 bit integers in the style of a roaring bitmap.
+// Values are split into chunks of 65536 by their high 16 bits; a chunk
+// holds a sorted array of its low bits while it is sparse and a 8 KB
+// bitset once it holds more than 4096 values, which keeps AND/OR/ANDNOT
+// proportional to the number of chunks rather than the number of values.
+class CompressedBitmap
+{
+public:
+    CompressedBitmap();
+
+    // All values in [0, count)
+    static CompressedBitmap range(quint32 count);
+
+    void add(quint32 value);
+    void remove(quint32 value);
+    bool contains(quint32 value) const;
+    void clear();
+
+    int cardinality() const;
+    bool isEmpty() const;
+
+    CompressedBitmap operator&(const CompressedBitmap& other) const;
+    CompressedBitmap operator|(const CompressedBitmap& other) const;
+    CompressedBitmap andNot(const CompressedBitmap& other) const;
+
+    bool operator==(const CompressedBitmap& other) const;
+    bool operator!=(const CompressedBitmap& other) const { return !(*this == other); }
+
+    // Visits the values in ascending order
+    void forEach(const std::function<void(quint32)>& visit) const;
+    QVector<quint32> toVector() const;
+
+private:
+    struct Container {
+        quint16 key = 0;
+        int cardinality = 0;
+
+        // Exactly one of these is used
+        QVector<quint16> array;
+        QVector<quint64> bits;
+
+        bool isBitset() const { return !bits.isEmpty(); }
+    };
+
+    static const int ArrayLimit = 4096;
+    static const int BitsetWords = 1024;
+
+    int find(quint16 key) const;
+
+    static void toBitset(Container& container);
+    static void normalize(Container& container);
+
+    static Container intersect(const Container& a, const Container& b);
+    static Container unite(const Container& a, const Container& b);
+    static Container subtract(const Container& a, const Container& b);
+
+    QVector<Container> m_containers;
+};
+
+#endif // COMPRESSEDBITMAP_H
@@ -0,0 +1,110 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QQuickWindow>
+
+#include "FeatureFeed.h"
+
+FeatureFeed::FeatureFeed(QObject* parent /* = nullptr */):
+    QObject(parent)
+{
+}
+
+void FeatureFeed::add(const QString& id, const QString& sidc, double x, double y) {
+    FeatureUpdate update;
+    update.kind = FeatureUpdate::Add;
+    update.id = id;
+    update.sidc = sidc;
+    update.x = x;
+    update.y = y;
+    enqueue(update);
+}
+
+void FeatureFeed::update(const QString& id, double x, double y, const QString& sidc /* = QString() */) {
+    FeatureUpdate update;
+    update.kind = FeatureUpdate::Update;
+    update.id = id;
+    update.sidc = sidc;
+    update.x = x;
+    update.y = y;
+    enqueue(update);
+}
+
+void FeatureFeed::remove(const QString& id) {
+    FeatureUpdate update;
+    update.kind = FeatureUpdate::Remove;
+    update.id = id;
+    enqueue(update);
+}
+
+int FeatureFeed::pending() const {
+    return m_queue.size();
+}
+
+void FeatureFeed::setWindow(QQuickWindow* window) {
+    if (m_connection)
+        disconnect(m_connection);
+
+    m_window = window;
+    if (!window)
+        return;
+
+    // afterAnimating is emitted on the GUI thread before every frame
+    m_connection = connect(window, &QQuickWindow::afterAnimating, this, &FeatureFeed::drain);
+
+    if (m_queue.size() > 0)
+        requestFrame();
+}
+
+void FeatureFeed::setBatchSize(int batchSize) {
+    m_batchSize = qMax(1, batchSize);
+}
+
+int FeatureFeed::batchSize() const {
+    return m_batchSize;
+}
+
+void FeatureFeed::enqueue(const FeatureUpdate& update) {
+    m_queue.push(update);
+
+    // Only the first change after a drain asks for a frame; the window
+    // may only be touched on the GUI thread
+    if (m_scheduled.testAndSetOrdered(0, 1))
+        QMetaObject::invokeMethod(this, "requestFrame", Qt::QueuedConnection);
+}
+
+void FeatureFeed::drain() {
+    QVector<FeatureUpdate> updates;
+    updates.reserve(qMin(m_batchSize, m_queue.size()));
+
+    FeatureUpdate update;
+    while (updates.size() < m_batchSize && m_queue.tryPop(&update))
+        updates.append(update);
+
+    if (!updates.isEmpty())
+        emit updatesReady(updates);
+
+    // More to drain, or a push raced the reset of the flag
+    if (m_queue.size() > 0) {
+        requestFrame();
+        return;
+    }
+
+    m_scheduled.storeRelease(0);
+    if (m_queue.size() > 0 && m_scheduled.testAndSetOrdered(0, 1))
+        requestFrame();
+}
+
+void FeatureFeed::requestFrame() {
+    if (m_window)
+        m_window->update();
+}
@@ -0,0 +1,86 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef FEATUREFEED_H
+#define FEATUREFEED_H
+
+#include <QAtomicInt>
+#include <QMetaType>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+
+#include "MpscQueue.h"
+
+class QQuickWindow;
+
+// A change to a symbol identified by the producer
+struct FeatureUpdate {
+    enum Kind { Add, Update, Remove };
+
+    Kind kind = Add;
+    QString id;
+
+    // Empty on an update keeps the code
+    QString sidc;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+Q_DECLARE_METATYPE(FeatureUpdate)
+
+// Hands feature changes from any thread to the GUI thread, where the
+// features have to be created. Producers only push to a lock free queue;
+// the queue is drained once per frame, at most batchSize changes at a
+// time, so a flood of changes is spread over frames instead of blocking
+// rendering.
+class FeatureFeed : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FeatureFeed(QObject* parent = nullptr);
+
+    // Any thread, positions are in WGS 84
+    void add(const QString& id, const QString& sidc, double x, double y);
+    void update(const QString& id, double x, double y, const QString& sidc = QString());
+    void remove(const QString& id);
+
+    // Changes not yet drained
+    int pending() const;
+
+    // GUI thread
+    void setWindow(QQuickWindow* window);
+    void setBatchSize(int batchSize);
+    int batchSize() const;
+
+signals:
+    // Emitted on the GUI thread, in the order the changes were pushed
+    void updatesReady(const QVector<FeatureUpdate>& updates);
+
+private:
+    void enqueue(const FeatureUpdate& update);
+    void drain();
+    Q_INVOKABLE void requestFrame();
+
+    MpscQueue<FeatureUpdate> m_queue;
+
+    // Set while a frame is requested to drain the queue
+    QAtomicInt m_scheduled;
+
+    QPointer<QQuickWindow> m_window;
+    QMetaObject::Connection m_connection;
+    int m_batchSize = 256;
+};
+
+#endif // FEATUREFEED_H
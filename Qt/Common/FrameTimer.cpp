@@ -0,0 +1,144 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QQuickWindow>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cmath>
+
+#include "FrameTimer.h"
+
+FrameTimer::FrameTimer(QQuickWindow* window, QObject* parent /* = nullptr */):
+    QObject(parent),
+    m_window(window)
+{
+}
+
+FrameTimer::~FrameTimer()
+{
+    stop();
+}
+
+void FrameTimer::start()
+{
+    if (!m_window || isRunning())
+        return;
+
+    {
+        QMutexLocker lock(&m_mutex);
+        m_lastSwap = -1;
+        m_timer.start();
+    }
+
+    // Direct connection: the timestamp has to be taken on the render thread
+    m_connection = connect(m_window, &QQuickWindow::frameSwapped, this, [this]() {
+        onFrameSwapped();
+    }, Qt::DirectConnection);
+}
+
+void FrameTimer::stop()
+{
+    if (m_connection)
+        disconnect(m_connection);
+}
+
+void FrameTimer::reset()
+{
+    QMutexLocker lock(&m_mutex);
+    m_samples.clear();
+    m_lastSwap = -1;
+    m_next = 0;
+    m_frameCount = 0;
+}
+
+bool FrameTimer::isRunning() const
+{
+    return static_cast<bool>(m_connection);
+}
+
+void FrameTimer::setCapacity(int capacity)
+{
+    QMutexLocker lock(&m_mutex);
+    m_capacity = qMax(0, capacity);
+    m_samples.clear();
+    m_samples.reserve(m_capacity);
+    m_next = 0;
+}
+
+QVector<double> FrameTimer::samples() const
+{
+    QMutexLocker lock(&m_mutex);
+
+    if (m_capacity == 0 || m_samples.size() < m_capacity)
+        return m_samples;
+
+    // Unroll the ring buffer
+    QVector<double> ordered;
+    ordered.reserve(m_samples.size());
+    for (int i = 0; i < m_samples.size(); i++)
+        ordered.append(m_samples.at((m_next + i) % m_samples.size()));
+
+    return ordered;
+}
+
+int FrameTimer::frameCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_frameCount;
+}
+
+void FrameTimer::onFrameSwapped()
+{
+    QMutexLocker lock(&m_mutex);
+
+    const qint64 now = m_timer.nsecsElapsed();
+    if (m_lastSwap >= 0) {
+        const double ms = (now - m_lastSwap) / 1000000.0;
+
+        if (m_capacity == 0 || m_samples.size() < m_capacity) {
+            m_samples.append(ms);
+        } else {
+            m_samples[m_next] = ms;
+        }
+
+        if (m_capacity > 0)
+            m_next = (m_next + 1) % m_capacity;
+
+        m_frameCount++;
+    }
+    m_lastSwap = now;
+}
+
+double FrameTimer::percentile(QVector<double> samples, double p)
+{
+    if (samples.isEmpty())
+        return 0.0;
+
+    // Nearest-rank percentile; nth_element keeps this O(n)
+    const int rank = qBound(0, static_cast<int>(std::ceil(p / 100.0 * samples.size())) - 1, samples.size() - 1);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+
+    return samples.at(rank);
+}
+
+double FrameTimer::mean(const QVector<double>& samples)
+{
+    if (samples.isEmpty())
+        return 0.0;
+
+    double sum = 0.0;
+    for (double s : samples)
+        sum += s;
+
+    return sum / samples.size();
+}
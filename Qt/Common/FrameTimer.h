@@ -0,0 +1,65 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef FRAMETIMER_H
+#define FRAMETIMER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QVector>
+
+class QQuickWindow;
+
+// Records the time between swapped frames of a QQuickWindow.
+// frameSwapped is emitted on the render thread, so the samples are
+// taken there and guarded by a mutex.
+class FrameTimer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FrameTimer(QQuickWindow* window, QObject* parent = nullptr);
+    ~FrameTimer();
+
+    void start();
+    void stop();
+    void reset();
+
+    bool isRunning() const;
+
+    // Keep only the most recent samples (0 keeps everything)
+    void setCapacity(int capacity);
+
+    // Frame times in milliseconds, oldest first
+    QVector<double> samples() const;
+    int frameCount() const;
+
+    static double percentile(QVector<double> samples, double p);
+    static double mean(const QVector<double>& samples);
+
+private:
+    void onFrameSwapped();
+
+    QQuickWindow* m_window = nullptr;
+    QMetaObject::Connection m_connection;
+
+    mutable QMutex m_mutex;
+    QElapsedTimer m_timer;
+    QVector<double> m_samples;
+    qint64 m_lastSwap = -1;
+    int m_capacity = 0;
+    int m_next = 0;
+    int m_frameCount = 0;
+};
+
+#endif // FRAMETIMER_H
@@ -0,0 +1,122 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QPair>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "IntervalIndex.h"
+
+namespace {
+    // Range of sorted times in (from, to]
+    QPair<int, int> range(const QVector<qint64>& sorted, qint64 from, qint64 to) {
+        const int first = std::upper_bound(sorted.constBegin(), sorted.constEnd(), from) - sorted.constBegin();
+        const int last = std::upper_bound(sorted.constBegin(), sorted.constEnd(), to) - sorted.constBegin();
+        return qMakePair(first, last);
+    }
+
+    QVector<int> sortedBy(const QVector<qint64>& times, QVector<qint64>* sortedTimes) {
+        QVector<int> ordinals(times.size());
+        std::iota(ordinals.begin(), ordinals.end(), 0);
+        std::stable_sort(ordinals.begin(), ordinals.end(), [&times](int a, int b) {
+            return times.at(a) < times.at(b);
+        });
+
+        sortedTimes->resize(times.size());
+        for (int i = 0; i < ordinals.size(); i++)
+            (*sortedTimes)[i] = times.at(ordinals.at(i));
+
+        return ordinals;
+    }
+}
+
+IntervalIndex::IntervalIndex()
+{
+}
+
+void IntervalIndex::build(const QVector<qint64>& starts, const QVector<qint64>& ends) {
+    m_starts = starts;
+    m_ends = ends;
+    m_byStart = sortedBy(m_starts, &m_sortedStarts);
+    m_byEnd = sortedBy(m_ends, &m_sortedEnds);
+}
+
+void IntervalIndex::clear() {
+    m_starts.clear();
+    m_ends.clear();
+    m_byStart.clear();
+    m_byEnd.clear();
+    m_sortedStarts.clear();
+    m_sortedEnds.clear();
+}
+
+int IntervalIndex::size() const {
+    return m_starts.size();
+}
+
+qint64 IntervalIndex::minimum() const {
+    return m_sortedStarts.isEmpty() ? 0 : m_sortedStarts.first();
+}
+
+qint64 IntervalIndex::maximum() const {
+    return m_sortedEnds.isEmpty() ? 0 : m_sortedEnds.last();
+}
+
+void IntervalIndex::delta(qint64 from, qint64 to, QVector<int>* entered, QVector<int>* left) const {
+    entered->clear();
+    left->clear();
+    if (from == to)
+        return;
+
+    if (from < to) {
+        // Started after from and still running at to
+        const QPair<int, int> started = range(m_sortedStarts, from, to);
+        for (int i = started.first; i < started.second; i++) {
+            const int ordinal = m_byStart.at(i);
+            if (m_ends.at(ordinal) > to)
+                entered->append(ordinal);
+        }
+
+        // Ended by to and already running at from
+        const QPair<int, int> ended = range(m_sortedEnds, from, to);
+        for (int i = ended.first; i < ended.second; i++) {
+            const int ordinal = m_byEnd.at(i);
+            if (m_starts.at(ordinal) <= from)
+                left->append(ordinal);
+        }
+        return;
+    }
+
+    // Backwards the roles of the endpoints swap
+    const QPair<int, int> ended = range(m_sortedEnds, to, from);
+    for (int i = ended.first; i < ended.second; i++) {
+        const int ordinal = m_byEnd.at(i);
+        if (m_starts.at(ordinal) <= to)
+            entered->append(ordinal);
+    }
+
+    const QPair<int, int> started = range(m_sortedStarts, to, from);
+    for (int i = started.first; i < started.second; i++) {
+        const int ordinal = m_byStart.at(i);
+        if (m_ends.at(ordinal) > from)
+            left->append(ordinal);
+    }
+}
+
+QVector<int> IntervalIndex::active(qint64 time) const {
+    QVector<int> entered;
+    QVector<int> left;
+    delta(std::numeric_limits<qint64>::min(), time, &entered, &left);
+    return entered;
+}
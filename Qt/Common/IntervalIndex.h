@@ -0,0 +1,53 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef INTERVALINDEX_H
+#define INTERVALINDEX_H
+
+#include <QVector>
+#include <QtGlobal>
+
+// Half open validity intervals [start, end), sorted once by start and by
+// end. Moving from one time to another only visits the endpoints in
+// between, so stepping through time costs the size of the change, not
+// the number of intervals.
+class IntervalIndex
+{
+public:
+    IntervalIndex();
+
+    void build(const QVector<qint64>& starts, const QVector<qint64>& ends);
+    void clear();
+
+    int size() const;
+    qint64 minimum() const;
+    qint64 maximum() const;
+
+    // Intervals that become active and inactive moving from time from to
+    // time to, in either direction
+    void delta(qint64 from, qint64 to, QVector<int>* entered, QVector<int>* left) const;
+
+    // Intervals active at time
+    QVector<int> active(qint64 time) const;
+
+private:
+    QVector<qint64> m_starts;
+    QVector<qint64> m_ends;
+
+    // Ordinals in order of their start and end, with the sorted times
+    QVector<int> m_byStart;
+    QVector<int> m_byEnd;
+    QVector<qint64> m_sortedStarts;
+    QVector<qint64> m_sortedEnds;
+};
+
+#endif // INTERVALINDEX_H
@@ -0,0 +1,123 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QPair>
+
+#include <cmath>
+
+#include "LineGeneralizer.h"
+
+namespace {
+    const double MetersPerInch = 0.0254;
+    const double MetersPerDegree = 111320.0;
+
+    double squaredSegmentDistance(const QPointF& p, const QPointF& a, const QPointF& b) {
+        const double dx = b.x() - a.x();
+        const double dy = b.y() - a.y();
+        const double length = (dx * dx) + (dy * dy);
+
+        double t = 0.0;
+        if (length > 0.0)
+            t = qBound(0.0, (((p.x() - a.x()) * dx) + ((p.y() - a.y()) * dy)) / length, 1.0);
+
+        const double x = a.x() + (t * dx) - p.x();
+        const double y = a.y() + (t * dy) - p.y();
+        return (x * x) + (y * y);
+    }
+
+    // Marks the vertices to keep between first and last, with a stack
+    // instead of recursion so long lines cannot overflow it
+    void mark(const QVector<QPointF>& points, int first, int last, double squaredTolerance, QVector<bool>* keep) {
+        QVector<QPair<int, int>> stack;
+        stack.append(qMakePair(first, last));
+
+        while (!stack.isEmpty()) {
+            const QPair<int, int> span = stack.takeLast();
+
+            double farthest = -1.0;
+            int index = -1;
+            for (int i = span.first + 1; i < span.second; i++) {
+                const double distance = squaredSegmentDistance(points.at(i), points.at(span.first), points.at(span.second));
+                if (distance > farthest) {
+                    farthest = distance;
+                    index = i;
+                }
+            }
+
+            if (index < 0 || farthest <= squaredTolerance)
+                continue;
+
+            (*keep)[index] = true;
+            stack.append(qMakePair(span.first, index));
+            stack.append(qMakePair(index, span.second));
+        }
+    }
+}
+
+QVector<QPointF> LineGeneralizer::simplify(const QVector<QPointF>& points, double tolerance, bool closed /* = false */) {
+    const int minimum = closed ? 4 : 2;
+    if (points.size() <= minimum || tolerance <= 0.0)
+        return points;
+
+    QVector<bool> keep(points.size(), false);
+    keep.first() = true;
+    keep.last() = true;
+
+    if (closed) {
+        // A ring starts and ends at the same vertex, split it at the
+        // vertex farthest from the start so both halves are lines
+        int split = 1;
+        double farthest = -1.0;
+        for (int i = 1; i < points.size() - 1; i++) {
+            const double dx = points.at(i).x() - points.first().x();
+            const double dy = points.at(i).y() - points.first().y();
+            if ((dx * dx) + (dy * dy) > farthest) {
+                farthest = (dx * dx) + (dy * dy);
+                split = i;
+            }
+        }
+
+        keep[split] = true;
+        mark(points, 0, split, tolerance * tolerance, &keep);
+        mark(points, split, points.size() - 1, tolerance * tolerance, &keep);
+    }
+    else {
+        mark(points, 0, points.size() - 1, tolerance * tolerance, &keep);
+    }
+
+    QVector<QPointF> result;
+    for (int i = 0; i < points.size(); i++) {
+        if (keep.at(i))
+            result.append(points.at(i));
+    }
+
+    // A ring simplified to a line keeps its original shape
+    return result.size() < minimum ? points : result;
+}
+
+double LineGeneralizer::tolerance(double scale, double pixels, double dpi /* = 96.0 */) {
+    return (pixels * scale * MetersPerInch / dpi) / MetersPerDegree;
+}
+
+QVector<QVector<QPointF>> LineGeneralizer::levels(const QVector<QPointF>& points, const ScaleBands& bands, double pixels, bool closed /* = false */) {
+    QVector<QVector<QPointF>> result;
+    result.reserve(bands.count());
+
+    // Each level simplifies the previous one, the tolerances only grow
+    QVector<QPointF> level = points;
+    for (int band = 0; band < bands.count(); band++) {
+        level = simplify(level, tolerance(bands.lowerScale(band), pixels), closed);
+        result.append(level);
+    }
+
+    return result;
+}
@@ -0,0 +1,37 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef LINEGENERALIZER_H
+#define LINEGENERALIZER_H
+
+#include <QPointF>
+#include <QVector>
+
+#include "ScaleBands.h"
+
+// Douglas-Peucker simplification of the vertices of lines and rings,
+// precomputed per scale band so a zoom only swaps geometries.
+class LineGeneralizer
+{
+public:
+    // Keeps the vertices further than tolerance from the simplified line;
+    // a closed ring keeps at least four vertices, first and last equal
+    static QVector<QPointF> simplify(const QVector<QPointF>& points, double tolerance, bool closed = false);
+
+    // WGS 84 degrees covered by pixels at a map scale, near the equator
+    static double tolerance(double scale, double pixels, double dpi = 96.0);
+
+    // One simplification per band, at the largest scale of the band
+    static QVector<QVector<QPointF>> levels(const QVector<QPointF>& points, const ScaleBands& bands, double pixels, bool closed = false);
+};
+
+#endif // LINEGENERALIZER_H
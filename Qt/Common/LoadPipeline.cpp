@@ -0,0 +1,66 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "LoadPipeline.h"
+
+LoadPipeline::LoadPipeline(QObject* parent /* = nullptr */):
+    QObject(parent)
+{
+}
+
+LoadPipeline::~LoadPipeline()
+{
+    cancel();
+}
+
+CancelToken LoadPipeline::token() const
+{
+    return m_token;
+}
+
+bool LoadPipeline::isCanceled() const
+{
+    return m_token.isCanceled();
+}
+
+void LoadPipeline::cancel()
+{
+    m_token.cancel();
+    m_pool.waitForDone();
+}
+
+void LoadPipeline::fail(const QString& stage, const QString& error)
+{
+    cancel();
+    emit failed(stage, error);
+}
+
+QFuture<void> LoadPipeline::start(const QString& stage, std::function<void()> work)
+{
+    const CancelToken token = m_token;
+    const int allocationStage = AllocationProfiler::stage(stage);
+
+    // The destructor waits for the pool, so this outlives the worker
+    return QtConcurrent::run(&m_pool, [this, token, stage, work, allocationStage]() {
+        if (token.isCanceled())
+            return;
+
+        AllocationScope scope(allocationStage);
+
+        QElapsedTimer elapsed;
+        elapsed.start();
+        work();
+
+        if (!token.isCanceled())
+            emit stageFinished(stage, elapsed.elapsed());
+    });
+}
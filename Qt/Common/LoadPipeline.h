@@ -0,0 +1,212 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef LOADPIPELINE_H
+#define LOADPIPELINE_H
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <QObject>
+#include <QQueue>
+#include <QThreadPool>
+#include <QTimer>
+#include <QWaitCondition>
+#include <QtConcurrent>
+
+#include <functional>
+#include <memory>
+
+#include "AllocationProfiler.h"
+
+// Shared cancellation flag, copied into every worker of a pipeline
+class CancelToken
+{
+public:
+    CancelToken() : m_canceled(std::make_shared<QAtomicInt>(0)) {}
+
+    void cancel() { m_canceled->storeRelease(1); }
+    bool isCanceled() const { return m_canceled->loadAcquire() != 0; }
+
+private:
+    std::shared_ptr<QAtomicInt> m_canceled;
+};
+
+// Queue between two stages. A producer blocks while the queue is full, so
+// a fast stage cannot run ahead of a slow one.
+template <typename T>
+class BoundedQueue
+{
+public:
+    BoundedQueue(int capacity, const CancelToken& token) :
+        m_capacity(qMax(1, capacity)),
+        m_token(token) {}
+
+    // Blocks while full, false once canceled
+    bool push(const T& value) {
+        QMutexLocker lock(&m_mutex);
+        while (m_items.size() >= m_capacity && !m_token.isCanceled())
+            m_notFull.wait(&m_mutex, 50);
+
+        if (m_token.isCanceled())
+            return false;
+
+        m_items.enqueue(value);
+        return true;
+    }
+
+    bool tryPop(T* value) {
+        QMutexLocker lock(&m_mutex);
+        if (m_items.isEmpty())
+            return false;
+
+        *value = m_items.dequeue();
+        m_notFull.wakeOne();
+        return true;
+    }
+
+    // No more items will be pushed
+    void close() {
+        QMutexLocker lock(&m_mutex);
+        m_closed = true;
+    }
+
+    bool isDrained() const {
+        QMutexLocker lock(&m_mutex);
+        return m_closed && m_items.isEmpty();
+    }
+
+private:
+    mutable QMutex m_mutex;
+    QWaitCondition m_notFull;
+    QQueue<T> m_items;
+    int m_capacity;
+    bool m_closed = false;
+    CancelToken m_token;
+};
+
+// Runs the stages of a load as a task graph: worker stages run on a pool
+// of their own, their continuations and queue consumers run on the thread
+// of the pipeline and are dropped once it is canceled. Canceling waits for
+// the workers, so nothing they capture outlives the owner.
+class LoadPipeline : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit LoadPipeline(QObject* parent = nullptr);
+    ~LoadPipeline();
+
+    CancelToken token() const;
+    bool isCanceled() const;
+
+    // Stops every stage and waits for the running workers
+    void cancel();
+
+    // Cancels the remaining stages after a stage failed
+    void fail(const QString& stage, const QString& error);
+
+    // Runs work on the pool, then continues with its result on this thread
+    template <typename T>
+    QFuture<T> run(const QString& stage, std::function<T()> work, std::function<void(const T&)> then);
+
+    // Runs a producer on the pool that feeds a queue
+    QFuture<void> start(const QString& stage, std::function<void()> work);
+
+    // Consumes a queue on this thread, for at most budgetMs per event loop
+    // turn, then calls done once the queue is closed and empty
+    template <typename T>
+    void drain(const QString& stage, std::shared_ptr<BoundedQueue<T>> queue, std::function<void(const T&)> consume, std::function<void()> done, int budgetMs = 8);
+
+    // Interval of a drain while its queue is empty but still open
+    static const int DrainIdleMs = 4;
+
+signals:
+    void stageFinished(const QString& stage, qint64 elapsedMs);
+    void failed(const QString& stage, const QString& error);
+
+private:
+    QThreadPool m_pool;
+    CancelToken m_token;
+};
+
+template <typename T>
+QFuture<T> LoadPipeline::run(const QString& stage, std::function<T()> work, std::function<void(const T&)> then) {
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    const CancelToken token = m_token;
+    const int allocationStage = AllocationProfiler::stage(stage);
+    QFuture<T> future = QtConcurrent::run(&m_pool, [token, work, allocationStage]() {
+        AllocationScope scope(allocationStage);
+        return token.isCanceled() ? T() : work();
+    });
+
+    QFutureWatcher<T>* watcher = new QFutureWatcher<T>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, stage, elapsed, then]() {
+        watcher->deleteLater();
+        if (isCanceled())
+            return;
+
+        emit stageFinished(stage, elapsed.elapsed());
+        then(watcher->result());
+    });
+    watcher->setFuture(future);
+
+    return future;
+}
+
+template <typename T>
+void LoadPipeline::drain(const QString& stage, std::shared_ptr<BoundedQueue<T>> queue, std::function<void(const T&)> consume, std::function<void()> done, int budgetMs /* = 8 */) {
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    QTimer* timer = new QTimer(this);
+    timer->setInterval(0);
+
+    const int allocationStage = AllocationProfiler::stage(stage);
+    connect(timer, &QTimer::timeout, this, [this, timer, queue, stage, elapsed, consume, done, budgetMs, allocationStage]() {
+        if (isCanceled()) {
+            timer->deleteLater();
+            return;
+        }
+
+        QElapsedTimer turn;
+        turn.start();
+
+        T value;
+        int consumed = 0;
+        {
+            AllocationScope scope(allocationStage);
+            while (turn.elapsed() < budgetMs && queue->tryPop(&value)) {
+                consume(value);
+                consumed++;
+            }
+        }
+
+        if (queue->isDrained()) {
+            timer->deleteLater();
+            emit stageFinished(stage, elapsed.elapsed());
+            done();
+            return;
+        }
+
+        // Poll again at once while the producer keeps up, back off while
+        // it has nothing queued so the GUI thread does not spin
+        timer->setInterval(consumed > 0 ? 0 : DrainIdleMs);
+    });
+
+    timer->start();
+}
+
+#endif // LOADPIPELINE_H
@@ -0,0 +1,87 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <QAtomicInt>
+#include <QAtomicPointer>
+
+#include <utility>
+
+// Unbounded multiple producer, single consumer queue of linked nodes.
+// A push is one atomic exchange and never waits for other producers or
+// the consumer. A push that has exchanged the head but not yet linked its
+// node hides the nodes after it from the consumer until it finishes, so
+// tryPop may briefly report an empty queue.
+template <typename T>
+class MpscQueue
+{
+public:
+    MpscQueue():
+        m_head(new Node()),
+        m_tail(m_head.load())
+    {
+    }
+
+    ~MpscQueue() {
+        T value;
+        while (tryPop(&value)) {}
+        delete m_tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Any thread
+    void push(const T& value) {
+        Node* node = new Node(value);
+        Node* previous = m_head.fetchAndStoreAcquireRelease(node);
+        previous->next.storeRelease(node);
+        m_size.fetchAndAddRelaxed(1);
+    }
+
+    // Consumer thread only
+    bool tryPop(T* value) {
+        Node* tail = m_tail;
+        Node* next = tail->next.loadAcquire();
+        if (!next)
+            return false;
+
+        *value = std::move(next->value);
+        m_tail = next;
+        delete tail;
+
+        m_size.fetchAndAddRelaxed(-1);
+        return true;
+    }
+
+    // Approximate while producers are pushing
+    int size() const {
+        return m_size.load();
+    }
+
+private:
+    struct Node {
+        Node() {}
+        explicit Node(const T& v): value(v) {}
+
+        QAtomicPointer<Node> next;
+        T value;
+    };
+
+    QAtomicPointer<Node> m_head;
+    Node* m_tail;
+    QAtomicInt m_size;
+};
+
+#endif // MPSCQUEUE_H
@@ -0,0 +1,78 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "ProcessMemory.h"
+
+#if defined(Q_OS_WIN)
+#include <Windows.h>
+#include <Psapi.h>
+#elif defined(Q_OS_MAC) || defined(Q_OS_IOS)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#elif defined(Q_OS_UNIX)
+#include <QFile>
+#include <QByteArray>
+#include <QList>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+qint64 ProcessMemory::residentBytes() {
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<qint64>(counters.WorkingSetSize);
+    return -1;
+#elif defined(Q_OS_MAC) || defined(Q_OS_IOS)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) == KERN_SUCCESS)
+        return static_cast<qint64>(info.resident_size);
+    return -1;
+#elif defined(Q_OS_UNIX)
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly))
+        return -1;
+
+    // size resident shared text lib data dt, in pages
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2)
+        return -1;
+
+    return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
+qint64 ProcessMemory::peakResidentBytes() {
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<qint64>(counters.PeakWorkingSetSize);
+    return -1;
+#elif defined(Q_OS_MAC) || defined(Q_OS_IOS)
+    // ru_maxrss is in bytes on Darwin
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return static_cast<qint64>(usage.ru_maxrss);
+    return -1;
+#elif defined(Q_OS_UNIX)
+    // ru_maxrss is in kilobytes on Linux
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return static_cast<qint64>(usage.ru_maxrss) * 1024;
+    return -1;
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,26 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef PROCESSMEMORY_H
+#define PROCESSMEMORY_H
+
+#include <QtGlobal>
+
+namespace ProcessMemory {
+    // Resident set size of this process in bytes, or -1 if unknown
+    qint64 residentBytes();
+
+    // Peak resident set size of this process in bytes, or -1 if unknown
+    qint64 peakResidentBytes();
+}
+
+#endif // PROCESSMEMORY_H
@@ -0,0 +1,243 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef QUADTREE_H
+#define QUADTREE_H
+
+#include <QVector>
+#include <QtGlobal>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+// Axis aligned bounds in map units
+struct QuadBounds {
+    double xMin = 0.0;
+    double yMin = 0.0;
+    double xMax = 0.0;
+    double yMax = 0.0;
+
+    QuadBounds() {}
+    QuadBounds(double x0, double y0, double x1, double y1): xMin(x0), yMin(y0), xMax(x1), yMax(y1) {}
+
+    bool contains(double x, double y) const {
+        return x >= xMin && x <= xMax && y >= yMin && y <= yMax;
+    }
+
+    bool intersects(const QuadBounds& other) const {
+        return other.xMin <= xMax && other.xMax >= xMin && other.yMin <= yMax && other.yMax >= yMin;
+    }
+
+    double width() const { return xMax - xMin; }
+    double height() const { return yMax - yMin; }
+};
+
+// Point region quadtree. Leaves split once they hold more than
+// BucketSize items, and the root grows to take in points outside of it,
+// so the layout does not have to be known up front.
+template <typename T>
+class QuadTree
+{
+public:
+    struct Item {
+        double x;
+        double y;
+        T value;
+    };
+
+    explicit QuadTree(const QuadBounds& bounds = QuadBounds(0.0, 0.0, 1.0, 1.0)):
+        m_root(new Node(bounds))
+    {
+    }
+
+    void insert(double x, double y, const T& value) {
+        if (!qIsFinite(x) || !qIsFinite(y))
+            return;
+
+        while (!m_root->bounds.contains(x, y))
+            grow(x, y);
+
+        Item item = { x, y, value };
+        insert(m_root.get(), item, 0);
+        m_size++;
+    }
+
+    bool remove(double x, double y, const T& value) {
+        if (!remove(m_root.get(), x, y, value))
+            return false;
+
+        m_size--;
+        return true;
+    }
+
+    void clear() {
+        m_root.reset(new Node(m_root->bounds));
+        m_size = 0;
+    }
+
+    int size() const {
+        return m_size;
+    }
+
+    const QuadBounds& bounds() const {
+        return m_root->bounds;
+    }
+
+    // Calls visit for every item inside the bounds
+    void query(const QuadBounds& bounds, const std::function<void(const Item&)>& visit) const {
+        query(m_root.get(), bounds, visit);
+    }
+
+    // Nearest item within radius, or nullptr
+    const Item* nearest(double x, double y, double radius, const std::function<bool(const Item&)>& accept = nullptr) const {
+        const Item* best = nullptr;
+        double bestDistance = radius * radius;
+
+        query(QuadBounds(x - radius, y - radius, x + radius, y + radius), [&](const Item& item) {
+            const double dx = item.x - x;
+            const double dy = item.y - y;
+            const double distance = dx * dx + dy * dy;
+
+            if (distance <= bestDistance && (!accept || accept(item))) {
+                bestDistance = distance;
+                best = &item;
+            }
+        });
+
+        return best;
+    }
+
+private:
+    static const int BucketSize = 16;
+    static const int MaxDepth = 24;
+
+    struct Node {
+        explicit Node(const QuadBounds& b):
+            bounds(b),
+            cx((b.xMin + b.xMax) * 0.5),
+            cy((b.yMin + b.yMax) * 0.5)
+        {
+        }
+
+        QuadBounds bounds;
+        double cx;
+        double cy;
+
+        // Points on a split line go east or north, except in a grown root
+        // whose west or south quadrant is the old root and holds them
+        bool westTakesLine = false;
+        bool southTakesLine = false;
+
+        QVector<Item> items;
+        std::unique_ptr<Node> children[4];
+
+        bool isLeaf() const { return !children[0]; }
+
+        int quadrant(double x, double y) const {
+            const bool east = westTakesLine ? x > cx : x >= cx;
+            const bool north = southTakesLine ? y > cy : y >= cy;
+            return (east ? 1 : 0) + (north ? 2 : 0);
+        }
+
+        QuadBounds childBounds(int q) const {
+            return QuadBounds(q & 1 ? cx : bounds.xMin, q & 2 ? cy : bounds.yMin,
+                              q & 1 ? bounds.xMax : cx, q & 2 ? bounds.yMax : cy);
+        }
+    };
+
+    void insert(Node* node, const Item& item, int depth) {
+        while (!node->isLeaf()) {
+            node = node->children[node->quadrant(item.x, item.y)].get();
+            depth++;
+        }
+
+        node->items.append(item);
+
+        if (node->items.size() > BucketSize && depth < MaxDepth)
+            split(node, depth);
+    }
+
+    void split(Node* node, int depth) {
+        for (int q = 0; q < 4; q++)
+            node->children[q].reset(new Node(node->childBounds(q)));
+
+        QVector<Item> items;
+        items.swap(node->items);
+
+        for (const Item& item : items)
+            insert(node->children[node->quadrant(item.x, item.y)].get(), item, depth + 1);
+    }
+
+    // Double the root towards a point outside of it
+    void grow(double x, double y) {
+        const QuadBounds& b = m_root->bounds;
+        const double w = qMax(b.width(), 1e-9);
+        const double h = qMax(b.height(), 1e-9);
+
+        const bool west = x < b.xMin;
+        const bool south = y < b.yMin;
+
+        QuadBounds grown(west ? b.xMin - w : b.xMin, south ? b.yMin - h : b.yMin,
+                         west ? b.xMax : b.xMax + w, south ? b.yMax : b.yMax + h);
+
+        // Split exactly on the old edges so the old root stays a quadrant
+        std::unique_ptr<Node> root(new Node(grown));
+        root->cx = west ? b.xMin : b.xMax;
+        root->cy = south ? b.yMin : b.yMax;
+        root->westTakesLine = !west;
+        root->southTakesLine = !south;
+        for (int q = 0; q < 4; q++)
+            root->children[q].reset(new Node(root->childBounds(q)));
+
+        // The old root becomes the quadrant it covers
+        const int q = (west ? 1 : 0) + (south ? 2 : 0);
+        root->children[q] = std::move(m_root);
+        m_root = std::move(root);
+    }
+
+    bool remove(Node* node, double x, double y, const T& value) {
+        while (!node->isLeaf())
+            node = node->children[node->quadrant(x, y)].get();
+
+        for (int i = 0; i < node->items.size(); i++) {
+            const Item& item = node->items.at(i);
+            if (item.x == x && item.y == y && item.value == value) {
+                node->items.remove(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void query(const Node* node, const QuadBounds& bounds, const std::function<void(const Item&)>& visit) const {
+        if (!node->bounds.intersects(bounds))
+            return;
+
+        if (node->isLeaf()) {
+            for (const Item& item : node->items) {
+                if (bounds.contains(item.x, item.y))
+                    visit(item);
+            }
+            return;
+        }
+
+        for (int q = 0; q < 4; q++)
+            query(node->children[q].get(), bounds, visit);
+    }
+
+    std::unique_ptr<Node> m_root;
+    int m_size = 0;
+};
+
+#endif // QUADTREE_H
@@ -0,0 +1,103 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QQuickWindow>
+
+#include "FrameTimer.h"
+#include "RenderTelemetry.h"
+
+namespace {
+    // Percentiles over the last few seconds of frames
+    const int SampleCapacity = 240;
+
+    // Refresh the overlay twice a second, not every frame
+    const int RefreshInterval = 500;
+}
+
+RenderTelemetry::RenderTelemetry(QObject* parent /* = nullptr */):
+    QObject(parent)
+{
+    m_refreshTimer.setInterval(RefreshInterval);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &RenderTelemetry::refresh);
+}
+
+RenderTelemetry::~RenderTelemetry()
+{
+}
+
+void RenderTelemetry::setWindow(QQuickWindow* window) {
+    if (m_window == window)
+        return;
+
+    delete m_frameTimer;
+    m_frameTimer = nullptr;
+    m_window = window;
+
+    if (!m_window)
+        return;
+
+    m_frameTimer = new FrameTimer(m_window, this);
+    m_frameTimer->setCapacity(SampleCapacity);
+
+    if (m_enabled)
+        m_frameTimer->start();
+}
+
+void RenderTelemetry::setCounterSource(std::function<TelemetryCounters()> source) {
+    m_counterSource = source;
+}
+
+bool RenderTelemetry::isEnabled() const {
+    return m_enabled;
+}
+
+void RenderTelemetry::setEnabled(bool enabled) {
+    if (m_enabled == enabled)
+        return;
+
+    m_enabled = enabled;
+
+    if (m_enabled) {
+        if (m_frameTimer) {
+            m_frameTimer->reset();
+            m_frameTimer->start();
+        }
+        m_lastFrameCount = 0;
+        m_refreshTimer.start();
+    } else {
+        if (m_frameTimer)
+            m_frameTimer->stop();
+        m_refreshTimer.stop();
+    }
+
+    emit enabledChanged();
+}
+
+void RenderTelemetry::refresh() {
+    if (m_frameTimer) {
+        const QVector<double> samples = m_frameTimer->samples();
+        const int frameCount = m_frameTimer->frameCount();
+
+        // The scene graph only renders on demand, so an idle map reports 0 fps
+        m_fps = (frameCount - m_lastFrameCount) * 1000.0 / RefreshInterval;
+        m_lastFrameCount = frameCount;
+
+        m_p50 = FrameTimer::percentile(samples, 50);
+        m_p95 = FrameTimer::percentile(samples, 95);
+        m_p99 = FrameTimer::percentile(samples, 99);
+    }
+
+    if (m_counterSource)
+        m_counters = m_counterSource();
+
+    emit updated();
+}
@@ -0,0 +1,96 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef RENDERTELEMETRY_H
+#define RENDERTELEMETRY_H
+
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <functional>
+
+class QQuickWindow;
+class FrameTimer;
+
+// Counters reported by the app alongside the frame times
+struct TelemetryCounters {
+    int featureCount = 0;
+    int uniqueValueCount = 0;
+    int symbolCacheHits = 0;
+    int pendingIngest = 0;
+    double residentMegabytes = 0.0;
+    int evictions = 0;
+};
+
+// Frame rate, frame time percentiles and app counters for the QML
+// telemetry overlay. Nothing is sampled while the overlay is disabled.
+class RenderTelemetry : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(double fps READ fps NOTIFY updated)
+    Q_PROPERTY(double frameTimeP50 READ frameTimeP50 NOTIFY updated)
+    Q_PROPERTY(double frameTimeP95 READ frameTimeP95 NOTIFY updated)
+    Q_PROPERTY(double frameTimeP99 READ frameTimeP99 NOTIFY updated)
+    Q_PROPERTY(int featureCount READ featureCount NOTIFY updated)
+    Q_PROPERTY(int uniqueValueCount READ uniqueValueCount NOTIFY updated)
+    Q_PROPERTY(int symbolCacheHits READ symbolCacheHits NOTIFY updated)
+    Q_PROPERTY(int pendingIngest READ pendingIngest NOTIFY updated)
+    Q_PROPERTY(double residentMegabytes READ residentMegabytes NOTIFY updated)
+    Q_PROPERTY(int evictions READ evictions NOTIFY updated)
+
+public:
+    explicit RenderTelemetry(QObject* parent = nullptr);
+    ~RenderTelemetry();
+
+    void setWindow(QQuickWindow* window);
+    void setCounterSource(std::function<TelemetryCounters()> source);
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    double fps() const { return m_fps; }
+    double frameTimeP50() const { return m_p50; }
+    double frameTimeP95() const { return m_p95; }
+    double frameTimeP99() const { return m_p99; }
+
+    int featureCount() const { return m_counters.featureCount; }
+    int uniqueValueCount() const { return m_counters.uniqueValueCount; }
+    int symbolCacheHits() const { return m_counters.symbolCacheHits; }
+    int pendingIngest() const { return m_counters.pendingIngest; }
+    double residentMegabytes() const { return m_counters.residentMegabytes; }
+    int evictions() const { return m_counters.evictions; }
+
+signals:
+    void enabledChanged();
+    void updated();
+
+private:
+    void refresh();
+
+    QPointer<QQuickWindow> m_window;
+    FrameTimer* m_frameTimer = nullptr;
+    QTimer m_refreshTimer;
+    std::function<TelemetryCounters()> m_counterSource;
+
+    bool m_enabled = false;
+    int m_lastFrameCount = 0;
+
+    double m_fps = 0.0;
+    double m_p50 = 0.0;
+    double m_p95 = 0.0;
+    double m_p99 = 0.0;
+    TelemetryCounters m_counters;
+};
+
+#endif // RENDERTELEMETRY_H
@@ -0,0 +1,98 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "ResidencyLru.h"
+
+ResidencyLru::ResidencyLru(qint64 budgetBytes /* = 0 */):
+    m_budget(qMax<qint64>(0, budgetBytes))
+{
+}
+
+void ResidencyLru::setBudget(qint64 budgetBytes) {
+    m_budget = qMax<qint64>(0, budgetBytes);
+}
+
+qint64 ResidencyLru::budget() const {
+    return m_budget;
+}
+
+bool ResidencyLru::isResident(int key) const {
+    return m_entries.contains(key);
+}
+
+bool ResidencyLru::fits(qint64 bytes) const {
+    return m_budget == 0 || m_resident + bytes <= m_budget;
+}
+
+bool ResidencyLru::touch(int key) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    m_order.splice(m_order.begin(), m_order, it->position);
+    return true;
+}
+
+void ResidencyLru::insert(int key, qint64 bytes) {
+    if (touch(key))
+        return;
+
+    m_order.push_front(key);
+
+    Entry entry;
+    entry.bytes = bytes;
+    entry.position = m_order.begin();
+    m_entries.insert(key, entry);
+
+    m_resident += bytes;
+    m_materializations++;
+}
+
+void ResidencyLru::clear() {
+    m_order.clear();
+    m_entries.clear();
+    m_resident = 0;
+}
+
+QList<int> ResidencyLru::evict(const QSet<int>& pinned /* = QSet<int>() */) {
+    QList<int> evicted;
+    if (m_budget == 0)
+        return evicted;
+
+    // From the least recently used end, stepping over the pinned keys
+    auto it = m_order.end();
+    while (m_resident > m_budget && it != m_order.begin()) {
+        --it;
+        if (pinned.contains(*it))
+            continue;
+
+        const int key = *it;
+        m_resident -= m_entries.value(key).bytes;
+        m_entries.remove(key);
+        it = m_order.erase(it);
+
+        evicted.append(key);
+        m_evictions++;
+    }
+
+    return evicted;
+}
+
+ResidencyStats ResidencyLru::stats() const {
+    ResidencyStats stats;
+    stats.budgetBytes = m_budget;
+    stats.residentBytes = m_resident;
+    stats.residentCount = m_entries.size();
+    stats.materializations = m_materializations;
+    stats.evictions = m_evictions;
+    return stats;
+}
@@ -0,0 +1,76 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef RESIDENCYLRU_H
+#define RESIDENCYLRU_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+
+#include <list>
+
+struct ResidencyStats {
+    qint64 budgetBytes = 0;
+    qint64 residentBytes = 0;
+    int residentCount = 0;
+    int materializations = 0;
+    int evictions = 0;
+};
+
+// Resident items, cells of the catalog for example, with their cost in
+// bytes in least recently used order. The owner materializes and evicts
+// the items; this only decides which ones to evict to stay within the
+// budget.
+class ResidencyLru
+{
+public:
+    // A budget of 0 never evicts
+    explicit ResidencyLru(qint64 budgetBytes = 0);
+
+    void setBudget(qint64 budgetBytes);
+    qint64 budget() const;
+
+    bool isResident(int key) const;
+
+    // Whether bytes more would stay within the budget
+    bool fits(qint64 bytes) const;
+
+    // Makes key the most recently used, returns false if not resident
+    bool touch(int key);
+
+    void insert(int key, qint64 bytes);
+    void clear();
+
+    // Removes and returns the least recently used keys until the rest
+    // fits, never any of pinned
+    QList<int> evict(const QSet<int>& pinned = QSet<int>());
+
+    ResidencyStats stats() const;
+
+private:
+    struct Entry {
+        qint64 bytes;
+        std::list<int>::iterator position;
+    };
+
+    qint64 m_budget;
+    qint64 m_resident = 0;
+    int m_materializations = 0;
+    int m_evictions = 0;
+
+    // Most recently used first
+    std::list<int> m_order;
+    QHash<int, Entry> m_entries;
+};
+
+#endif // RESIDENCYLRU_H
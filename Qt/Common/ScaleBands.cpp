@@ -0,0 +1,123 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QStringList>
+
+#include <algorithm>
+#include <cmath>
+
+#include "ScaleBands.h"
+
+namespace {
+    const char* const DefaultCurve = "1000:88,5000:64,20000:44,100000:28,500000:16";
+}
+
+ScaleBands::ScaleBands(double minScale /* = 1000.0 */, double maxScale /* = 2000000.0 */, int count /* = 16 */):
+    m_minScale(qMax(1.0, minScale)),
+    m_count(qMax(1, count))
+{
+    m_logRatio = std::log(qMax(maxScale, m_minScale * 2.0) / m_minScale) / m_count;
+}
+
+int ScaleBands::count() const {
+    return m_count;
+}
+
+int ScaleBands::bandForScale(double scale) const {
+    if (!(scale > m_minScale))
+        return 0;
+
+    return qMin(m_count - 1, static_cast<int>(std::log(scale / m_minScale) / m_logRatio));
+}
+
+double ScaleBands::lowerScale(int band) const {
+    return m_minScale * std::exp(m_logRatio * band);
+}
+
+double ScaleBands::upperScale(int band) const {
+    return m_minScale * std::exp(m_logRatio * (band + 1));
+}
+
+double ScaleBands::scale(int band) const {
+    return m_minScale * std::exp(m_logRatio * (band + 0.5));
+}
+
+SizeCurve::SizeCurve() {
+    parse(DefaultCurve);
+}
+
+bool SizeCurve::parse(const QString& spec, QString* errorMessage /* = nullptr */) {
+    QVector<QPair<double, double>> points;
+
+    for (const QString& entry : spec.split(',', QString::SkipEmptyParts)) {
+        const QStringList parts = entry.trimmed().split(':');
+
+        bool scaleOk = false;
+        bool sizeOk = false;
+        const double scale = parts.first().toDouble(&scaleOk);
+        const double size = parts.size() == 2 ? parts.at(1).toDouble(&sizeOk) : 0.0;
+
+        if (!scaleOk || !sizeOk || scale <= 0.0 || size <= 0.0) {
+            if (errorMessage)
+                *errorMessage = QString("Invalid size curve point: %1").arg(entry);
+            return false;
+        }
+
+        points.append(qMakePair(scale, size));
+    }
+
+    if (points.isEmpty()) {
+        if (errorMessage)
+            *errorMessage = QStringLiteral("The size curve has no points");
+        return false;
+    }
+
+    std::sort(points.begin(), points.end());
+    m_points = points;
+
+    return true;
+}
+
+QString SizeCurve::toString() const {
+    QStringList entries;
+    for (const QPair<double, double>& point : m_points)
+        entries.append(QString("%1:%2").arg(point.first).arg(point.second));
+
+    return entries.join(',');
+}
+
+double SizeCurve::sizeAt(double scale) const {
+    if (scale <= m_points.first().first)
+        return m_points.first().second;
+    if (scale >= m_points.last().first)
+        return m_points.last().second;
+
+    int upper = 1;
+    while (m_points.at(upper).first < scale)
+        upper++;
+
+    const QPair<double, double>& a = m_points.at(upper - 1);
+    const QPair<double, double>& b = m_points.at(upper);
+    if (b.first <= a.first)
+        return b.second;
+
+    const double t = std::log(scale / a.first) / std::log(b.first / a.first);
+    return a.second + t * (b.second - a.second);
+}
+
+QVector<int> SizeCurve::sizes(const ScaleBands& bands) const {
+    QVector<int> result(bands.count());
+    for (int band = 0; band < bands.count(); band++)
+        result[band] = qMax(1, qRound(sizeAt(bands.scale(band))));
+
+    return result;
+}
@@ -0,0 +1,64 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SCALEBANDS_H
+#define SCALEBANDS_H
+
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+// Map scales split into geometric bands, so the band of a scale is found
+// with one logarithm instead of a search.
+class ScaleBands
+{
+public:
+    ScaleBands(double minScale = 1000.0, double maxScale = 2000000.0, int count = 16);
+
+    int count() const;
+
+    // Band of a map scale, scales outside the range clamp to the end bands
+    int bandForScale(double scale) const;
+
+    double lowerScale(int band) const;
+    double upperScale(int band) const;
+
+    // Geometric center of the band
+    double scale(int band) const;
+
+private:
+    double m_minScale;
+    double m_logRatio;
+    int m_count;
+};
+
+// Symbol size as a function of the map scale, interpolated linearly in
+// log scale between control points and held beyond the outer ones.
+class SizeCurve
+{
+public:
+    SizeCurve();
+
+    // Parses "scale:size,..." such as "1000:88,20000:44,500000:16"
+    bool parse(const QString& spec, QString* errorMessage = nullptr);
+    QString toString() const;
+
+    double sizeAt(double scale) const;
+
+    // Sizes of every band, rounded to whole points
+    QVector<int> sizes(const ScaleBands& bands) const;
+
+private:
+    QVector<QPair<double, double>> m_points;
+};
+
+#endif // SCALEBANDS_H
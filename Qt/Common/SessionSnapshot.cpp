@@ -0,0 +1,327 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <cstring>
+
+#include "SessionSnapshot.h"
+
+namespace {
+    const char Magic[4] = { 'M', 'S', 'S', 'N' };
+
+    // Bump when the layout below changes
+    const quint32 Version = 2;
+
+    // Written as is, read back to detect a foreign byte order
+    const quint32 ByteOrderMark = 0x01020304;
+
+    const int CodeWidth = 16;
+
+    struct FileHeader {
+        char magic[4];
+        quint32 version;
+        quint32 byteOrderMark;
+        quint32 flags;
+        quint64 fingerprint;
+
+        double viewX;
+        double viewY;
+        double viewScale;
+        qint32 viewWkid;
+        qint32 symbolSize;
+        qint32 page;
+        quint32 reserved;
+
+        quint32 codeCount;
+        quint32 rowCount;
+        quint64 codesOffset;
+        quint64 rowsOffset;
+        quint64 symbolsOffset;
+        quint64 fileSize;
+    };
+
+    struct FileRow {
+        quint32 code;
+        quint32 reserved;
+        double dx;
+        double dy;
+        double ux;
+        double uy;
+    };
+
+    // Offset and length of the JSON of one code, relative to the symbol blob
+    struct FileSymbol {
+        quint64 offset;
+        quint32 length;
+        quint32 reserved;
+    };
+
+    static_assert(sizeof(FileHeader) == 104, "snapshot header layout");
+    static_assert(sizeof(FileRow) == 40, "snapshot row layout");
+    static_assert(sizeof(FileSymbol) == 16, "snapshot symbol layout");
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+
+    const FileHeader* header(const uchar* data) {
+        return reinterpret_cast<const FileHeader*>(data);
+    }
+
+    const FileRow* rows(const uchar* data) {
+        return reinterpret_cast<const FileRow*>(data + header(data)->rowsOffset);
+    }
+
+    const FileSymbol* symbols(const uchar* data) {
+        return reinterpret_cast<const FileSymbol*>(data + header(data)->symbolsOffset);
+    }
+}
+
+void SnapshotWriter::setState(const SnapshotState& state) {
+    m_state = state;
+}
+
+void SnapshotWriter::addFeature(const QString& sidc, const QPointF& dPoint, const QPointF& uPoint) {
+    Row row;
+    row.code = codeIndex(sidc);
+    row.dPoint = dPoint;
+    row.uPoint = uPoint;
+    m_rows.append(row);
+}
+
+void SnapshotWriter::setSymbolJson(const QString& sidc, const QString& json) {
+    codeIndex(sidc);
+    m_symbols.insert(sidc, json);
+}
+
+int SnapshotWriter::codeIndex(const QString& sidc) {
+    auto it = m_codeIndex.constFind(sidc);
+    if (it != m_codeIndex.constEnd())
+        return it.value();
+
+    m_codes.append(sidc);
+    m_codeIndex.insert(sidc, m_codes.size() - 1);
+    return m_codes.size() - 1;
+}
+
+bool SnapshotWriter::write(const QString& path, quint64 fingerprint, QString* errorMessage /* = nullptr */) const {
+    // Symbol JSON, one blob after the index
+    QByteArray blob;
+    QVector<FileSymbol> index(m_codes.size());
+    for (int i = 0; i < m_codes.size(); i++) {
+        const QByteArray json = m_symbols.value(m_codes.at(i)).toUtf8();
+        index[i].offset = blob.size();
+        index[i].length = json.size();
+        index[i].reserved = 0;
+        blob.append(json);
+    }
+
+    FileHeader fileHeader;
+    std::memset(&fileHeader, 0, sizeof(fileHeader));
+    std::memcpy(fileHeader.magic, Magic, sizeof(Magic));
+    fileHeader.version = Version;
+    fileHeader.byteOrderMark = ByteOrderMark;
+    fileHeader.flags = m_state.flags;
+    fileHeader.fingerprint = fingerprint;
+    fileHeader.viewX = m_state.viewX;
+    fileHeader.viewY = m_state.viewY;
+    fileHeader.viewScale = m_state.viewScale;
+    fileHeader.viewWkid = m_state.viewWkid;
+    fileHeader.symbolSize = m_state.symbolSize;
+    fileHeader.page = m_state.page;
+    fileHeader.codeCount = m_codes.size();
+    fileHeader.rowCount = m_rows.size();
+    fileHeader.codesOffset = sizeof(FileHeader);
+    fileHeader.rowsOffset = fileHeader.codesOffset + quint64(m_codes.size()) * CodeWidth;
+    fileHeader.symbolsOffset = fileHeader.rowsOffset + quint64(m_rows.size()) * sizeof(FileRow);
+    fileHeader.fileSize = fileHeader.symbolsOffset + quint64(index.size()) * sizeof(FileSymbol) + blob.size();
+
+    QByteArray codes(m_codes.size() * CodeWidth, '\0');
+    for (int i = 0; i < m_codes.size(); i++) {
+        const QByteArray code = m_codes.at(i).toLatin1().left(CodeWidth - 1);
+        std::memcpy(codes.data() + i * CodeWidth, code.constData(), code.size());
+    }
+
+    QVector<FileRow> fileRows(m_rows.size());
+    for (int i = 0; i < m_rows.size(); i++) {
+        fileRows[i].code = m_rows.at(i).code;
+        fileRows[i].reserved = 0;
+        fileRows[i].dx = m_rows.at(i).dPoint.x();
+        fileRows[i].dy = m_rows.at(i).dPoint.y();
+        fileRows[i].ux = m_rows.at(i).uPoint.x();
+        fileRows[i].uy = m_rows.at(i).uPoint.y();
+    }
+
+    // Replace the previous snapshot only once the new one is complete
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return fail(errorMessage, file.errorString());
+
+    file.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+    file.write(codes);
+    file.write(reinterpret_cast<const char*>(fileRows.constData()), fileRows.size() * sizeof(FileRow));
+    file.write(reinterpret_cast<const char*>(index.constData()), index.size() * sizeof(FileSymbol));
+    file.write(blob);
+
+    if (!file.commit())
+        return fail(errorMessage, file.errorString());
+
+    return true;
+}
+
+SnapshotReader::SnapshotReader() {
+}
+
+SnapshotReader::~SnapshotReader() {
+    close();
+}
+
+bool SnapshotReader::open(const QString& path, quint64 fingerprint, QString* errorMessage /* = nullptr */) {
+    close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, m_file.errorString());
+
+    m_size = m_file.size();
+    if (m_size < qint64(sizeof(FileHeader))) {
+        close();
+        return fail(errorMessage, QStringLiteral("Not a snapshot"));
+    }
+
+    m_data = m_file.map(0, m_size);
+    if (!m_data) {
+        close();
+        return fail(errorMessage, m_file.errorString());
+    }
+
+    const FileHeader* fileHeader = header(m_data);
+
+    QString error;
+    if (std::memcmp(fileHeader->magic, Magic, sizeof(Magic)) != 0)
+        error = QStringLiteral("Not a snapshot");
+    else if (fileHeader->byteOrderMark != ByteOrderMark)
+        error = QStringLiteral("Snapshot written with another byte order");
+    else if (fileHeader->version != Version)
+        error = QString("Snapshot version %1, expected %2").arg(fileHeader->version).arg(Version);
+    else if (fileHeader->fingerprint != fingerprint)
+        error = QStringLiteral("Snapshot taken with another style or application");
+    else if (fileHeader->fileSize != quint64(m_size)
+             || fileHeader->rowsOffset != fileHeader->codesOffset + quint64(fileHeader->codeCount) * CodeWidth
+             || fileHeader->symbolsOffset != fileHeader->rowsOffset + quint64(fileHeader->rowCount) * sizeof(FileRow)
+             || fileHeader->symbolsOffset + quint64(fileHeader->codeCount) * sizeof(FileSymbol) > quint64(m_size))
+        error = QStringLiteral("Snapshot is truncated or damaged");
+
+    if (error.isEmpty()) {
+        const quint64 blobOffset = fileHeader->symbolsOffset + quint64(fileHeader->codeCount) * sizeof(FileSymbol);
+        const FileSymbol* index = symbols(m_data);
+        for (quint32 i = 0; i < fileHeader->codeCount && error.isEmpty(); i++) {
+            if (blobOffset + index[i].offset + index[i].length > quint64(m_size))
+                error = QStringLiteral("Snapshot is truncated or damaged");
+        }
+
+        const FileRow* fileRows = rows(m_data);
+        for (quint32 i = 0; i < fileHeader->rowCount && error.isEmpty(); i++) {
+            if (fileRows[i].code >= fileHeader->codeCount)
+                error = QStringLiteral("Snapshot is truncated or damaged");
+        }
+    }
+
+    if (!error.isEmpty()) {
+        close();
+        return fail(errorMessage, error);
+    }
+
+    return true;
+}
+
+void SnapshotReader::close() {
+    if (m_data)
+        m_file.unmap(const_cast<uchar*>(m_data));
+
+    m_file.close();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+SnapshotState SnapshotReader::state() const {
+    SnapshotState result;
+    if (!m_data)
+        return result;
+
+    const FileHeader* fileHeader = header(m_data);
+    result.viewX = fileHeader->viewX;
+    result.viewY = fileHeader->viewY;
+    result.viewScale = fileHeader->viewScale;
+    result.viewWkid = fileHeader->viewWkid;
+    result.symbolSize = fileHeader->symbolSize;
+    result.page = fileHeader->page;
+    result.flags = fileHeader->flags;
+    return result;
+}
+
+int SnapshotReader::featureCount() const {
+    return m_data ? header(m_data)->rowCount : 0;
+}
+
+QString SnapshotReader::code(int row) const {
+    return codeAt(rows(m_data)[row].code);
+}
+
+QPointF SnapshotReader::dPoint(int row) const {
+    const FileRow& fileRow = rows(m_data)[row];
+    return QPointF(fileRow.dx, fileRow.dy);
+}
+
+QPointF SnapshotReader::uPoint(int row) const {
+    const FileRow& fileRow = rows(m_data)[row];
+    return QPointF(fileRow.ux, fileRow.uy);
+}
+
+int SnapshotReader::codeCount() const {
+    return m_data ? header(m_data)->codeCount : 0;
+}
+
+QString SnapshotReader::codeAt(int index) const {
+    const char* code = reinterpret_cast<const char*>(m_data + header(m_data)->codesOffset + quint64(index) * CodeWidth);
+    return QString::fromLatin1(code, qstrnlen(code, CodeWidth));
+}
+
+QString SnapshotReader::symbolJsonAt(int index) const {
+    const FileHeader* fileHeader = header(m_data);
+    const FileSymbol& symbol = symbols(m_data)[index];
+    const quint64 blobOffset = fileHeader->symbolsOffset + quint64(fileHeader->codeCount) * sizeof(FileSymbol);
+
+    return QString::fromUtf8(reinterpret_cast<const char*>(m_data + blobOffset + symbol.offset), symbol.length);
+}
+
+quint64 SnapshotReader::fingerprint(const QString& stylePath, const QByteArray& catalog /* = QByteArray() */) {
+    const QFileInfo style(stylePath);
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QCoreApplication::applicationName().toUtf8());
+    hash.addData(style.fileName().toUtf8());
+    hash.addData(QByteArray::number(style.size()));
+    hash.addData(QByteArray::number(style.lastModified().toMSecsSinceEpoch()));
+    hash.addData(catalog);
+
+    quint64 result = 0;
+    std::memcpy(&result, hash.result().constData(), sizeof(result));
+    return result;
+}
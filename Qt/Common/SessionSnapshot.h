@@ -0,0 +1,100 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SESSIONSNAPSHOT_H
+#define SESSIONSNAPSHOT_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QHash>
+#include <QPointF>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// View and renderer state stored next to the features
+struct SnapshotState {
+    double viewX = 0.0;
+    double viewY = 0.0;
+    double viewScale = 0.0;
+    int viewWkid = 0;
+    int symbolSize = 0;
+    quint32 flags = 0;
+
+    // Catalog page shown, for the apps that page
+    int page = 0;
+};
+
+// Writes the tables of a session to a binary file laid out for mapping:
+// a fixed header, fixed width codes, fixed width feature rows, then the
+// symbol JSON of every code.
+class SnapshotWriter
+{
+public:
+    void setState(const SnapshotState& state);
+
+    void addFeature(const QString& sidc, const QPointF& dPoint, const QPointF& uPoint);
+    void setSymbolJson(const QString& sidc, const QString& json);
+
+    bool write(const QString& path, quint64 fingerprint, QString* errorMessage = nullptr) const;
+
+private:
+    struct Row {
+        quint32 code;
+        QPointF dPoint;
+        QPointF uPoint;
+    };
+
+    int codeIndex(const QString& sidc);
+
+    SnapshotState m_state;
+    QStringList m_codes;
+    QHash<QString, int> m_codeIndex;
+    QHash<QString, QString> m_symbols;
+    QVector<Row> m_rows;
+};
+
+// Maps a snapshot and reads it in place. Opening fails on a foreign or
+// damaged file and on a version or fingerprint mismatch, so the caller
+// can fall back to a full rebuild.
+class SnapshotReader
+{
+public:
+    SnapshotReader();
+    ~SnapshotReader();
+
+    bool open(const QString& path, quint64 fingerprint, QString* errorMessage = nullptr);
+    void close();
+
+    SnapshotState state() const;
+
+    int featureCount() const;
+    QString code(int row) const;
+    QPointF dPoint(int row) const;
+    QPointF uPoint(int row) const;
+
+    // Distinct codes and their symbol JSON, empty if none was stored
+    int codeCount() const;
+    QString codeAt(int index) const;
+    QString symbolJsonAt(int index) const;
+
+    // Fingerprint of a style file, the application reading it and what
+    // its catalog was generated from
+    static quint64 fingerprint(const QString& stylePath, const QByteArray& catalog = QByteArray());
+
+private:
+    QFile m_file;
+    const uchar* m_data = nullptr;
+    qint64 m_size = 0;
+};
+
+#endif // SESSIONSNAPSHOT_H
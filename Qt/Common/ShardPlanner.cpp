@@ -0,0 +1,104 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QThread>
+#include <QtConcurrent>
+
+#include "ShardPlanner.h"
+
+namespace {
+    // Codes per chunk below which the partitioning is not worth a thread
+    const int MinimumChunk = 4096;
+
+    QString shardKey(const QString& code, int ordinal, ShardPlanner::Partition partition, int pageSize) {
+        switch (partition) {
+        case ShardPlanner::ByDimension:
+            return code.length() > 2 ? QString(code.at(2)) : QStringLiteral("-");
+        case ShardPlanner::ByPage:
+            return QString("page %1").arg(ordinal / pageSize, 4, 10, QChar('0'));
+        default:
+            return QStringLiteral("all");
+        }
+    }
+}
+
+bool ShardPlanner::partitionFromName(const QString& name, Partition* partition) {
+    const QString lower = name.toLower();
+
+    if (lower == "none")
+        *partition = None;
+    else if (lower == "dimension")
+        *partition = ByDimension;
+    else if (lower == "page")
+        *partition = ByPage;
+    else
+        return false;
+
+    return true;
+}
+
+QList<CatalogShard> ShardPlanner::plan(const QStringList& codes, Partition partition, int pageSize /* = 1000 */) {
+    pageSize = qMax(1, pageSize);
+
+    // Partition chunks of the catalog concurrently
+    const int chunkCount = qBound(1, codes.size() / MinimumChunk, qMax(1, QThread::idealThreadCount()));
+    const int chunkSize = (codes.size() + chunkCount - 1) / qMax(1, chunkCount);
+
+    // Each chunk is partitioned in place by one worker
+    struct Chunk {
+        int start;
+        QMap<QString, QVector<int>> partition;
+    };
+
+    QVector<Chunk> chunks;
+    for (int start = 0; start < codes.size(); start += chunkSize)
+        chunks.append(Chunk{ start, QMap<QString, QVector<int>>() });
+
+    QtConcurrent::blockingMap(chunks, [&codes, chunkSize, partition, pageSize](Chunk& chunk) {
+        const int end = qMin(chunk.start + chunkSize, codes.size());
+        for (int ordinal = chunk.start; ordinal < end; ordinal++)
+            chunk.partition[shardKey(codes.at(ordinal), ordinal, partition, pageSize)].append(ordinal);
+    });
+
+    // Merge in chunk order so the ordinals stay ascending
+    QMap<QString, CatalogShard> merged;
+    for (const Chunk& chunk : chunks) {
+        for (auto it = chunk.partition.constBegin(); it != chunk.partition.constEnd(); ++it) {
+            CatalogShard& shard = merged[it.key()];
+            shard.key = it.key();
+            shard.ordinals += it.value();
+        }
+    }
+
+    QList<CatalogShard> shards = merged.values();
+
+    // Collect the distinct codes of every shard concurrently
+    QtConcurrent::blockingMap(shards, [&codes](CatalogShard& shard) {
+        QSet<QString> seen;
+        seen.reserve(shard.ordinals.size());
+
+        for (int ordinal : shard.ordinals) {
+            const QString& code = codes.at(ordinal);
+            if (seen.contains(code))
+                continue;
+
+            seen.insert(code);
+            shard.uniqueCodes.append(code);
+            shard.firstOrdinals.append(ordinal);
+        }
+    });
+
+    return shards;
+}
@@ -0,0 +1,50 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SHARDPLANNER_H
+#define SHARDPLANNER_H
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// One partition of the catalog, built into its own pair of tables
+struct CatalogShard {
+    QString key;
+
+    // Positions of the shard's codes in the catalog, ascending
+    QVector<int> ordinals;
+
+    // Distinct codes of the shard and the ordinal each first appears at
+    QStringList uniqueCodes;
+    QVector<int> firstOrdinals;
+};
+
+// Partitions a catalog into shards on all cores: the catalog is split
+// into chunks that are partitioned concurrently and merged in order,
+// then the distinct codes of every shard are collected concurrently.
+class ShardPlanner
+{
+public:
+    enum Partition {
+        None,
+        ByDimension,
+        ByPage
+    };
+
+    static bool partitionFromName(const QString& name, Partition* partition);
+
+    static QList<CatalogShard> plan(const QStringList& codes, Partition partition, int pageSize = 1000);
+};
+
+#endif // SHARDPLANNER_H
@@ -0,0 +1,286 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QThread>
+
+#include <atomic>
+#include <cstring>
+
+#include "SharedSymbolCache.h"
+
+namespace {
+    const quint32 Magic = 0x4D53594D; // "MSYM"
+    const quint32 Version = 1;
+
+    // Slots are a power of two for the probe mask, the arena holds the
+    // UTF-8 of every code and its JSON
+    const quint32 SlotCount = 16384;
+    const quint32 ArenaBytes = 32 * 1024 * 1024;
+
+    // Probes before an insert gives up on a crowded table
+    const quint32 MaxProbes = 64;
+
+    // Waits for a creator that has not initialized the segment yet
+    const int InitRetries = 50;
+    const int InitRetryMs = 10;
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+
+    // The segment is only ever accessed through lock free atomics, which
+    // do not depend on the address they are mapped at
+    template <typename T>
+    std::atomic<T>& atomic(T& value) {
+        return *reinterpret_cast<std::atomic<T>*>(&value);
+    }
+
+    quint32 align(quint32 bytes) {
+        return (bytes + 7) & ~quint32(7);
+    }
+}
+
+struct SharedSymbolCache::Header {
+    quint32 magic;
+    quint32 version;
+    quint64 styleHash;
+    quint32 slotCount;
+    quint32 arenaBytes;
+
+    // Both only grow, under the segment lock
+    quint32 arenaUsed;
+    quint32 entryCount;
+};
+
+// A published slot has a non-zero key, and its offset and length are
+// written before the key
+struct SharedSymbolCache::Slot {
+    quint64 key;
+    quint32 offset;
+    quint32 length;
+};
+
+// Every entry in the arena, followed by the code and the JSON
+struct Record {
+    quint32 codeLength;
+    quint32 jsonLength;
+};
+
+SharedSymbolCache::SharedSymbolCache()
+{
+}
+
+SharedSymbolCache::~SharedSymbolCache()
+{
+    detach();
+}
+
+bool SharedSymbolCache::attach(const QString& stylePath, QString* errorMessage /* = nullptr */) {
+    detach();
+
+    m_styleHash = styleHash(stylePath);
+    m_memory.setKey(QString("MilitarySymbols-%1").arg(m_styleHash, 16, 16, QChar('0')));
+
+    const int size = sizeof(Header) + (SlotCount * sizeof(Slot)) + ArenaBytes;
+    m_creator = m_memory.create(size);
+    if (!m_creator && (m_memory.error() != QSharedMemory::AlreadyExists || !m_memory.attach()))
+        return fail(errorMessage, m_memory.errorString());
+
+    // The creator initializes the segment under the lock. An instance that
+    // locks it first finds it still zero and waits for the creator.
+    Header* segment = header();
+    for (int attempt = 0; ; attempt++) {
+        if (!m_memory.lock()) {
+            const QString error = m_memory.errorString();
+            detach();
+            return fail(errorMessage, error);
+        }
+
+        if (m_creator) {
+            std::memset(m_memory.data(), 0, sizeof(Header) + (SlotCount * sizeof(Slot)));
+            segment->version = Version;
+            segment->styleHash = m_styleHash;
+            segment->slotCount = SlotCount;
+            segment->arenaBytes = ArenaBytes;
+            segment->magic = Magic;
+        }
+
+        const quint32 magic = segment->magic;
+        const bool valid = magic == Magic && segment->version == Version &&
+                           segment->styleHash == m_styleHash && segment->slotCount == SlotCount &&
+                           m_memory.size() >= size;
+        m_memory.unlock();
+
+        if (valid)
+            return true;
+
+        if (magic != 0) {
+            detach();
+            return fail(errorMessage, QString("Shared symbol cache %1 belongs to another version").arg(m_memory.key()));
+        }
+
+        if (attempt == InitRetries) {
+            detach();
+            return fail(errorMessage, QString("Shared symbol cache %1 was never initialized").arg(m_memory.key()));
+        }
+
+        QThread::msleep(InitRetryMs);
+    }
+}
+
+void SharedSymbolCache::detach() {
+    if (m_memory.isAttached())
+        m_memory.detach();
+    m_creator = false;
+}
+
+bool SharedSymbolCache::isAttached() const {
+    return m_memory.isAttached();
+}
+
+bool SharedSymbolCache::isCreator() const {
+    return m_creator;
+}
+
+QString SharedSymbolCache::find(const QString& sidc) const {
+    if (!isAttached())
+        return QString();
+
+    const QByteArray code = sidc.toUtf8();
+    const quint64 key = codeHash(code);
+    const quint32 mask = SlotCount - 1;
+    Slot* table = slots();
+
+    for (quint32 probe = 0; probe < MaxProbes; probe++) {
+        Slot& slot = table[(key + probe) & mask];
+        const quint64 slotKey = atomic(slot.key).load(std::memory_order_acquire);
+        if (slotKey == 0)
+            return QString();
+        if (slotKey != key)
+            continue;
+
+        // Published before the key, so complete once the key is seen
+        const Record* record = reinterpret_cast<const Record*>(arena() + slot.offset);
+        const char* data = reinterpret_cast<const char*>(record + 1);
+        if (record->codeLength == quint32(code.size()) && std::memcmp(data, code.constData(), code.size()) == 0)
+            return QString::fromUtf8(data + record->codeLength, record->jsonLength);
+    }
+
+    return QString();
+}
+
+bool SharedSymbolCache::insert(const QString& sidc, const QString& json) {
+    if (!isAttached())
+        return false;
+
+    const QByteArray code = sidc.toUtf8();
+    const QByteArray data = json.toUtf8();
+    const quint64 key = codeHash(code);
+    const quint32 mask = SlotCount - 1;
+    const quint32 length = align(sizeof(Record) + code.size() + data.size());
+
+    if (!m_memory.lock())
+        return false;
+
+    Header* segment = header();
+    Slot* table = slots();
+    bool inserted = false;
+
+    for (quint32 probe = 0; probe < MaxProbes; probe++) {
+        Slot& slot = table[(key + probe) & mask];
+        const quint64 slotKey = atomic(slot.key).load(std::memory_order_relaxed);
+
+        // Another instance resolved the same code first
+        if (slotKey == key) {
+            const Record* record = reinterpret_cast<const Record*>(arena() + slot.offset);
+            if (record->codeLength == quint32(code.size()) &&
+                std::memcmp(reinterpret_cast<const char*>(record + 1), code.constData(), code.size()) == 0)
+                break;
+            continue;
+        }
+        if (slotKey != 0)
+            continue;
+
+        if (segment->arenaUsed + length > segment->arenaBytes)
+            break;
+
+        Record* record = reinterpret_cast<Record*>(arena() + segment->arenaUsed);
+        record->codeLength = code.size();
+        record->jsonLength = data.size();
+        char* bytes = reinterpret_cast<char*>(record + 1);
+        std::memcpy(bytes, code.constData(), code.size());
+        std::memcpy(bytes + code.size(), data.constData(), data.size());
+
+        slot.offset = segment->arenaUsed;
+        slot.length = length;
+        atomic(slot.key).store(key, std::memory_order_release);
+
+        segment->arenaUsed += length;
+        segment->entryCount++;
+        inserted = true;
+        break;
+    }
+
+    m_memory.unlock();
+    return inserted;
+}
+
+int SharedSymbolCache::size() const {
+    return isAttached() ? atomic(header()->entryCount).load(std::memory_order_relaxed) : 0;
+}
+
+qint64 SharedSymbolCache::bytes() const {
+    return isAttached() ? atomic(header()->arenaUsed).load(std::memory_order_relaxed) : 0;
+}
+
+quint64 SharedSymbolCache::styleHash(const QString& stylePath) {
+    const QFileInfo style(stylePath);
+
+    // Unlike the snapshot fingerprint, not the application, so both apps
+    // share the symbols of a style
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(style.fileName().toUtf8());
+    hash.addData(QByteArray::number(style.size()));
+    hash.addData(QByteArray::number(style.lastModified().toMSecsSinceEpoch()));
+
+    quint64 result = 0;
+    std::memcpy(&result, hash.result().constData(), sizeof(result));
+    return result;
+}
+
+quint64 SharedSymbolCache::codeHash(const QByteArray& sidc) {
+    // FNV-1a, never 0 which marks an empty slot
+    quint64 hash = Q_UINT64_C(14695981039346656037);
+    for (const char c : sidc) {
+        hash ^= static_cast<quint8>(c);
+        hash *= Q_UINT64_C(1099511628211);
+    }
+
+    return hash ? hash : 1;
+}
+
+SharedSymbolCache::Header* SharedSymbolCache::header() const {
+    return reinterpret_cast<Header*>(const_cast<void*>(m_memory.constData()));
+}
+
+SharedSymbolCache::Slot* SharedSymbolCache::slots() const {
+    return reinterpret_cast<Slot*>(header() + 1);
+}
+
+char* SharedSymbolCache::arena() const {
+    return reinterpret_cast<char*>(slots() + SlotCount);
+}
@@ -0,0 +1,70 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SHAREDSYMBOLCACHE_H
+#define SHAREDSYMBOLCACHE_H
+
+#include <QSharedMemory>
+#include <QString>
+
+// Resolved symbol JSON keyed by SIDC in a shared memory segment, one per
+// dictionary style, that every local instance of the apps attaches to.
+//
+// The segment is a fixed table of slots over an append only arena.
+// Entries are never changed or removed once published, so lookups read
+// the segment without a lock. Inserts take the segment's system lock,
+// write the entry to the arena and publish its slot last. Once the
+// table or the arena is full, inserts fail and the caller keeps the
+// symbol to itself.
+class SharedSymbolCache
+{
+public:
+    SharedSymbolCache();
+    ~SharedSymbolCache();
+
+    // Creates the segment of the style, or attaches to the one another
+    // instance created
+    bool attach(const QString& stylePath, QString* errorMessage = nullptr);
+    void detach();
+    bool isAttached() const;
+
+    // Whether this instance created the segment, and so started cold
+    bool isCreator() const;
+
+    // Lock free, a null string when sidc is not cached
+    QString find(const QString& sidc) const;
+    bool insert(const QString& sidc, const QString& json);
+
+    int size() const;
+    qint64 bytes() const;
+
+    // Same for every instance on every platform, unlike qHash
+    static quint64 styleHash(const QString& stylePath);
+
+private:
+    Q_DISABLE_COPY(SharedSymbolCache)
+
+    struct Header;
+    struct Slot;
+
+    static quint64 codeHash(const QByteArray& sidc);
+
+    Header* header() const;
+    Slot* slots() const;
+    char* arena() const;
+
+    QSharedMemory m_memory;
+    quint64 m_styleHash = 0;
+    bool m_creator = false;
+};
+
+#endif // SHAREDSYMBOLCACHE_H
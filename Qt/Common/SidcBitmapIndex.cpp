@@ -0,0 +1,272 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "SidcBitmapIndex.h"
+
+namespace {
+    struct Keyword {
+        const char* name;
+        SidcBitmapIndex::Field field;
+        const char* values;
+    };
+
+    // Shorthands for the common filters
+    const Keyword Keywords[] = {
+        { "pending",      SidcBitmapIndex::Affiliation, "P" },
+        { "unknown",      SidcBitmapIndex::Affiliation, "U" },
+        { "assumed",      SidcBitmapIndex::Affiliation, "A" },
+        { "friend",       SidcBitmapIndex::Affiliation, "F" },
+        { "neutral",      SidcBitmapIndex::Affiliation, "N" },
+        { "suspect",      SidcBitmapIndex::Affiliation, "S" },
+        { "hostile",      SidcBitmapIndex::Affiliation, "H" },
+        { "space",        SidcBitmapIndex::Dimension,   "P" },
+        { "air",          SidcBitmapIndex::Dimension,   "A" },
+        { "ground",       SidcBitmapIndex::Dimension,   "G" },
+        { "sea",          SidcBitmapIndex::Dimension,   "S" },
+        { "subsurface",   SidcBitmapIndex::Dimension,   "U" },
+        { "sof",          SidcBitmapIndex::Dimension,   "F" },
+        { "planned",      SidcBitmapIndex::Status,      "A" },
+        { "present",      SidcBitmapIndex::Status,      "PCDXF" }
+    };
+
+    const char* FieldNames[SidcBitmapIndex::FieldCount] = {
+        "scheme", "affiliation", "dimension", "status", "echelon"
+    };
+}
+
+// Recursive descent over
+//   expression := term ('|' term)*
+//   term       := factor ('&' factor)*
+//   factor     := '!' factor | '(' expression ')' | predicate
+//   predicate  := field ':' values | keyword | '*'
+class SidcBitmapIndex::Parser
+{
+public:
+    Parser(const SidcBitmapIndex& index, const QString& text):
+        m_index(index),
+        m_text(text)
+    {
+    }
+
+    bool parse(CompressedBitmap* result) {
+        *result = expression();
+        skipSpace();
+        if (m_error.isEmpty() && m_pos < m_text.length())
+            fail(QString("Unexpected '%1'").arg(m_text.at(m_pos)));
+        return m_error.isEmpty();
+    }
+
+    QString error() const {
+        return m_error;
+    }
+
+private:
+    CompressedBitmap expression() {
+        CompressedBitmap result = term();
+        while (m_error.isEmpty() && accept('|'))
+            result = result | term();
+        return result;
+    }
+
+    CompressedBitmap term() {
+        CompressedBitmap result = factor();
+        while (m_error.isEmpty() && accept('&'))
+            result = result & factor();
+        return result;
+    }
+
+    CompressedBitmap factor() {
+        if (accept('!'))
+            return m_index.all().andNot(factor());
+
+        if (accept('(')) {
+            CompressedBitmap result = expression();
+            if (!accept(')'))
+                fail(QStringLiteral("Missing ')'"));
+            return result;
+        }
+
+        return predicate();
+    }
+
+    CompressedBitmap predicate() {
+        if (accept('*'))
+            return m_index.all();
+
+        const QString name = word().toLower();
+        if (name.isEmpty()) {
+            fail(m_pos < m_text.length() ? QString("Unexpected '%1'").arg(m_text.at(m_pos)) : QStringLiteral("Unexpected end of filter"));
+            return CompressedBitmap();
+        }
+
+        if (!accept(':')) {
+            for (const Keyword& keyword : Keywords) {
+                if (name == QLatin1String(keyword.name))
+                    return any(keyword.field, QString::fromLatin1(keyword.values));
+            }
+            fail(QString("Unknown filter '%1'").arg(name));
+            return CompressedBitmap();
+        }
+
+        for (int field = 0; field < FieldCount; field++) {
+            if (name == QLatin1String(FieldNames[field])) {
+                skipSpace();
+                const int start = m_pos;
+                while (m_pos < m_text.length() && (m_text.at(m_pos).isLetterOrNumber() || m_text.at(m_pos) == '-'))
+                    m_pos++;
+
+                const QString values = m_text.mid(start, m_pos - start).toUpper();
+                if (values.isEmpty())
+                    fail(QString("Missing value for '%1'").arg(name));
+                return any(static_cast<Field>(field), values);
+            }
+        }
+
+        fail(QString("Unknown field '%1'").arg(name));
+        return CompressedBitmap();
+    }
+
+    CompressedBitmap any(Field field, const QString& values) const {
+        CompressedBitmap result;
+        for (QChar value : values)
+            result = result | m_index.values(field, value);
+        return result;
+    }
+
+    QString word() {
+        skipSpace();
+        const int start = m_pos;
+        while (m_pos < m_text.length() && m_text.at(m_pos).isLetter())
+            m_pos++;
+        return m_text.mid(start, m_pos - start);
+    }
+
+    bool accept(QChar c) {
+        skipSpace();
+        if (m_pos < m_text.length() && m_text.at(m_pos) == c) {
+            m_pos++;
+            return true;
+        }
+        return false;
+    }
+
+    void skipSpace() {
+        while (m_pos < m_text.length() && m_text.at(m_pos).isSpace())
+            m_pos++;
+    }
+
+    void fail(const QString& message) {
+        if (m_error.isEmpty())
+            m_error = message;
+    }
+
+    const SidcBitmapIndex& m_index;
+    const QString m_text;
+    int m_pos = 0;
+    QString m_error;
+};
+
+SidcBitmapIndex::SidcBitmapIndex()
+{
+}
+
+int SidcBitmapIndex::position(Field field) {
+    switch (field) {
+    case Scheme:      return 0;
+    case Affiliation: return 1;
+    case Dimension:   return 2;
+    case Status:      return 3;
+    case Echelon:     return 11;
+    default:          return -1;
+    }
+}
+
+QStringList SidcBitmapIndex::keywords(const QString& sidc) {
+    QStringList result;
+    for (const Keyword& keyword : Keywords) {
+        const int pos = position(keyword.field);
+        if (pos < sidc.length() && QString(keyword.values).contains(sidc.at(pos).toUpper()))
+            result.append(keyword.name);
+    }
+
+    return result;
+}
+
+void SidcBitmapIndex::add(quint32 ordinal, const QString& sidc) {
+    if (m_all.contains(ordinal))
+        remove(ordinal);
+
+    const int offset = static_cast<int>(ordinal) * FieldCount;
+    if (m_fields.size() < offset + FieldCount)
+        m_fields.resize(offset + FieldCount);
+
+    for (int field = 0; field < FieldCount; field++) {
+        const int pos = position(static_cast<Field>(field));
+        const QChar value = pos < sidc.length() ? sidc.at(pos).toUpper() : QChar('-');
+
+        m_bitmaps[field][value].add(ordinal);
+        m_fields[offset + field] = value.toLatin1();
+    }
+
+    m_all.add(ordinal);
+}
+
+void SidcBitmapIndex::remove(quint32 ordinal) {
+    if (!m_all.contains(ordinal))
+        return;
+
+    const int offset = static_cast<int>(ordinal) * FieldCount;
+    for (int field = 0; field < FieldCount; field++)
+        m_bitmaps[field][QChar::fromLatin1(m_fields.at(offset + field))].remove(ordinal);
+
+    m_all.remove(ordinal);
+}
+
+void SidcBitmapIndex::clear() {
+    for (int field = 0; field < FieldCount; field++)
+        m_bitmaps[field].clear();
+
+    m_fields.clear();
+    m_all.clear();
+}
+
+int SidcBitmapIndex::size() const {
+    return m_all.cardinality();
+}
+
+const CompressedBitmap& SidcBitmapIndex::all() const {
+    return m_all;
+}
+
+CompressedBitmap SidcBitmapIndex::values(Field field, QChar value) const {
+    if (field < 0 || field >= FieldCount)
+        return CompressedBitmap();
+
+    return m_bitmaps[field].value(value.toUpper());
+}
+
+bool SidcBitmapIndex::evaluate(const QString& expression, CompressedBitmap* result, QString* errorMessage /* = nullptr */) const {
+    // An empty filter shows everything
+    if (expression.trimmed().isEmpty()) {
+        *result = m_all;
+        return true;
+    }
+
+    Parser parser(*this, expression);
+    if (parser.parse(result))
+        return true;
+
+    if (errorMessage)
+        *errorMessage = parser.error();
+
+    return false;
+}
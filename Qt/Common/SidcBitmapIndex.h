@@ -0,0 +1,74 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SIDCBITMAPINDEX_H
+#define SIDCBITMAPINDEX_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "CompressedBitmap.h"
+
+// Bitmap indexes over the decoded fields of 15 character 2525C SIDCs,
+// keyed by the ordinal of each symbol.
+//
+// Filters are boolean expressions of field predicates, for example
+//   "affiliation:H & dimension:G"
+//   "(hostile | suspect) & !planned"
+//   "echelon:DE & ground"
+// A predicate with several values matches any of them.
+class SidcBitmapIndex
+{
+public:
+    enum Field {
+        Scheme,
+        Affiliation,
+        Dimension,
+        Status,
+        Echelon,
+        FieldCount
+    };
+
+    SidcBitmapIndex();
+
+    void add(quint32 ordinal, const QString& sidc);
+    void remove(quint32 ordinal);
+    void clear();
+
+    int size() const;
+
+    // Every indexed ordinal
+    const CompressedBitmap& all() const;
+    CompressedBitmap values(Field field, QChar value) const;
+
+    bool evaluate(const QString& expression, CompressedBitmap* result, QString* errorMessage = nullptr) const;
+
+    static int position(Field field);
+
+    // Filter keywords matching a code, e.g. "hostile ground present"
+    static QStringList keywords(const QString& sidc);
+
+private:
+    class Parser;
+
+    QHash<QChar, CompressedBitmap> m_bitmaps[FieldCount];
+    CompressedBitmap m_all;
+
+    // Decoded fields of each ordinal, FieldCount bytes per ordinal, so
+    // an ordinal can be removed again
+    QByteArray m_fields;
+};
+
+#endif // SIDCBITMAPINDEX_H
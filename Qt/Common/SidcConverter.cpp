@@ -0,0 +1,581 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <cstring>
+
+#include "SidcConverter.h"
+
+namespace {
+    const int LegacyLength = 15;
+    const int EntityLength = 20;
+
+    // Codes per chunk below which a conversion is not worth a thread
+    const int MinimumChunk = 16384;
+
+    const quint8 None = 0xFF;
+
+    // Tables indexed by the characters and digits of either code, built
+    // once and only read afterwards
+    struct Tables {
+        // 2525C to 2525D, by character
+        quint8 context[128];
+        quint8 identity[128];
+        quint8 status[128];
+        quint8 headquarters[128];
+        quint8 echelon[128];
+        quint8 mobility[128];
+        quint8 towedArray[128];
+        quint8 keyCode[128];
+
+        // 2525D to 2525C, by digit
+        char affiliation[3][7];
+        char statusCode[6];
+        char headquartersCode[8];
+        char amplifier[100][2];
+
+        Tables() {
+            std::memset(context, None, sizeof(context));
+            std::memset(identity, None, sizeof(identity));
+            std::memset(status, None, sizeof(status));
+            std::memset(headquarters, None, sizeof(headquarters));
+            std::memset(echelon, None, sizeof(echelon));
+            std::memset(mobility, None, sizeof(mobility));
+            std::memset(towedArray, None, sizeof(towedArray));
+            std::memset(keyCode, None, sizeof(keyCode));
+
+            // Reality, then exercise affiliations, joker and faker are the
+            // exercise suspect and hostile
+            const char* reality = "PUAFNSH";
+            const char* exercise = "GWMDLJK";
+            for (int i = 0; i < 7; i++) {
+                context[static_cast<int>(reality[i])] = 0;
+                identity[static_cast<int>(reality[i])] = i;
+                context[static_cast<int>(exercise[i])] = 1;
+                identity[static_cast<int>(exercise[i])] = i;
+
+                affiliation[0][i] = reality[i];
+                affiliation[1][i] = exercise[i];
+                affiliation[2][i] = exercise[i];
+            }
+            context['-'] = context['*'] = 0;
+            identity['-'] = identity['*'] = 1;
+
+            // Anticipated is planned in 2525D
+            const char* statuses = "PACDXF";
+            for (int i = 0; i < 6; i++) {
+                status[static_cast<int>(statuses[i])] = i;
+                statusCode[i] = statuses[i];
+            }
+            status['-'] = status['*'] = 0;
+
+            // Feint or dummy, headquarters and task force
+            const char* modifiers = "-FACEGBD";
+            for (int i = 0; i < 8; i++) {
+                headquarters[static_cast<int>(modifiers[i])] = i;
+                headquartersCode[i] = modifiers[i];
+            }
+            headquarters['*'] = headquarters['H'] = headquarters['M'] = headquarters['N'] = 0;
+
+            for (int i = 0; i < 100; i++) {
+                amplifier[i][0] = '-';
+                amplifier[i][1] = '-';
+            }
+
+            const char* echelons = "ABCDEFGHIJKLMN";
+            const int echelonValues[] = { 11, 12, 13, 14, 15, 16, 17, 18, 21, 22, 23, 24, 25, 26 };
+            for (int i = 0; i < 14; i++) {
+                echelon[static_cast<int>(echelons[i])] = echelonValues[i];
+                amplifier[echelonValues[i]][1] = echelons[i];
+            }
+            echelon['-'] = echelon['*'] = 0;
+
+            const char* mobilities = "OPQRSTUVWXY";
+            const int mobilityValues[] = { 31, 32, 33, 34, 35, 36, 41, 42, 37, 51, 52 };
+            for (int i = 0; i < 11; i++) {
+                mobility[static_cast<int>(mobilities[i])] = mobilityValues[i];
+                amplifier[mobilityValues[i]][0] = 'M';
+                amplifier[mobilityValues[i]][1] = mobilities[i];
+            }
+
+            towedArray['S'] = 61;
+            towedArray['L'] = 62;
+            amplifier[61][0] = amplifier[62][0] = 'N';
+            amplifier[61][1] = 'S';
+            amplifier[62][1] = 'L';
+
+            // Six bits per character of the entity keys, wildcards match
+            // the unspecified character
+            keyCode['-'] = keyCode['*'] = 0;
+            for (int i = 0; i < 10; i++)
+                keyCode['0' + i] = 1 + i;
+            for (int i = 0; i < 26; i++)
+                keyCode['A' + i] = 11 + i;
+        }
+    };
+
+    const Tables& tables() {
+        static const Tables instance;
+        return instance;
+    }
+
+    inline quint8 lookup(const quint8* table, ushort c) {
+        return c < 128 ? table[c] : None;
+    }
+
+    // Whether count UTF-16 characters, a multiple of 4, are all digits,
+    // four at a time in one 64 bit word
+    bool allDigits(const ushort* characters, int count) {
+        const quint64 high = Q_UINT64_C(0x8000800080008000);
+        const quint64 zeros = Q_UINT64_C(0x0030003000300030);
+        const quint64 nines = Q_UINT64_C(0x8039803980398039);
+
+        for (int i = 0; i < count; i += 4) {
+            quint64 word;
+            std::memcpy(&word, characters + i, sizeof(word));
+
+            // No lane borrows from the next: every lane is below 0x8000
+            // once the high bits are known to be clear
+            if (word & high)
+                return false;
+
+            const quint64 atLeastZero = (word | high) - zeros;
+            const quint64 atMostNine = nines - word;
+            if ((atLeastZero & atMostNine & high) != high)
+                return false;
+        }
+
+        return true;
+    }
+
+    // Symbol set of a 2525C code without a mapping of its entity
+    int symbolSet(ushort scheme, ushort dimension, ushort function) {
+        switch (scheme) {
+        case 'S':
+            switch (dimension) {
+            case 'P': return 5;
+            case 'A': return function == 'W' ? 2 : 1;
+            case 'G': return function == 'E' ? 15 : (function == 'I' ? 20 : 10);
+            case 'S': return 30;
+            case 'U': return 35;
+            case 'F': return 10;
+            default:  return -1;
+            }
+        case 'G': return 25;
+        case 'O': return 40;
+        case 'E': return 40;
+        case 'I':
+            switch (dimension) {
+            case 'P': return 50;
+            case 'A': return 51;
+            case 'G': return 52;
+            case 'S': return 53;
+            case 'U': return 54;
+            default:  return -1;
+            }
+        default:
+            return -1;
+        }
+    }
+
+    // Scheme, battle dimension and function ID of a 2525D symbol set
+    // without a mapping of its entity
+    bool legacyFrame(int set, ushort* scheme, ushort* dimension, const char** function) {
+        *function = "------";
+        switch (set) {
+        case 1: case 2: *scheme = 'S'; *dimension = 'A'; return true;
+        case 5: case 6: *scheme = 'S'; *dimension = 'P'; return true;
+        case 10: case 11: *scheme = 'S'; *dimension = 'G'; *function = "U-----"; return true;
+        case 15: *scheme = 'S'; *dimension = 'G'; *function = "E-----"; return true;
+        case 20: *scheme = 'S'; *dimension = 'G'; *function = "I-----"; return true;
+        case 25: *scheme = 'G'; *dimension = 'G'; return true;
+        case 30: *scheme = 'S'; *dimension = 'S'; return true;
+        case 35: case 36: *scheme = 'S'; *dimension = 'U'; return true;
+        case 40: *scheme = 'O'; *dimension = 'V'; return true;
+        case 50: *scheme = 'I'; *dimension = 'P'; return true;
+        case 51: *scheme = 'I'; *dimension = 'A'; return true;
+        case 52: *scheme = 'I'; *dimension = 'G'; return true;
+        case 53: *scheme = 'I'; *dimension = 'S'; return true;
+        case 54: *scheme = 'I'; *dimension = 'U'; return true;
+        default: return false;
+        }
+    }
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+}
+
+SidcConverter::Stats& SidcConverter::Stats::operator+=(const Stats& other) {
+    converted += other.converted;
+    generalized += other.generalized;
+    frameOnly += other.frameOnly;
+    unchanged += other.unchanged;
+    invalid += other.invalid;
+    return *this;
+}
+
+SidcConverter::SidcConverter() {
+    loadTable(QStringLiteral(":/data/sidc_c_to_d.csv"));
+}
+
+bool SidcConverter::loadTable(const QString& path, QString* errorMessage /* = nullptr */) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return fail(errorMessage, file.errorString());
+
+    QTextStream stream(&file);
+    int lineNumber = 0;
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        lineNumber++;
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        const QStringList fields = line.split(',');
+        if (fields.size() < 2 || !addMapping(fields.at(0).trimmed(), fields.at(1).trimmed()))
+            return fail(errorMessage, QString("Invalid SIDC mapping at %1:%2").arg(path).arg(lineNumber));
+    }
+
+    return true;
+}
+
+bool SidcConverter::addMapping(const QString& revisionC, const QString& revisionD) {
+    if (!isRevisionC(revisionC) || !isRevisionD(revisionD))
+        return false;
+
+    const ushort* c = revisionC.utf16();
+    const ushort* d = revisionD.utf16();
+
+    LegacyEntity legacy;
+    legacy.scheme = c[0];
+    legacy.dimension = c[2];
+    for (int i = 0; i < 6; i++)
+        legacy.function[i] = c[4 + i];
+
+    // Symbol set, then entity and modifiers
+    Entity entity;
+    entity.digits[0] = d[4] - '0';
+    entity.digits[1] = d[5] - '0';
+    for (int i = 0; i < 10; i++)
+        entity.digits[2 + i] = d[10 + i] - '0';
+
+    // The first mapping of a code wins in either direction
+    const int index = m_legacy.size();
+    m_legacy.append(legacy);
+    m_entities.append(entity);
+
+    const quint64 cKey = legacyKey(legacy.scheme, legacy.dimension, legacy.function);
+    if (!m_toD.contains(cKey))
+        m_toD.insert(cKey, index);
+
+    const quint64 dKey = entityKey(entity.digits);
+    if (!m_toC.contains(dKey))
+        m_toC.insert(dKey, index);
+
+    return true;
+}
+
+int SidcConverter::mappingCount() const {
+    return m_legacy.size();
+}
+
+bool SidcConverter::isRevisionC(const QString& sidc) {
+    if (sidc.length() != LegacyLength)
+        return false;
+
+    const ushort scheme = sidc.at(0).unicode();
+    return scheme == 'S' || scheme == 'G' || scheme == 'I' || scheme == 'O' || scheme == 'E';
+}
+
+bool SidcConverter::isRevisionD(const QString& sidc) {
+    return sidc.length() == EntityLength && allDigits(sidc.utf16(), EntityLength);
+}
+
+quint64 SidcConverter::legacyKey(ushort scheme, ushort dimension, const ushort* function) {
+    const quint8* codes = tables().keyCode;
+
+    quint64 key = (static_cast<quint64>(lookup(codes, scheme)) << 6) | lookup(codes, dimension);
+    for (int i = 0; i < 6; i++)
+        key = (key << 6) | lookup(codes, function[i]);
+
+    return key;
+}
+
+quint64 SidcConverter::entityKey(const quint8* digits) {
+    quint64 key = 0;
+    for (int i = 0; i < 12; i++)
+        key = (key * 10) + digits[i];
+
+    return key;
+}
+
+bool SidcConverter::findEntity(ushort scheme, ushort dimension, const ushort* function, Entity* entity, bool* generalized) const {
+    ushort parent[6];
+    std::memcpy(parent, function, sizeof(parent));
+
+    // Up the hierarchy of the function ID, one character at a time
+    for (int level = 6; level >= 0; level--) {
+        if (level < 6) {
+            if (parent[level] == '-')
+                continue;
+            parent[level] = '-';
+        }
+
+        const auto it = m_toD.constFind(legacyKey(scheme, dimension, parent));
+        if (it != m_toD.constEnd()) {
+            *entity = m_entities.at(it.value());
+            *generalized = level < 6;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool SidcConverter::findLegacy(const quint8* digits, LegacyEntity* legacy, bool* generalized) const {
+    quint8 parent[12];
+    std::memcpy(parent, digits, sizeof(parent));
+
+    // Without the modifiers, then without the subtype and type
+    const int cleared[] = { -1, 8, 6, 4 };
+    for (int step = 0; step < 4; step++) {
+        if (cleared[step] >= 0) {
+            for (int i = cleared[step]; i < 12; i++)
+                parent[i] = 0;
+        }
+
+        const auto it = m_toC.constFind(entityKey(parent));
+        if (it != m_toC.constEnd()) {
+            *legacy = m_legacy.at(it.value());
+            *generalized = step > 0;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QString SidcConverter::toRevisionD(const QString& sidc, Stats* stats /* = nullptr */) const {
+    Stats local;
+    Stats& counts = stats ? *stats : local;
+
+    if (!isRevisionC(sidc)) {
+        counts.invalid++;
+        return QString();
+    }
+
+    const Tables& t = tables();
+    const ushort* c = sidc.utf16();
+
+    const quint8 context = lookup(t.context, c[1]);
+    const quint8 identity = lookup(t.identity, c[1]);
+    const quint8 status = lookup(t.status, c[3]);
+    const quint8 headquarters = lookup(t.headquarters, c[10]);
+    if (context == None || identity == None || status == None || headquarters == None) {
+        counts.invalid++;
+        return QString();
+    }
+
+    // Echelon, or mobility and towed arrays that take both positions
+    quint8 amplifier = 0;
+    if (c[10] == 'M')
+        amplifier = lookup(t.mobility, c[11]);
+    else if (c[10] == 'N')
+        amplifier = lookup(t.towedArray, c[11]);
+    else
+        amplifier = lookup(t.echelon, c[11]);
+    if (amplifier == None)
+        amplifier = 0;
+
+    Entity entity;
+    bool generalized = false;
+    if (!findEntity(c[0], c[2], c + 4, &entity, &generalized)) {
+        const int set = symbolSet(c[0], c[2], c[4]);
+        if (set < 0) {
+            counts.invalid++;
+            return QString();
+        }
+
+        std::memset(entity.digits, 0, sizeof(entity.digits));
+        entity.digits[0] = set / 10;
+        entity.digits[1] = set % 10;
+        counts.frameOnly++;
+    }
+    else if (generalized) {
+        counts.generalized++;
+    }
+
+    QChar out[EntityLength];
+    out[0] = QLatin1Char('1');
+    out[1] = QLatin1Char('0');
+    out[2] = QChar('0' + context);
+    out[3] = QChar('0' + identity);
+    out[4] = QChar('0' + entity.digits[0]);
+    out[5] = QChar('0' + entity.digits[1]);
+    out[6] = QChar('0' + status);
+    out[7] = QChar('0' + headquarters);
+    out[8] = QChar('0' + (amplifier / 10));
+    out[9] = QChar('0' + (amplifier % 10));
+    for (int i = 0; i < 10; i++)
+        out[10 + i] = QChar('0' + entity.digits[2 + i]);
+
+    counts.converted++;
+    return QString(out, EntityLength);
+}
+
+QString SidcConverter::toRevisionC(const QString& sidc, Stats* stats /* = nullptr */) const {
+    Stats local;
+    Stats& counts = stats ? *stats : local;
+
+    if (!isRevisionD(sidc)) {
+        counts.invalid++;
+        return QString();
+    }
+
+    const Tables& t = tables();
+    const ushort* d = sidc.utf16();
+
+    const int context = d[2] - '0';
+    const int identity = d[3] - '0';
+    const int status = d[6] - '0';
+    const int headquarters = d[7] - '0';
+    const int amplifier = ((d[8] - '0') * 10) + (d[9] - '0');
+    if (context > 2 || identity > 6 || status > 5 || headquarters > 7) {
+        counts.invalid++;
+        return QString();
+    }
+
+    Entity entity;
+    entity.digits[0] = d[4] - '0';
+    entity.digits[1] = d[5] - '0';
+    for (int i = 0; i < 10; i++)
+        entity.digits[2 + i] = d[10 + i] - '0';
+
+    QChar out[LegacyLength];
+
+    LegacyEntity legacy;
+    bool generalized = false;
+    if (findLegacy(entity.digits, &legacy, &generalized)) {
+        out[0] = legacy.scheme;
+        out[2] = legacy.dimension;
+        for (int i = 0; i < 6; i++)
+            out[4 + i] = legacy.function[i];
+
+        if (generalized)
+            counts.generalized++;
+    }
+    else {
+        ushort scheme;
+        ushort dimension;
+        const char* function;
+        if (!legacyFrame((entity.digits[0] * 10) + entity.digits[1], &scheme, &dimension, &function)) {
+            counts.invalid++;
+            return QString();
+        }
+
+        out[0] = scheme;
+        out[2] = dimension;
+        for (int i = 0; i < 6; i++)
+            out[4 + i] = QLatin1Char(function[i]);
+
+        counts.frameOnly++;
+    }
+
+    out[1] = QLatin1Char(t.affiliation[context][identity]);
+    out[3] = QLatin1Char(t.statusCode[status]);
+
+    // Headquarters, task force and dummy take the position mobility
+    // would, and win over it
+    out[10] = QLatin1Char(t.amplifier[amplifier][0]);
+    out[11] = QLatin1Char(t.amplifier[amplifier][1]);
+    if (headquarters > 0) {
+        out[10] = QLatin1Char(t.headquartersCode[headquarters]);
+        if (t.amplifier[amplifier][0] != '-')
+            out[11] = QLatin1Char('-');
+    }
+
+    // No country or order of battle
+    out[12] = QLatin1Char('-');
+    out[13] = QLatin1Char('-');
+    out[14] = QLatin1Char('-');
+
+    counts.converted++;
+    return QString(out, LegacyLength);
+}
+
+QString SidcConverter::normalize(const QString& sidc, Revision target, Stats* stats /* = nullptr */) const {
+    if (target == RevisionD) {
+        if (isRevisionC(sidc)) {
+            const QString converted = toRevisionD(sidc, stats);
+            if (!converted.isEmpty())
+                return converted;
+        }
+        else if (stats) {
+            isRevisionD(sidc) ? stats->unchanged++ : stats->invalid++;
+        }
+
+        return sidc;
+    }
+
+    if (isRevisionD(sidc)) {
+        const QString converted = toRevisionC(sidc, stats);
+        if (!converted.isEmpty())
+            return converted;
+    }
+    else if (stats) {
+        isRevisionC(sidc) ? stats->unchanged++ : stats->invalid++;
+    }
+
+    return sidc;
+}
+
+QStringList SidcConverter::normalize(const QStringList& codes, Revision target, Stats* stats /* = nullptr */) const {
+    QStringList result = codes;
+    if (codes.isEmpty())
+        return result;
+
+    // Convert chunks of the codes concurrently, in place
+    const int chunkCount = qBound(1, codes.size() / MinimumChunk, qMax(1, QThread::idealThreadCount()));
+    const int chunkSize = (codes.size() + chunkCount - 1) / qMax(1, chunkCount);
+
+    struct Chunk {
+        int start;
+        Stats stats;
+    };
+
+    QVector<Chunk> chunks;
+    for (int start = 0; start < codes.size(); start += chunkSize)
+        chunks.append(Chunk{ start, Stats() });
+
+    // Detach once, so the workers only write to their own elements
+    const QStringList::iterator output = result.begin();
+
+    QtConcurrent::blockingMap(chunks, [this, &codes, output, chunkSize, target](Chunk& chunk) {
+        const int end = qMin(chunk.start + chunkSize, codes.size());
+        for (int i = chunk.start; i < end; i++)
+            output[i] = normalize(codes.at(i), target, &chunk.stats);
+    });
+
+    if (stats) {
+        for (const Chunk& chunk : chunks)
+            *stats += chunk.stats;
+    }
+
+    return result;
+}
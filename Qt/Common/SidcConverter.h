@@ -0,0 +1,91 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SIDCCONVERTER_H
+#define SIDCCONVERTER_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// Converts symbol codes between the 15 character MIL-STD-2525C SIDC and
+// the 20 digit MIL-STD-2525D SIDC, in bulk.
+//
+// The frame of a code (affiliation and context, status, headquarters,
+// task force and dummy, echelon or mobility) goes through fixed tables
+// indexed by character. The entity goes through a table of mappings,
+// seeded from the resources and extended with loadTable(). An entity
+// that is not in the table is looked up again one level up its
+// hierarchy, and if nothing matches only the frame is converted.
+// Country and order of battle have no place in the 20 digit code.
+class SidcConverter
+{
+public:
+    enum Revision { RevisionC, RevisionD };
+
+    struct Stats {
+        qint64 converted = 0;
+        qint64 generalized = 0;
+        qint64 frameOnly = 0;
+        qint64 unchanged = 0;
+        qint64 invalid = 0;
+
+        Stats& operator+=(const Stats& other);
+    };
+
+    // With the mappings of the resources
+    SidcConverter();
+
+    // Adds the mappings of a CSV file, lines of <2525C code>,<2525D code>
+    // where only the entity parts of each code are used
+    bool loadTable(const QString& path, QString* errorMessage = nullptr);
+    bool addMapping(const QString& revisionC, const QString& revisionD);
+    int mappingCount() const;
+
+    static bool isRevisionC(const QString& sidc);
+    static bool isRevisionD(const QString& sidc);
+
+    // An empty string if sidc is not a code of the other revision
+    QString toRevisionD(const QString& sidc, Stats* stats = nullptr) const;
+    QString toRevisionC(const QString& sidc, Stats* stats = nullptr) const;
+
+    // Codes of either revision to the target, the others left as they are
+    QString normalize(const QString& sidc, Revision target, Stats* stats = nullptr) const;
+    QStringList normalize(const QStringList& codes, Revision target, Stats* stats = nullptr) const;
+
+private:
+    // Scheme, battle dimension and function ID of a 2525C code
+    struct LegacyEntity {
+        ushort scheme;
+        ushort dimension;
+        ushort function[6];
+    };
+
+    // Symbol set, entity and modifiers of a 2525D code, as digits
+    struct Entity {
+        quint8 digits[12];
+    };
+
+    static quint64 legacyKey(ushort scheme, ushort dimension, const ushort* function);
+    static quint64 entityKey(const quint8* digits);
+
+    bool findEntity(ushort scheme, ushort dimension, const ushort* function, Entity* entity, bool* generalized) const;
+    bool findLegacy(const quint8* digits, LegacyEntity* legacy, bool* generalized) const;
+
+    QVector<LegacyEntity> m_legacy;
+    QVector<Entity> m_entities;
+    QHash<quint64, int> m_toD;
+    QHash<quint64, int> m_toC;
+};
+
+#endif // SIDCCONVERTER_H
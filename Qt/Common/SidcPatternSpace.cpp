@@ -0,0 +1,260 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+#include "SidcPatternSpace.h"
+
+namespace {
+    const int CodeLength = 15;
+
+    // First position and width of every slot
+    const int SlotStart[SidcPatternSpace::SlotCount] = { 10, 11, 12, 14 };
+    const int SlotWidth[SidcPatternSpace::SlotCount] = { 1, 1, 2, 1 };
+
+    const char* const SlotNames[SidcPatternSpace::SlotCount] = { "modifier", "echelon", "country", "order" };
+
+    QStringList characters(const QString& alphabet) {
+        QStringList result;
+        for (QChar c : alphabet)
+            result.append(QString(c));
+        return result;
+    }
+
+    QStringList defaultValues(int slot) {
+        switch (slot) {
+        case SidcPatternSpace::Modifier:
+            return characters("-ABCDEFGH");
+        case SidcPatternSpace::Echelon:
+            return characters("-ABCDEFGHIJKLMN");
+        case SidcPatternSpace::Country: {
+            // No country, or any two letter code
+            QStringList countries("--");
+            for (char a = 'A'; a <= 'Z'; a++) {
+                for (char b = 'A'; b <= 'Z'; b++)
+                    countries.append(QString(QChar(a)) + QChar(b));
+            }
+            return countries;
+        }
+        default:
+            return characters("-ACEGNSX");
+        }
+    }
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+}
+
+SidcPatternSpace::SidcPatternSpace() {
+    for (int slot = 0; slot < SlotCount; slot++)
+        m_values[slot] = defaultValues(slot);
+
+    rebuild();
+}
+
+bool SidcPatternSpace::load(const QString& path, QString* errorMessage /* = nullptr */) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, file.errorString());
+
+    // The files are saved with a byte order mark
+    QByteArray data = file.readAll();
+    if (data.startsWith("\xEF\xBB\xBF"))
+        data.remove(0, 3);
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(data, &parseError);
+    if (document.isNull())
+        return fail(errorMessage, parseError.errorString());
+
+    // Pages are either the document itself or under "sidc"
+    const QJsonArray pages = document.isArray() ? document.array() : document.object().value("sidc").toArray();
+
+    QStringList patterns;
+    for (const QJsonValue& page : pages) {
+        for (const QJsonValue& code : page.toObject().value("codes").toArray()) {
+            if (code.isString() && !code.toString().isEmpty())
+                patterns.append(code.toString());
+        }
+    }
+
+    if (patterns.isEmpty())
+        return fail(errorMessage, QString("No SIDC patterns in %1").arg(path));
+
+    setPatterns(patterns);
+    return true;
+}
+
+void SidcPatternSpace::setPatterns(const QStringList& patterns) {
+    m_patterns = patterns;
+    rebuild();
+}
+
+bool SidcPatternSpace::setFilter(const QString& spec, QString* errorMessage /* = nullptr */) {
+    QStringList values[SlotCount];
+    for (int slot = 0; slot < SlotCount; slot++)
+        values[slot] = defaultValues(slot);
+
+    for (const QString& field : spec.split(';', QString::SkipEmptyParts)) {
+        const int equals = field.indexOf('=');
+        if (equals < 0)
+            return fail(errorMessage, QString("Missing '=' in modifier filter: %1").arg(field));
+
+        const QString name = field.left(equals).trimmed().toLower();
+        const int slot = std::find(SlotNames, SlotNames + SlotCount, name) - SlotNames;
+        if (slot == SlotCount)
+            return fail(errorMessage, QString("Unknown modifier: %1").arg(name));
+
+        QStringList allowed;
+        for (const QString& value : field.mid(equals + 1).split(',', QString::SkipEmptyParts)) {
+            const QString upper = value.trimmed().toUpper();
+            if (upper.length() != SlotWidth[slot])
+                return fail(errorMessage, QString("Invalid %1 value: %2").arg(name, value));
+            allowed.append(upper);
+        }
+
+        if (allowed.isEmpty())
+            return fail(errorMessage, QString("No values for %1").arg(name));
+
+        values[slot] = allowed;
+    }
+
+    for (int slot = 0; slot < SlotCount; slot++)
+        m_values[slot] = values[slot];
+
+    rebuild();
+    return true;
+}
+
+void SidcPatternSpace::setValues(Slot slot, const QStringList& values) {
+    m_values[slot] = values;
+    rebuild();
+}
+
+QStringList SidcPatternSpace::values(Slot slot) const {
+    return m_values[slot];
+}
+
+quint64 SidcPatternSpace::fingerprint() const {
+    QStringList values;
+    for (int slot = 0; slot < SlotCount; slot++)
+        values.append(m_values[slot].join(','));
+
+    return (static_cast<quint64>(qHash(m_patterns)) << 32) ^ qHash(values);
+}
+
+int SidcPatternSpace::patternCount() const {
+    return m_expanded.size();
+}
+
+qint64 SidcPatternSpace::size() const {
+    return m_offsets.last();
+}
+
+QString SidcPatternSpace::at(qint64 index) const {
+    if (index < 0 || index >= size())
+        return QString();
+
+    // Last pattern starting at or before index, among the patterns of its
+    // slice: the first of this slice up to the first of the next
+    const int slice = static_cast<int>(index / m_sliceWidth);
+    const int first = m_slices.at(slice);
+    const int last = slice + 1 < m_slices.size() ? m_slices.at(slice + 1) : m_expanded.size() - 1;
+    const int patternIndex = std::upper_bound(m_offsets.constBegin() + first, m_offsets.constBegin() + last + 1, index) - m_offsets.constBegin() - 1;
+    const Pattern& pattern = m_expanded.at(patternIndex);
+
+    QString code = pattern.code;
+    qint64 local = index - m_offsets.at(patternIndex);
+
+    // The last slot varies fastest
+    for (int i = pattern.slots.size() - 1; i >= 0; i--) {
+        const QStringList& values = pattern.values.at(i);
+        const QString& value = values.at(static_cast<int>(local % values.size()));
+        local /= values.size();
+
+        code.replace(SlotStart[pattern.slots.at(i)], value.length(), value);
+    }
+
+    return code;
+}
+
+QStringList SidcPatternSpace::sample(qint64 start, int count, qint64 stride /* = 1 */) const {
+    QStringList codes;
+    codes.reserve(count);
+
+    stride = qMax<qint64>(1, stride);
+    for (qint64 index = start; index < size() && codes.size() < count; index += stride)
+        codes.append(at(index));
+
+    return codes;
+}
+
+void SidcPatternSpace::rebuild() {
+    m_expanded.clear();
+    m_offsets.clear();
+    m_offsets.append(0);
+
+    for (const QString& source : m_patterns) {
+        Pattern pattern;
+
+        // Short codes leave the remaining modifiers unset
+        pattern.code = source.left(CodeLength).toUpper().leftJustified(CodeLength, '-');
+
+        for (int slot = 0; slot < SlotCount; slot++) {
+            const QString fixed = pattern.code.mid(SlotStart[slot], SlotWidth[slot]);
+            if (!fixed.contains('*'))
+                continue;
+
+            // Keep the values that agree with the positions not wildcarded
+            QStringList values;
+            for (const QString& value : m_values[slot]) {
+                bool matches = true;
+                for (int i = 0; i < fixed.length(); i++)
+                    matches = matches && (fixed.at(i) == '*' || fixed.at(i) == value.at(i));
+                if (matches)
+                    values.append(value);
+            }
+
+            pattern.slots.append(slot);
+            pattern.values.append(values);
+            pattern.count *= values.size();
+        }
+
+        // Filtered out entirely
+        if (pattern.count == 0)
+            continue;
+
+        m_expanded.append(pattern);
+        m_offsets.append(m_offsets.last() + pattern.count);
+    }
+
+    m_slices.clear();
+    const qint64 total = m_offsets.last();
+    const qint64 sliceCount = qMax(1, m_expanded.size() * 4);
+    m_sliceWidth = qMax<qint64>(1, (total + sliceCount - 1) / sliceCount);
+
+    int pattern = 0;
+    for (qint64 start = 0; start < total; start += m_sliceWidth) {
+        while (m_offsets.at(pattern + 1) <= start)
+            pattern++;
+        m_slices.append(pattern);
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SIDCPATTERNSPACE_H
+#define SIDCPATTERNSPACE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// The codes described by SIDC.json patterns such as "SUPP------*****",
+// where '*' marks modifier positions that take any value. The expansion
+// is never materialized: a code is decoded from its index on demand, so
+// the space can be sliced, sampled or iterated at any size.
+//
+// The wildcards are grouped into the modifier slots of a 2525C code, whose
+// values can be restricted with a filter such as
+//   "modifier=-,A;echelon=D,E,F;country=--,US,GB;order=-"
+class SidcPatternSpace
+{
+public:
+    enum Slot {
+        Modifier,       // position 10, headquarters, task force, feint
+        Echelon,        // position 11
+        Country,        // positions 12 and 13
+        OrderOfBattle,  // position 14
+        SlotCount
+    };
+
+    SidcPatternSpace();
+
+    // Reads the patterns of every page of a SIDC.json file
+    bool load(const QString& path, QString* errorMessage = nullptr);
+    void setPatterns(const QStringList& patterns);
+
+    bool setFilter(const QString& spec, QString* errorMessage = nullptr);
+    void setValues(Slot slot, const QStringList& values);
+    QStringList values(Slot slot) const;
+
+    int patternCount() const;
+    qint64 size() const;
+
+    // Changes with the patterns or the slot values, so with the codes
+    quint64 fingerprint() const;
+
+    // Code at an index of the expanded space, a lookup of its slice of the
+    // index space and a mixed radix decode of the wildcards
+    QString at(qint64 index) const;
+
+    // count codes from start, every stride codes
+    QStringList sample(qint64 start, int count, qint64 stride = 1) const;
+
+    class const_iterator
+    {
+    public:
+        const_iterator(const SidcPatternSpace* space, qint64 index) : m_space(space), m_index(index) {}
+
+        QString operator*() const { return m_space->at(m_index); }
+        const_iterator& operator++() { m_index++; return *this; }
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        const SidcPatternSpace* m_space;
+        qint64 m_index;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+private:
+    struct Pattern {
+        QString code;
+        QVector<int> slots;
+
+        // Values of each wildcard slot that agree with its fixed positions
+        QVector<QStringList> values;
+        qint64 count = 1;
+    };
+
+    void rebuild();
+
+    QStringList m_patterns;
+    QStringList m_values[SlotCount];
+
+    QVector<Pattern> m_expanded;
+
+    // First index of every pattern, plus the total size
+    QVector<qint64> m_offsets;
+
+    // First pattern of every slice of the index space, with four slices
+    // per pattern, so most slices hold one or two patterns
+    QVector<int> m_slices;
+    qint64 m_sliceWidth = 1;
+};
+
+#endif // SIDCPATTERNSPACE_H
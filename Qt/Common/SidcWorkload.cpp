@@ -0,0 +1,242 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QFile>
+#include <QTextStream>
+
+#include <algorithm>
+
+#include "SidcWorkload.h"
+
+namespace {
+    const QString Affiliations = QStringLiteral("PUAFNSHGWMDLJK");
+    const QString Statuses = QStringLiteral("APCDXF");
+    const QString Echelons = QStringLiteral("-ABCDEFGHIJKLM");
+
+    const QString DefaultAffiliations = QStringLiteral("FHNU");
+    const QString DefaultStatuses = QStringLiteral("AP");
+
+    const int AffiliationPosition = 1;
+    const int DimensionPosition = 2;
+    const int StatusPosition = 3;
+    const int EchelonPosition = 11;
+
+    // splitmix64, a counter based generator: each draw only depends on the
+    // seed, the code index and the draw number
+    quint64 mix(quint64 x) {
+        x += Q_UINT64_C(0x9E3779B97F4A7C15);
+        x = (x ^ (x >> 30)) * Q_UINT64_C(0xBF58476D1CE4E5B9);
+        x = (x ^ (x >> 27)) * Q_UINT64_C(0x94D049BB133111EB);
+        return x ^ (x >> 31);
+    }
+
+    double uniform(quint64 state, int draw) {
+        // 53 random bits in [0, 1)
+        return (mix(state + static_cast<quint64>(draw) * Q_UINT64_C(0x9E3779B97F4A7C15)) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    QList<QPair<QChar, double>> uniformWeights(const QString& values) {
+        QList<QPair<QChar, double>> weights;
+        for (QChar value : values)
+            weights.append(qMakePair(value, 1.0));
+        return weights;
+    }
+}
+
+void SidcWorkload::Weights::set(const QList<QPair<QChar, double>>& weights) {
+    values.clear();
+    cumulative.clear();
+
+    double total = 0.0;
+    for (const auto& weight : weights) {
+        if (weight.second <= 0.0)
+            continue;
+
+        total += weight.second;
+        values.append(weight.first);
+        cumulative.append(total);
+    }
+
+    for (double& c : cumulative)
+        c /= total;
+}
+
+QChar SidcWorkload::Weights::pick(double u) const {
+    auto it = std::upper_bound(cumulative.constBegin(), cumulative.constEnd(), u);
+    const int index = qMin(static_cast<int>(it - cumulative.constBegin()), values.size() - 1);
+    return values.at(index);
+}
+
+SidcWorkload::SidcWorkload(quint32 seed /* = 0 */):
+    m_seed(seed)
+{
+    setTemplates(defaultTemplates());
+}
+
+void SidcWorkload::setSeed(quint32 seed) {
+    m_seed = seed;
+}
+
+quint32 SidcWorkload::seed() const {
+    return m_seed;
+}
+
+quint64 SidcWorkload::fingerprint() const {
+    // The templates in a fixed order, then the weights of every field
+    QList<QChar> dimensions = m_templates.keys();
+    std::sort(dimensions.begin(), dimensions.end());
+
+    QStringList parts;
+    for (QChar dimension : dimensions)
+        parts.append(m_templates.value(dimension).join(','));
+
+    for (const Weights* weights : { &m_affiliation, &m_dimension, &m_status, &m_echelon }) {
+        QString field;
+        for (int i = 0; i < weights->values.size(); i++)
+            field += QString("%1:%2,").arg(weights->values.at(i)).arg(weights->cumulative.at(i));
+        parts.append(field);
+    }
+
+    return (static_cast<quint64>(m_seed) << 32) ^ qHash(parts);
+}
+
+void SidcWorkload::setTemplates(const QStringList& templates) {
+    m_templates.clear();
+
+    for (const QString& code : templates) {
+        if (code.length() < 10)
+            continue;
+        m_templates[code.at(DimensionPosition)].append(code.left(10));
+    }
+
+    resetWeights();
+}
+
+QStringList SidcWorkload::defaultTemplates() {
+    QStringList templates;
+
+    QFile file(QStringLiteral(":/data/sidc_templates.txt"));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return templates;
+
+    QTextStream stream(&file);
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+        templates.append(line);
+    }
+
+    return templates;
+}
+
+void SidcWorkload::resetWeights() {
+    m_affiliation.set(uniformWeights(DefaultAffiliations));
+    m_status.set(uniformWeights(DefaultStatuses));
+    m_echelon.set(uniformWeights(Echelons));
+
+    // Follow the catalog mix of battle dimensions
+    QList<QPair<QChar, double>> dimensions;
+    for (auto it = m_templates.constBegin(); it != m_templates.constEnd(); ++it)
+        dimensions.append(qMakePair(it.key(), static_cast<double>(it.value().size())));
+    std::sort(dimensions.begin(), dimensions.end());
+    m_dimension.set(dimensions);
+}
+
+bool SidcWorkload::setDistribution(const QString& spec, QString* errorMessage /* = nullptr */) {
+    resetWeights();
+
+    const QString trimmed = spec.trimmed();
+    if (trimmed.isEmpty() || trimmed.compare(QStringLiteral("catalog"), Qt::CaseInsensitive) == 0)
+        return true;
+
+    auto fail = [errorMessage](const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    };
+
+    for (const QString& field : trimmed.split(';', QString::SkipEmptyParts)) {
+        const int equals = field.indexOf('=');
+        if (equals < 0)
+            return fail(QString("Missing '=' in distribution field: %1").arg(field));
+
+        const QString name = field.left(equals).trimmed().toLower();
+        const QString allowed = name == "affiliation" ? Affiliations
+                              : name == "status" ? Statuses
+                              : name == "echelon" ? Echelons
+                              : QString();
+
+        Weights* target = name == "affiliation" ? &m_affiliation
+                        : name == "dimension" ? &m_dimension
+                        : name == "status" ? &m_status
+                        : name == "echelon" ? &m_echelon
+                        : nullptr;
+
+        if (!target)
+            return fail(QString("Unknown distribution field: %1").arg(name));
+
+        QList<QPair<QChar, double>> weights;
+        for (const QString& entry : field.mid(equals + 1).split(',', QString::SkipEmptyParts)) {
+            const QStringList parts = entry.trimmed().split(':');
+            const QString value = parts.first().toUpper();
+
+            bool ok = true;
+            const double weight = parts.size() > 1 ? parts.at(1).toDouble(&ok) : 1.0;
+
+            if (value.length() != 1 || !ok || weight < 0.0)
+                return fail(QString("Invalid %1 weight: %2").arg(name, entry));
+
+            const bool known = name == "dimension" ? m_templates.contains(value.at(0)) : allowed.contains(value.at(0));
+            if (!known)
+                return fail(QString("Unknown %1 value: %2").arg(name, value));
+
+            weights.append(qMakePair(value.at(0), weight));
+        }
+
+        target->set(weights);
+        if (target->isEmpty())
+            return fail(QString("No positive weights for %1").arg(name));
+    }
+
+    return true;
+}
+
+QString SidcWorkload::code(qint64 index) const {
+    if (m_dimension.isEmpty())
+        return QString();
+
+    const quint64 state = mix(static_cast<quint64>(m_seed) ^ mix(static_cast<quint64>(index)));
+
+    const QStringList& templates = m_templates[m_dimension.pick(uniform(state, 0))];
+    const int pick = qMin(static_cast<int>(uniform(state, 1) * templates.size()), templates.size() - 1);
+
+    QString sidc = templates.at(pick) + QStringLiteral("-----");
+    sidc[AffiliationPosition] = m_affiliation.pick(uniform(state, 2));
+    sidc[StatusPosition] = m_status.pick(uniform(state, 3));
+
+    // Echelons only apply to warfighting ground units
+    if (sidc.at(0) == 'S' && sidc.at(DimensionPosition) == 'G' && sidc.at(4) == 'U')
+        sidc[EchelonPosition] = m_echelon.pick(uniform(state, 4));
+
+    return sidc;
+}
+
+QStringList SidcWorkload::generate(int count, qint64 skip /* = 0 */) const {
+    QStringList codes;
+    codes.reserve(count);
+
+    for (int i = 0; i < count; i++)
+        codes.append(code(skip + i));
+
+    return codes;
+}
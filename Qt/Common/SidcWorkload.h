@@ -0,0 +1,74 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SIDCWORKLOAD_H
+#define SIDCWORKLOAD_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// Generates synthetic, valid 15 character MIL-STD-2525C SIDCs from the
+// function ID templates of the catalog.
+//
+// Every code is derived from the seed and its index only, so a workload
+// can be skipped into or generated in parallel and is always reproducible.
+//
+// The distribution spec weights the generated fields, e.g.
+//   "affiliation=F:4,H:4,N:1,U:1;dimension=G:6,A:2,S:1;status=P:9,A:1;echelon=-:2,D:1,E:1"
+// Fields that are not named keep their defaults: affiliations, status and
+// echelons are uniform and battle dimensions follow the catalog mix.
+class SidcWorkload
+{
+public:
+    explicit SidcWorkload(quint32 seed = 0);
+
+    void setSeed(quint32 seed);
+    quint32 seed() const;
+
+    bool setDistribution(const QString& spec, QString* errorMessage = nullptr);
+
+    // 10 character code prefixes; the affiliation and status are replaced
+    void setTemplates(const QStringList& templates);
+    static QStringList defaultTemplates();
+
+    QString code(qint64 index) const;
+    QStringList generate(int count, qint64 skip = 0) const;
+
+    // Changes with the seed, templates or distribution, so with the codes
+    quint64 fingerprint() const;
+
+private:
+    struct Weights {
+        QVector<QChar> values;
+        QVector<double> cumulative;
+
+        void set(const QList<QPair<QChar, double>>& weights);
+        QChar pick(double u) const;
+        bool isEmpty() const { return values.isEmpty(); }
+    };
+
+    void resetWeights();
+
+    quint32 m_seed = 0;
+
+    QHash<QChar, QStringList> m_templates;
+
+    Weights m_affiliation;
+    Weights m_dimension;
+    Weights m_status;
+    Weights m_echelon;
+};
+
+#endif // SIDCWORKLOAD_H
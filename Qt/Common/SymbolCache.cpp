@@ -0,0 +1,170 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QMutexLocker>
+
+#include "SharedSymbolCache.h"
+#include "SymbolCache.h"
+
+SymbolCache::SymbolCache():
+    m_hits(0),
+    m_misses(0),
+    m_evictions(0),
+    m_sharedHits(0)
+{
+}
+
+QString SymbolCache::resolve(const QString& sidc, const std::function<QString()>& resolve) {
+    const QString cached = find(sidc);
+    if (!cached.isNull())
+        return cached;
+
+    // Resolve outside the lock, the dictionary lookup is the slow part
+    m_misses.ref();
+    const QString json = resolve();
+    insert(sidc, json);
+
+    if (m_shared)
+        m_shared->insert(sidc, json);
+
+    return json;
+}
+
+QString SymbolCache::find(const QString& sidc) {
+    {
+        QMutexLocker lock(&m_mutex);
+        auto it = m_symbols.find(sidc);
+        if (it != m_symbols.end()) {
+            m_hits.ref();
+            m_order.splice(m_order.begin(), m_order, it->position);
+            return it->json;
+        }
+    }
+
+    // Another instance may have resolved it already, the shared cache
+    // reads without a lock
+    if (m_shared) {
+        const QString json = m_shared->find(sidc);
+        if (!json.isNull()) {
+            m_hits.ref();
+            m_sharedHits.ref();
+            insert(sidc, json);
+            return json;
+        }
+    }
+
+    return QString();
+}
+
+bool SymbolCache::contains(const QString& sidc) const {
+    QMutexLocker lock(&m_mutex);
+    return m_symbols.contains(sidc);
+}
+
+void SymbolCache::insert(const QString& sidc, const QString& json) {
+    QMutexLocker lock(&m_mutex);
+
+    auto it = m_symbols.find(sidc);
+    if (it != m_symbols.end()) {
+        m_bytes += (json.size() - it->json.size()) * sizeof(QChar);
+        it->json = json;
+        m_order.splice(m_order.begin(), m_order, it->position);
+    }
+    else {
+        m_order.push_front(sidc);
+
+        Entry entry;
+        entry.json = json;
+        entry.position = m_order.begin();
+        m_symbols.insert(sidc, entry);
+        m_bytes += json.size() * sizeof(QChar);
+    }
+
+    evict();
+}
+
+void SymbolCache::remove(const QString& sidc) {
+    QMutexLocker lock(&m_mutex);
+
+    auto it = m_symbols.find(sidc);
+    if (it == m_symbols.end())
+        return;
+
+    m_bytes -= it->json.size() * sizeof(QChar);
+    m_order.erase(it->position);
+    m_symbols.erase(it);
+}
+
+void SymbolCache::clear() {
+    QMutexLocker lock(&m_mutex);
+    m_symbols.clear();
+    m_order.clear();
+    m_bytes = 0;
+}
+
+void SymbolCache::setShared(SharedSymbolCache* shared) {
+    m_shared = shared;
+}
+
+QHash<QString, QString> SymbolCache::symbols() const {
+    QMutexLocker lock(&m_mutex);
+
+    QHash<QString, QString> symbols;
+    symbols.reserve(m_symbols.size());
+    for (auto it = m_symbols.constBegin(); it != m_symbols.constEnd(); ++it)
+        symbols.insert(it.key(), it->json);
+
+    return symbols;
+}
+
+void SymbolCache::setBudget(qint64 bytes) {
+    QMutexLocker lock(&m_mutex);
+    m_budget = qMax<qint64>(0, bytes);
+    evict();
+}
+
+qint64 SymbolCache::bytes() const {
+    QMutexLocker lock(&m_mutex);
+    return m_bytes;
+}
+
+void SymbolCache::evict() {
+    // Called with the mutex held, the newest symbol always stays
+    while (m_budget > 0 && m_bytes > m_budget && m_order.size() > 1) {
+        auto it = m_symbols.find(m_order.back());
+        m_bytes -= it->json.size() * sizeof(QChar);
+        m_symbols.erase(it);
+        m_order.pop_back();
+        m_evictions.ref();
+    }
+}
+
+int SymbolCache::size() const {
+    QMutexLocker lock(&m_mutex);
+    return m_symbols.size();
+}
+
+int SymbolCache::hits() const {
+    return m_hits.load();
+}
+
+int SymbolCache::misses() const {
+    return m_misses.load();
+}
+
+int SymbolCache::evictions() const {
+    return m_evictions.load();
+}
+
+int SymbolCache::sharedHits() const {
+    return m_sharedHits.load();
+}
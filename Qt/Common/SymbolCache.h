@@ -0,0 +1,88 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLCACHE_H
+#define SYMBOLCACHE_H
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <functional>
+#include <list>
+
+class SharedSymbolCache;
+
+// Resolved symbol JSON keyed by SIDC, so each code is only resolved
+// against the dictionary style once. With a shared cache, a miss is
+// looked up there before it is resolved, and what is resolved is
+// published there for the other instances.
+class SymbolCache
+{
+public:
+    SymbolCache();
+
+    // Returns the cached JSON for sidc, or calls resolve and caches its result
+    QString resolve(const QString& sidc, const std::function<QString()>& resolve);
+
+    // The cached JSON for sidc, local or shared, or a null string
+    QString find(const QString& sidc);
+
+    bool contains(const QString& sidc) const;
+    void insert(const QString& sidc, const QString& json);
+    void remove(const QString& sidc);
+    void clear();
+
+    // Not owned, nullptr to resolve every miss
+    void setShared(SharedSymbolCache* shared);
+
+    // Copy of every cached entry
+    QHash<QString, QString> symbols() const;
+
+    // Evicts the least recently used symbols beyond this many bytes of
+    // JSON, 0 keeps every symbol
+    void setBudget(qint64 bytes);
+    qint64 bytes() const;
+
+    int size() const;
+    int hits() const;
+    int misses() const;
+    int evictions() const;
+
+    // Misses found in the shared cache, counted as hits as well
+    int sharedHits() const;
+
+private:
+    struct Entry {
+        QString json;
+        std::list<QString>::iterator position;
+    };
+
+    void evict();
+
+    mutable QMutex m_mutex;
+    QHash<QString, Entry> m_symbols;
+
+    // Most recently used first
+    std::list<QString> m_order;
+    qint64 m_budget = 0;
+    qint64 m_bytes = 0;
+
+    SharedSymbolCache* m_shared = nullptr;
+
+    QAtomicInt m_hits;
+    QAtomicInt m_misses;
+    QAtomicInt m_evictions;
+    QAtomicInt m_sharedHits;
+};
+
+#endif // SYMBOLCACHE_H
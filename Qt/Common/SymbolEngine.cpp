@@ -0,0 +1,19 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "SymbolEngine.h"
+
+// Both configurations are compiled with the library, whichever app is
+// built. The members are inline, so each app still instantiates the ones
+// it calls.
+template class SymbolEngine<Wgs84Policy, GridLayout>;
+template class SymbolEngine<WebMercatorPolicy, PageLayout>;
@@ -0,0 +1,210 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLENGINE_H
+#define SYMBOLENGINE_H
+
+#include "Feature.h"
+#include "FeatureCollection.h"
+#include "FeatureCollectionLayer.h"
+#include "FeatureCollectionTable.h"
+#include "Map.h"
+#include "MultilayerPointSymbol.h"
+#include "Point.h"
+#include "SpatialReference.h"
+#include "UniqueValueRenderer.h"
+
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <QVector>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+// Spatial reference policies, the spatial reference of the tables and of
+// every feature placed in them
+
+struct Wgs84Policy {
+    static Esri::ArcGISRuntime::SpatialReference spatialReference() { return Esri::ArcGISRuntime::SpatialReference::wgs84(); }
+};
+
+struct WebMercatorPolicy {
+    static Esri::ArcGISRuntime::SpatialReference spatialReference() { return Esri::ArcGISRuntime::SpatialReference::webMercator(); }
+};
+
+// Layout policies, the position of the code at an index of the catalog
+
+// Columns of a square grid over an extent, north to south
+class GridLayout
+{
+public:
+    GridLayout(const QRectF& extent, int count):
+        m_extent(extent.normalized()),
+        m_spacing(m_extent.width() / std::max(1.0, std::ceil(std::sqrt(static_cast<double>(count))))),
+        m_rows(m_spacing > 0.0 ? static_cast<int>(std::floor(m_extent.height() / m_spacing)) + 1 : 1),
+        m_columns(m_spacing > 0.0 ? static_cast<int>(std::floor(m_extent.width() / m_spacing)) + 1 : 1)
+    {
+    }
+
+    double spacing() const { return m_spacing; }
+    int capacity() const { return m_rows * m_columns; }
+
+    // bottom() is the max y of a QRectF
+    QPointF position(int index) const {
+        return QPointF(m_extent.left() + (index / m_rows) * m_spacing, m_extent.bottom() - (index % m_rows) * m_spacing);
+    }
+
+private:
+    QRectF m_extent;
+    double m_spacing;
+    int m_rows;
+    int m_columns;
+};
+
+// Pages of rows of columns, the pages side by side
+class PageLayout
+{
+public:
+    PageLayout(const QPointF& origin, int pageSize, int columns = 4, double spacing = 100.0, double pageStride = 500.0):
+        m_origin(origin),
+        m_pageSize(std::max(1, pageSize)),
+        m_columns(std::max(1, columns)),
+        m_spacing(spacing),
+        m_pageStride(pageStride)
+    {
+    }
+
+    double spacing() const { return m_spacing; }
+    int capacity() const { return INT_MAX; }
+
+    QPointF position(int index) const {
+        const int page = index / m_pageSize;
+        const int slot = index % m_pageSize;
+        return QPointF(m_origin.x() + (page * m_pageStride) + ((slot % m_columns) * m_spacing), m_origin.y() - ((slot / m_columns) * m_spacing));
+    }
+
+private:
+    QPointF m_origin;
+    int m_pageSize;
+    int m_columns;
+    double m_spacing;
+    double m_pageStride;
+};
+
+// The per feature and per symbol work of a pair of symbol tables, one
+// drawn by the dictionary renderer and one by a unique value renderer,
+// specialized at compile time for the spatial reference and layout of an
+// app. Both apps clone the unique value symbols from JSON and size
+// them in place, so the renderer is not a policy.
+template <typename SpatialReferencePolicy, typename LayoutPolicy>
+class SymbolEngine
+{
+public:
+    struct Features {
+        Esri::ArcGISRuntime::Feature* dFeature = nullptr;
+        Esri::ArcGISRuntime::Feature* uFeature = nullptr;
+    };
+
+    // The collection of each renderer and its layer. As in the original
+    // samples the dictionary tables go in uCollection, drawn by uLayer,
+    // and the unique value tables in dCollection, drawn by dLayer.
+    struct Layers {
+        Esri::ArcGISRuntime::FeatureCollection* dCollection = nullptr;
+        Esri::ArcGISRuntime::FeatureCollection* uCollection = nullptr;
+        Esri::ArcGISRuntime::FeatureCollectionLayer* dLayer = nullptr;
+        Esri::ArcGISRuntime::FeatureCollectionLayer* uLayer = nullptr;
+    };
+
+    // Both collections, still without tables, on top of the map, dLayer first
+    static Layers createLayers(Esri::ArcGISRuntime::Map* map, QObject* parent) {
+        Layers layers;
+        layers.uCollection = new Esri::ArcGISRuntime::FeatureCollection(parent);
+        layers.dCollection = new Esri::ArcGISRuntime::FeatureCollection(parent);
+
+        layers.dLayer = new Esri::ArcGISRuntime::FeatureCollectionLayer(layers.dCollection, parent);
+        layers.uLayer = new Esri::ArcGISRuntime::FeatureCollectionLayer(layers.uCollection, parent);
+        map->operationalLayers()->append(layers.dLayer);
+        map->operationalLayers()->append(layers.uLayer);
+
+        return layers;
+    }
+
+    // A pair of tables, each into the collection of its renderer
+    static void addTables(const Layers& layers, Esri::ArcGISRuntime::FeatureCollectionTable* dTable, Esri::ArcGISRuntime::FeatureCollectionTable* uTable) {
+        layers.uCollection->tables()->append(dTable);
+        layers.dCollection->tables()->append(uTable);
+    }
+
+    // Point table with one text field for the codes
+    static Esri::ArcGISRuntime::FeatureCollectionTable* createTable(const QString& fieldName, QObject* parent) {
+        QList<Esri::ArcGISRuntime::Field> fields;
+        fields.push_back(Esri::ArcGISRuntime::Field::createText(fieldName, fieldName, 15));
+
+        return new Esri::ArcGISRuntime::FeatureCollectionTable(fields, Esri::ArcGISRuntime::GeometryType::Point, SpatialReferencePolicy::spatialReference(), parent);
+    }
+
+    // Positions of the first count codes, fewer if the layout is full
+    static QVector<QPointF> layout(const LayoutPolicy& layout, int count) {
+        QVector<QPointF> positions;
+        positions.reserve(std::min(count, layout.capacity()));
+
+        for (int index = 0; index < count && index < layout.capacity(); index++)
+            positions.append(layout.position(index));
+
+        return positions;
+    }
+
+    // Creates a feature of the code in each table and adds it
+    static Features addFeatures(Esri::ArcGISRuntime::FeatureCollectionTable* dTable, Esri::ArcGISRuntime::FeatureCollectionTable* uTable,
+                                const QString& fieldName, const QString& sidc, const QPointF& dPosition, const QPointF& uPosition, QObject* parent) {
+        const Esri::ArcGISRuntime::SpatialReference spatialReference = SpatialReferencePolicy::spatialReference();
+
+        Features features;
+        features.dFeature = dTable->createFeature(parent);
+        features.uFeature = uTable->createFeature(parent);
+
+        features.dFeature->setGeometry(Esri::ArcGISRuntime::Point(dPosition.x(), dPosition.y(), spatialReference));
+        features.uFeature->setGeometry(Esri::ArcGISRuntime::Point(uPosition.x(), uPosition.y(), spatialReference));
+
+        features.dFeature->attributes()->replaceAttribute(fieldName, sidc);
+        features.uFeature->attributes()->replaceAttribute(fieldName, sidc);
+
+        dTable->addFeature(features.dFeature);
+        uTable->addFeature(features.uFeature);
+
+        return features;
+    }
+
+    // Unique value symbol from the JSON of a dictionary symbol, so no
+    // symbol of the dictionary is shared
+    static Esri::ArcGISRuntime::MultilayerPointSymbol* uniqueValueSymbol(const QString& json, QObject* parent) {
+        return static_cast<Esri::ArcGISRuntime::MultilayerPointSymbol*>(Esri::ArcGISRuntime::MultilayerPointSymbol::fromJson(json, parent));
+    }
+
+    // Every unique value symbol resized where it is
+    static void resize(Esri::ArcGISRuntime::UniqueValueRenderer* renderer, int size) {
+        for (int i = 0; i < renderer->uniqueValues()->size(); i++) {
+            Esri::ArcGISRuntime::UniqueValue* value = renderer->uniqueValues()->at(i);
+            Esri::ArcGISRuntime::MultilayerPointSymbol* symbol = static_cast<Esri::ArcGISRuntime::MultilayerPointSymbol*>(value->symbol());
+            symbol->setSize(size);
+            value->setSymbol(symbol);
+        }
+    }
+};
+
+// The configurations of the apps
+typedef SymbolEngine<Wgs84Policy, GridLayout> CatalogSymbolEngine;
+typedef SymbolEngine<WebMercatorPolicy, PageLayout> PageSymbolEngine;
+
+#endif // SYMBOLENGINE_H
@@ -0,0 +1,109 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "Feature.h"
+#include "FeatureCollectionLayer.h"
+#include "FeatureLayer.h"
+
+#include <QHash>
+
+#include "SymbolFilter.h"
+
+using namespace Esri::ArcGISRuntime;
+
+SymbolFilter::SymbolFilter()
+{
+}
+
+int SymbolFilter::addSymbol(const QString& sidc, const QList<Feature*>& features) {
+    // Ordinals of removed symbols are used again, so evicting and showing
+    // the same features again does not grow the filter
+    int ordinal = m_features.size();
+    if (!m_freeOrdinals.isEmpty()) {
+        ordinal = m_freeOrdinals.takeLast();
+        m_features[ordinal] = features;
+    } else {
+        m_features.append(features);
+    }
+
+    m_index.add(static_cast<quint32>(ordinal), sidc);
+
+    // New features are drawn until the next filter is applied
+    m_visible.add(static_cast<quint32>(ordinal));
+
+    return ordinal;
+}
+
+void SymbolFilter::removeSymbol(int ordinal) {
+    if (ordinal < 0 || ordinal >= m_features.size() || !m_index.all().contains(static_cast<quint32>(ordinal)))
+        return;
+
+    m_index.remove(static_cast<quint32>(ordinal));
+    m_visible.remove(static_cast<quint32>(ordinal));
+    m_features[ordinal].clear();
+    m_freeOrdinals.append(ordinal);
+}
+
+void SymbolFilter::clear() {
+    m_index.clear();
+    m_features.clear();
+    m_freeOrdinals.clear();
+    m_visible.clear();
+}
+
+bool SymbolFilter::apply(const QString& expression, const QList<FeatureCollectionLayer*>& layers, QString* errorMessage /* = nullptr */) {
+    CompressedBitmap matches;
+    if (!m_index.evaluate(expression, &matches, errorMessage))
+        return false;
+
+    // Only the difference to the current state is sent to the layers
+    QHash<FeatureTable*, QList<Feature*>> hide;
+    QHash<FeatureTable*, QList<Feature*>> show;
+
+    m_visible.andNot(matches).forEach([this, &hide](quint32 ordinal) {
+        for (Feature* feature : m_features.at(ordinal))
+            hide[feature->featureTable()].append(feature);
+    });
+
+    matches.andNot(m_visible).forEach([this, &show](quint32 ordinal) {
+        for (Feature* feature : m_features.at(ordinal))
+            show[feature->featureTable()].append(feature);
+    });
+
+    for (FeatureCollectionLayer* collectionLayer : layers) {
+        for (FeatureLayer* layer : collectionLayer->layers()) {
+            FeatureTable* table = layer->featureTable();
+
+            if (hide.contains(table))
+                layer->setFeaturesVisible(hide.value(table), false);
+            if (show.contains(table))
+                layer->setFeaturesVisible(show.value(table), true);
+        }
+    }
+
+    m_visible = matches;
+    m_expression = expression;
+
+    return true;
+}
+
+bool SymbolFilter::isVisible(int ordinal) const {
+    return ordinal < 0 || m_visible.contains(static_cast<quint32>(ordinal));
+}
+
+QString SymbolFilter::expression() const {
+    return m_expression;
+}
+
+int SymbolFilter::visibleCount() const {
+    return m_visible.cardinality();
+}
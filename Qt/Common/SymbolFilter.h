@@ -0,0 +1,59 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLFILTER_H
+#define SYMBOLFILTER_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class Feature;
+        class FeatureCollectionLayer;
+    }
+}
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+#include "CompressedBitmap.h"
+#include "SidcBitmapIndex.h"
+
+// Shows only the symbols matching a SidcBitmapIndex filter expression.
+// Each symbol may be drawn by features in several tables; only the
+// features whose visibility changes are passed to their layers, so the
+// tables and renderers are never rebuilt.
+class SymbolFilter
+{
+public:
+    SymbolFilter();
+
+    // Returns the ordinal of the symbol, possibly one freed by removeSymbol
+    int addSymbol(const QString& sidc, const QList<Esri::ArcGISRuntime::Feature*>& features);
+    void removeSymbol(int ordinal);
+    void clear();
+
+    bool apply(const QString& expression, const QList<Esri::ArcGISRuntime::FeatureCollectionLayer*>& layers, QString* errorMessage = nullptr);
+
+    bool isVisible(int ordinal) const;
+
+    QString expression() const;
+    int visibleCount() const;
+
+private:
+    SidcBitmapIndex m_index;
+    QVector<QList<Esri::ArcGISRuntime::Feature*>> m_features;
+    QVector<int> m_freeOrdinals;
+    CompressedBitmap m_visible;
+    QString m_expression;
+};
+
+#endif // SYMBOLFILTER_H
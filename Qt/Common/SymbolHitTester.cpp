@@ -0,0 +1,110 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <cmath>
+
+#include "SymbolHitTester.h"
+
+using namespace Esri::ArcGISRuntime;
+
+namespace {
+    // Symbol size of a group that has not been sized yet
+    const double DefaultSymbolSize = 44.0;
+}
+
+SymbolHitTester::SymbolHitTester()
+{
+}
+
+void SymbolHitTester::addFeature(Feature* feature, const QString& sidc, double x, double y, int group /* = 0 */, int symbol /* = -1 */) {
+    if (group < 0)
+        return;
+
+    ensureGroup(group);
+
+    Entry entry = { feature, sidc, group, symbol };
+    m_index.insert(x, y, entry);
+}
+
+bool SymbolHitTester::removeFeature(Feature* feature, double x, double y) {
+    Entry entry = { feature, QString(), 0, -1 };
+    return m_index.remove(x, y, entry);
+}
+
+void SymbolHitTester::clear() {
+    m_index.clear();
+}
+
+int SymbolHitTester::size() const {
+    return m_index.size();
+}
+
+void SymbolHitTester::setGroupSymbolSize(int group, double pixels) {
+    if (group < 0)
+        return;
+
+    ensureGroup(group);
+    m_groupSizes[group] = pixels;
+}
+
+double SymbolHitTester::groupSymbolSize(int group) const {
+    return group >= 0 && group < m_groupSizes.size() ? m_groupSizes.at(group) : DefaultSymbolSize;
+}
+
+void SymbolHitTester::setGroupVisible(int group, bool visible) {
+    if (group >= 0 && group < m_groupVisible.size())
+        m_groupVisible[group] = visible;
+}
+
+void SymbolHitTester::ensureGroup(int group) {
+    while (m_groupSizes.size() <= group) {
+        m_groupSizes.append(DefaultSymbolSize);
+        m_groupVisible.append(true);
+    }
+}
+
+SymbolHitTester::Hit SymbolHitTester::hitTest(double x, double y, double unitsPerPixel, const std::function<bool(int symbol)>& accept /* = nullptr */) const {
+    Hit hit;
+
+    double largest = 0.0;
+    for (int group = 0; group < m_groupSizes.size(); group++) {
+        if (m_groupVisible.at(group))
+            largest = qMax(largest, m_groupSizes.at(group));
+    }
+
+    if (largest <= 0.0 || unitsPerPixel <= 0.0)
+        return hit;
+
+    // Only symbols within half of the largest symbol can cover the point,
+    // of those take the closest one whose own extent covers it
+    const double radius = largest * 0.5 * unitsPerPixel;
+    const QuadTree<Entry>::Item* item = m_index.nearest(x, y, radius * std::sqrt(2.0), [&](const QuadTree<Entry>::Item& candidate) {
+        const int group = candidate.value.group;
+        if (!m_groupVisible.at(group))
+            return false;
+
+        if (accept && !accept(candidate.value.symbol))
+            return false;
+
+        const double halfSize = m_groupSizes.at(group) * 0.5 * unitsPerPixel;
+        return std::abs(candidate.x - x) <= halfSize && std::abs(candidate.y - y) <= halfSize;
+    });
+
+    if (item) {
+        hit.feature = item->value.feature;
+        hit.sidc = item->value.sidc;
+        hit.group = item->value.group;
+        hit.symbol = item->value.symbol;
+    }
+
+    return hit;
+}
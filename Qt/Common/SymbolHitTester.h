@@ -0,0 +1,82 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLHITTESTER_H
+#define SYMBOLHITTESTER_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class Feature;
+    }
+}
+
+#include <QString>
+#include <QVector>
+#include <functional>
+
+#include "QuadTree.h"
+
+// Resolves clicks and hovers to the symbol under the cursor from a local
+// quadtree over the feature positions, instead of identifying every
+// feature of the layers.
+//
+// Features are registered in groups (one per layer) that share a symbol
+// size in pixels, so resizing the symbols of a layer does not touch the
+// index.
+class SymbolHitTester
+{
+public:
+    struct Hit {
+        Esri::ArcGISRuntime::Feature* feature = nullptr;
+        QString sidc;
+        int group = -1;
+        int symbol = -1;
+
+        bool isValid() const { return feature != nullptr; }
+    };
+
+    SymbolHitTester();
+
+    // symbol is an app defined ordinal passed back to the hit test filter
+    void addFeature(Esri::ArcGISRuntime::Feature* feature, const QString& sidc, double x, double y, int group = 0, int symbol = -1);
+    bool removeFeature(Esri::ArcGISRuntime::Feature* feature, double x, double y);
+    void clear();
+
+    int size() const;
+
+    void setGroupSymbolSize(int group, double pixels);
+    double groupSymbolSize(int group) const;
+
+    void setGroupVisible(int group, bool visible);
+
+    // Symbol whose screen extent contains x, y (in the table's spatial
+    // reference); unitsPerPixel converts the symbol sizes to map units
+    Hit hitTest(double x, double y, double unitsPerPixel, const std::function<bool(int symbol)>& accept = nullptr) const;
+
+private:
+    struct Entry {
+        Esri::ArcGISRuntime::Feature* feature;
+        QString sidc;
+        int group;
+        int symbol;
+
+        bool operator==(const Entry& other) const { return feature == other.feature; }
+    };
+
+    void ensureGroup(int group);
+
+    QuadTree<Entry> m_index;
+    QVector<double> m_groupSizes;
+    QVector<bool> m_groupVisible;
+};
+
+#endif // SYMBOLHITTESTER_H
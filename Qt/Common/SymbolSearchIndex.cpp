@@ -0,0 +1,241 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QSet>
+#include <QStringList>
+#include <QUuid>
+
+#include <algorithm>
+
+#include "SidcBitmapIndex.h"
+#include "SymbolSearchIndex.h"
+
+namespace {
+    // Marks a word prefix gram, never part of normalized text
+    const quint64 PrefixMark = 1;
+
+    quint64 pack(quint64 a, quint64 b, quint64 c) {
+        return (a << 32) | (b << 16) | c;
+    }
+
+    QString styleKey(const QString& code) {
+        // Dimension and function ID, the other positions vary per symbol
+        if (code.length() < 10)
+            return QString();
+        return code.at(2).toUpper() + code.mid(4, 6).toUpper();
+    }
+}
+
+SymbolSearchIndex::SymbolSearchIndex()
+{
+}
+
+void SymbolSearchIndex::add(int ordinal, const QString& sidc, const QString& name) {
+    if (m_ordinals.contains(sidc))
+        return;
+    m_ordinals.insert(sidc, ordinal);
+
+    Entry entry;
+    entry.ordinal = ordinal;
+    entry.sidc = sidc;
+    entry.name = name;
+    entry.text = normalize(sidc + QChar(' ') + name);
+
+    // Entries are only appended, so the posting lists stay sorted
+    const int index = m_entries.size();
+    m_entries.append(entry);
+
+    QSet<quint64> seen;
+    for (const QString& word : entry.text.split(QChar(' '), QString::SkipEmptyParts)) {
+        for (quint64 gram : grams(word)) {
+            if (seen.contains(gram))
+                continue;
+            seen.insert(gram);
+            m_postings[gram].append(index);
+        }
+    }
+}
+
+void SymbolSearchIndex::clear() {
+    m_entries.clear();
+    m_postings.clear();
+    m_ordinals.clear();
+}
+
+int SymbolSearchIndex::size() const {
+    return m_entries.size();
+}
+
+int SymbolSearchIndex::ordinal(const QString& sidc) const {
+    return m_ordinals.value(sidc, -1);
+}
+
+QVector<SymbolSearchIndex::Match> SymbolSearchIndex::search(const QString& query, int count /* = 10 */) const {
+    const QString text = normalize(query);
+    const QStringList words = text.split(QChar(' '), QString::SkipEmptyParts);
+    if (words.isEmpty() || count <= 0)
+        return QVector<Match>();
+
+    // Shortest posting lists first, so the intersection shrinks quickly
+    QVector<const QVector<int>*> lists;
+    for (const QString& word : words) {
+        for (quint64 gram : queryGrams(word)) {
+            auto it = m_postings.constFind(gram);
+            if (it == m_postings.constEnd())
+                return QVector<Match>();
+            lists.append(&it.value());
+        }
+    }
+
+    std::sort(lists.begin(), lists.end(), [](const QVector<int>* a, const QVector<int>* b) {
+        return a->size() < b->size();
+    });
+
+    QVector<int> candidates = *lists.first();
+    QVector<int> next;
+    for (int i = 1; i < lists.size() && !candidates.isEmpty(); i++) {
+        next.clear();
+        std::set_intersection(candidates.constBegin(), candidates.constEnd(), lists.at(i)->constBegin(), lists.at(i)->constEnd(), std::back_inserter(next));
+        candidates.swap(next);
+    }
+
+    // The grams of a word may all be present without the word itself
+    struct Ranked {
+        int score;
+        int index;
+    };
+
+    const QString code = QString(text).remove(QChar(' '));
+    QVector<Ranked> ranked;
+    ranked.reserve(candidates.size());
+
+    for (int index : candidates) {
+        const Entry& entry = m_entries.at(index);
+
+        int score = entry.text.startsWith(code) ? 0 : 2 * words.size();
+        bool matches = true;
+        for (const QString& word : words) {
+            const int at = entry.text.indexOf(word);
+            if (at < 0) {
+                matches = false;
+                break;
+            }
+
+            if (at > 0 && entry.text.at(at - 1) != QChar(' '))
+                score++;
+        }
+
+        if (matches)
+            ranked.append({ score, index });
+    }
+
+    // Only the first count are ordered, shorter texts win a tie
+    const int top = qMin(count, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + top, ranked.end(), [this](const Ranked& a, const Ranked& b) {
+        if (a.score != b.score)
+            return a.score < b.score;
+        const int aLength = m_entries.at(a.index).text.length();
+        const int bLength = m_entries.at(b.index).text.length();
+        return aLength != bLength ? aLength < bLength : a.index < b.index;
+    });
+
+    QVector<Match> matches;
+    matches.reserve(top);
+    for (int i = 0; i < top; i++) {
+        const Entry& entry = m_entries.at(ranked.at(i).index);
+
+        Match match;
+        match.ordinal = entry.ordinal;
+        match.sidc = entry.sidc;
+        match.name = entry.name;
+        matches.append(match);
+    }
+
+    return matches;
+}
+
+QHash<QString, QString> SymbolSearchIndex::styleNames(const QString& stylePath, QString* errorMessage /* = nullptr */) {
+    QHash<QString, QString> names;
+
+    // A connection of its own, this may run on any thread
+    const QString connection = QUuid::createUuid().toString();
+    {
+        QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE", connection);
+        database.setDatabaseName(stylePath);
+        database.setConnectOptions("QSQLITE_OPEN_READONLY");
+
+        if (database.open()) {
+            QSqlQuery query("SELECT NAME, KEY FROM ITEMS", database);
+            while (query.next()) {
+                const QString key = styleKey(query.value(1).toString());
+                if (!key.isEmpty() && !names.contains(key))
+                    names.insert(key, query.value(0).toString());
+            }
+
+            if (query.lastError().isValid() && errorMessage)
+                *errorMessage = query.lastError().text();
+        }
+        else if (errorMessage) {
+            *errorMessage = database.lastError().text();
+        }
+    }
+    QSqlDatabase::removeDatabase(connection);
+
+    return names;
+}
+
+QString SymbolSearchIndex::describe(const QString& sidc, const QHash<QString, QString>& styleNames) {
+    QStringList parts;
+
+    const QString name = styleNames.value(styleKey(sidc));
+    if (!name.isEmpty())
+        parts.append(name);
+    parts.append(SidcBitmapIndex::keywords(sidc));
+
+    return parts.join(QChar(' '));
+}
+
+QString SymbolSearchIndex::normalize(const QString& text) {
+    // Lower case words of letters, digits and the '-' of the codes
+    QString result;
+    result.reserve(text.length());
+    for (QChar c : text)
+        result.append(c.isLetterOrNumber() || c == QChar('-') || c == QChar('*') ? c.toLower() : QChar(' '));
+
+    return result.simplified();
+}
+
+QVector<quint64> SymbolSearchIndex::grams(const QString& word) {
+    QVector<quint64> result;
+
+    // The prefixes find words from their first keystrokes
+    if (word.length() >= 1)
+        result.append(pack(PrefixMark, word.at(0).unicode(), 0));
+    if (word.length() >= 2)
+        result.append(pack(PrefixMark, word.at(0).unicode(), word.at(1).unicode()));
+
+    for (int i = 0; i + 3 <= word.length(); i++)
+        result.append(pack(word.at(i).unicode(), word.at(i + 1).unicode(), word.at(i + 2).unicode()));
+
+    return result;
+}
+
+QVector<quint64> SymbolSearchIndex::queryGrams(const QString& word) {
+    // Short words can only match the start of a word, longer ones anywhere
+    if (word.length() < 3)
+        return grams(word).mid(word.length() - 1, 1);
+
+    return grams(word).mid(2);
+}
@@ -0,0 +1,73 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLSEARCHINDEX_H
+#define SYMBOLSEARCHINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+// Type-ahead search over symbol codes and names. Every word is indexed by
+// its trigrams and by its one and two character prefixes, so a query is
+// an intersection of sorted posting lists followed by a substring check
+// of the few candidates left.
+class SymbolSearchIndex
+{
+public:
+    struct Match {
+        int ordinal = -1;
+        QString sidc;
+        QString name;
+    };
+
+    SymbolSearchIndex();
+
+    // A code is indexed once, at the first ordinal it is added with
+    void add(int ordinal, const QString& sidc, const QString& name);
+    void clear();
+
+    int size() const;
+
+    // Ordinal a code was added with, or -1
+    int ordinal(const QString& sidc) const;
+
+    // Best count matches of every word of the query, codes starting with
+    // the query first, then matches at the start of a word
+    QVector<Match> search(const QString& query, int count = 10) const;
+
+    // Symbol names of a dictionary style, keyed by dimension and function ID
+    static QHash<QString, QString> styleNames(const QString& stylePath, QString* errorMessage = nullptr);
+
+    // Style name of a code followed by its filter keywords
+    static QString describe(const QString& sidc, const QHash<QString, QString>& styleNames);
+
+private:
+    struct Entry {
+        int ordinal;
+        QString sidc;
+        QString name;
+
+        // Normalized code and name the grams are taken from
+        QString text;
+    };
+
+    static QString normalize(const QString& text);
+    static QVector<quint64> grams(const QString& word);
+    static QVector<quint64> queryGrams(const QString& word);
+
+    QVector<Entry> m_entries;
+    QHash<quint64, QVector<int>> m_postings;
+    QHash<QString, int> m_ordinals;
+};
+
+#endif // SYMBOLSEARCHINDEX_H
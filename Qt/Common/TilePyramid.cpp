@@ -0,0 +1,192 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QtMath>
+
+#include <cmath>
+
+#include "TilePyramid.h"
+
+namespace {
+    const QString MetadataName = QStringLiteral("pyramid.json");
+    const int MetadataVersion = 1;
+
+    // Half the circumference of the Web Mercator sphere
+    const double HalfWorld = 20037508.342789244;
+
+    // Latitudes beyond this are not on the Web Mercator grid
+    const double MaxLatitude = 85.0511287798;
+
+    const double Dpi = 96.0;
+    const double MetersPerInch = 0.0254;
+
+    bool fail(QString* errorMessage, const QString& message) {
+        if (errorMessage)
+            *errorMessage = message;
+        return false;
+    }
+}
+
+TilePyramid::TilePyramid() {
+}
+
+void TilePyramid::setExtent(const QRectF& extent) {
+    m_extent = extent.normalized();
+}
+
+QRectF TilePyramid::extent() const {
+    return m_extent;
+}
+
+void TilePyramid::setLevels(int minLevel, int maxLevel) {
+    m_minLevel = qBound(0, qMin(minLevel, maxLevel), MaxLevel);
+    m_maxLevel = qBound(0, qMax(minLevel, maxLevel), MaxLevel);
+}
+
+int TilePyramid::minLevel() const {
+    return m_minLevel;
+}
+
+int TilePyramid::maxLevel() const {
+    return m_maxLevel;
+}
+
+void TilePyramid::setFingerprint(quint64 fingerprint) {
+    m_fingerprint = fingerprint;
+}
+
+quint64 TilePyramid::fingerprint() const {
+    return m_fingerprint;
+}
+
+QVector<PyramidTile> TilePyramid::tiles(int level) const {
+    QVector<PyramidTile> result;
+    if (m_extent.isEmpty() || level < 0 || level > MaxLevel)
+        return result;
+
+    const QPointF topLeft = toWebMercator(QPointF(m_extent.left(), m_extent.bottom()));
+    const QPointF bottomRight = toWebMercator(QPointF(m_extent.right(), m_extent.top()));
+
+    const double span = TileSize * resolution(level);
+    const int last = (1 << level) - 1;
+
+    const int firstColumn = qBound(0, static_cast<int>(std::floor((topLeft.x() - origin().x()) / span)), last);
+    const int lastColumn = qBound(0, static_cast<int>(std::floor((bottomRight.x() - origin().x()) / span)), last);
+    const int firstRow = qBound(0, static_cast<int>(std::floor((origin().y() - topLeft.y()) / span)), last);
+    const int lastRow = qBound(0, static_cast<int>(std::floor((origin().y() - bottomRight.y()) / span)), last);
+
+    result.reserve((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1));
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int column = firstColumn; column <= lastColumn; column++) {
+            PyramidTile tile;
+            tile.level = level;
+            tile.column = column;
+            tile.row = row;
+            result.append(tile);
+        }
+    }
+
+    return result;
+}
+
+int TilePyramid::tileCount() const {
+    int count = 0;
+    for (int level = m_minLevel; level <= m_maxLevel; level++)
+        count += tiles(level).size();
+
+    return count;
+}
+
+bool TilePyramid::save(const QString& root, QString* errorMessage /* = nullptr */) const {
+    if (!QDir().mkpath(root))
+        return fail(errorMessage, QString("Cannot create %1").arg(root));
+
+    QJsonObject metadata;
+    metadata["version"] = MetadataVersion;
+    metadata["tileSize"] = TileSize;
+    metadata["minLevel"] = m_minLevel;
+    metadata["maxLevel"] = m_maxLevel;
+    metadata["extent"] = QJsonArray() << m_extent.left() << m_extent.top() << m_extent.right() << m_extent.bottom();
+
+    // JSON numbers cannot hold every 64 bit value
+    metadata["fingerprint"] = QString::number(m_fingerprint, 16);
+
+    QSaveFile file(QDir(root).filePath(MetadataName));
+    if (!file.open(QIODevice::WriteOnly) ||
+        file.write(QJsonDocument(metadata).toJson()) < 0 ||
+        !file.commit())
+        return fail(errorMessage, file.errorString());
+
+    return true;
+}
+
+bool TilePyramid::load(const QString& root, QString* errorMessage /* = nullptr */) {
+    QFile file(QDir(root).filePath(MetadataName));
+    if (!file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, file.errorString());
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (document.isNull())
+        return fail(errorMessage, parseError.errorString());
+
+    const QJsonObject metadata = document.object();
+    if (metadata.value("version").toInt() != MetadataVersion)
+        return fail(errorMessage, QString("Unsupported tile pyramid version in %1").arg(file.fileName()));
+
+    if (metadata.value("tileSize").toInt() != TileSize)
+        return fail(errorMessage, QString("Tiles of %1 are not %2 pixels").arg(root).arg(TileSize));
+
+    const QJsonArray extent = metadata.value("extent").toArray();
+    if (extent.size() != 4)
+        return fail(errorMessage, QString("No extent in %1").arg(file.fileName()));
+
+    setExtent(QRectF(QPointF(extent.at(0).toDouble(), extent.at(1).toDouble()),
+                     QPointF(extent.at(2).toDouble(), extent.at(3).toDouble())));
+    setLevels(metadata.value("minLevel").toInt(), metadata.value("maxLevel").toInt());
+    m_fingerprint = metadata.value("fingerprint").toString().toULongLong(nullptr, 16);
+
+    return true;
+}
+
+QString TilePyramid::tilePath(const QString& root, const PyramidTile& tile) {
+    return QString("%1/%2/%3/%4.png").arg(root).arg(tile.level).arg(tile.column).arg(tile.row);
+}
+
+double TilePyramid::resolution(int level) {
+    return (2.0 * HalfWorld) / (TileSize * std::pow(2.0, level));
+}
+
+double TilePyramid::scale(int level) {
+    return resolution(level) * Dpi / MetersPerInch;
+}
+
+QPointF TilePyramid::origin() {
+    return QPointF(-HalfWorld, HalfWorld);
+}
+
+QRectF TilePyramid::tileBounds(const PyramidTile& tile) {
+    const double span = TileSize * resolution(tile.level);
+    return QRectF(origin().x() + tile.column * span, origin().y() - (tile.row + 1) * span, span, span);
+}
+
+QPointF TilePyramid::toWebMercator(const QPointF& lonLat) {
+    const double latitude = qDegreesToRadians(qBound(-MaxLatitude, lonLat.y(), MaxLatitude));
+    return QPointF(HalfWorld * lonLat.x() / 180.0,
+                   HalfWorld * std::log(std::tan((M_PI / 4.0) + (latitude / 2.0))) / M_PI);
+}
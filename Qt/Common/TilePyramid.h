@@ -0,0 +1,77 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef TILEPYRAMID_H
+#define TILEPYRAMID_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <QVector>
+
+// Tile of the Web Mercator grid, rows counted down from the top
+struct PyramidTile {
+    int level = 0;
+    int column = 0;
+    int row = 0;
+};
+
+// Levels and extent of a pyramid of pre-rendered tiles on disk, one
+// <level>/<column>/<row>.png per tile under a root folder, described by a
+// pyramid.json next to the levels.
+class TilePyramid
+{
+public:
+    static const int TileSize = 256;
+    static const int MaxLevel = 23;
+
+    TilePyramid();
+
+    // Extent of the content in WGS 84 degrees
+    void setExtent(const QRectF& extent);
+    QRectF extent() const;
+
+    void setLevels(int minLevel, int maxLevel);
+    int minLevel() const;
+    int maxLevel() const;
+
+    // Identifies the content the tiles were rendered from
+    void setFingerprint(quint64 fingerprint);
+    quint64 fingerprint() const;
+
+    // Tiles of a level covering the extent, and of every level
+    QVector<PyramidTile> tiles(int level) const;
+    int tileCount() const;
+
+    bool save(const QString& root, QString* errorMessage = nullptr) const;
+    bool load(const QString& root, QString* errorMessage = nullptr);
+
+    static QString tilePath(const QString& root, const PyramidTile& tile);
+
+    // Meters per pixel and map scale of a level at 96 dpi
+    static double resolution(int level);
+    static double scale(int level);
+
+    // Origin of the grid and bounds of a tile in Web Mercator meters
+    static QPointF origin();
+    static QRectF tileBounds(const PyramidTile& tile);
+
+    static QPointF toWebMercator(const QPointF& lonLat);
+
+private:
+    QRectF m_extent;
+    int m_minLevel = 0;
+    int m_maxLevel = 0;
+    quint64 m_fingerprint = 0;
+};
+
+#endif // TILEPYRAMID_H
@@ -0,0 +1,248 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QDateTime>
+#include <QFile>
+#include <QHash>
+#include <QSet>
+#include <QTextStream>
+#include <QTimer>
+
+#include <limits>
+#include <random>
+
+#include "FeatureFeed.h"
+#include "TrackPlayback.h"
+
+namespace {
+    const qint64 BeforeHistory = std::numeric_limits<qint64>::min();
+
+    bool parseTime(const QString& text, qint64* time) {
+        bool ok = false;
+        *time = text.toLongLong(&ok);
+        if (ok)
+            return true;
+
+        const QDateTime dateTime = QDateTime::fromString(text, Qt::ISODateWithMs);
+        if (!dateTime.isValid())
+            return false;
+
+        *time = dateTime.toMSecsSinceEpoch();
+        return true;
+    }
+}
+
+void TrackHistory::buildIndex() {
+    index.build(starts, ends);
+}
+
+bool TrackHistory::load(const QString& path, TrackHistory* history, QString* errorMessage /* = nullptr */) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+
+    TrackHistory result;
+    QHash<QString, int> tracks;
+
+    QTextStream stream(&file);
+    int lineNumber = 0;
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        lineNumber++;
+
+        // Comments and the header
+        if (line.isEmpty() || line.startsWith('#') || line.startsWith("id,"))
+            continue;
+
+        const QStringList fields = line.split(',');
+        qint64 start = 0;
+        qint64 end = 0;
+        bool xOk = false;
+        bool yOk = false;
+
+        if (fields.size() == 6 && parseTime(fields.at(2), &start) && parseTime(fields.at(3), &end)) {
+            const double x = fields.at(4).toDouble(&xOk);
+            const double y = fields.at(5).toDouble(&yOk);
+
+            if (xOk && yOk && start < end) {
+                auto it = tracks.find(fields.at(0));
+                if (it == tracks.end()) {
+                    it = tracks.insert(fields.at(0), result.trackIds.size());
+                    result.trackIds.append(fields.at(0));
+                    result.codes.append(fields.at(1));
+                }
+
+                result.tracks.append(it.value());
+                result.starts.append(start);
+                result.ends.append(end);
+                result.positions.append(QPointF(x, y));
+                continue;
+            }
+        }
+
+        if (errorMessage)
+            *errorMessage = QString("%1:%2: expected id,sidc,start,end,x,y").arg(path).arg(lineNumber);
+        return false;
+    }
+
+    result.buildIndex();
+    *history = result;
+    return true;
+}
+
+TrackHistory TrackHistory::generate(const QStringList& codes, const QRectF& extent, qint64 startMs, qint64 spanMs, qint64 stepMs, quint32 seed /* = 0 */) {
+    TrackHistory history;
+    if (codes.isEmpty() || stepMs <= 0)
+        return history;
+
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::normal_distribution<double> walk(0.0, extent.width() * 0.01);
+
+    const int samplesPerTrack = static_cast<int>(spanMs / stepMs);
+    history.trackIds.reserve(codes.size());
+    history.codes = codes;
+    history.tracks.reserve(codes.size() * samplesPerTrack);
+    history.starts.reserve(codes.size() * samplesPerTrack);
+    history.ends.reserve(codes.size() * samplesPerTrack);
+    history.positions.reserve(codes.size() * samplesPerTrack);
+
+    for (int track = 0; track < codes.size(); track++) {
+        history.trackIds.append(QString::number(track));
+
+        // Tracks appear and disappear at random within the span
+        const qint64 first = startMs + static_cast<qint64>(unit(random) * spanMs * 0.25);
+        const qint64 last = startMs + spanMs - static_cast<qint64>(unit(random) * spanMs * 0.25);
+
+        QPointF position(extent.left() + (unit(random) * extent.width()), extent.top() + (unit(random) * extent.height()));
+        for (qint64 time = first; time < last; time += stepMs) {
+            history.tracks.append(track);
+            history.starts.append(time);
+            history.ends.append(qMin(time + stepMs, last));
+            history.positions.append(position);
+
+            position.setX(qBound(extent.left(), position.x() + walk(random), extent.right()));
+            position.setY(qBound(extent.top(), position.y() + walk(random), extent.bottom()));
+        }
+    }
+
+    history.buildIndex();
+    return history;
+}
+
+TrackPlayback::TrackPlayback(QObject* parent /* = nullptr */):
+    QObject(parent),
+    m_applyTimer(new QTimer(this)),
+    m_time(BeforeHistory),
+    m_pendingTime(BeforeHistory)
+{
+    m_applyTimer->setSingleShot(true);
+    m_applyTimer->setInterval(0);
+    connect(m_applyTimer, &QTimer::timeout, this, &TrackPlayback::apply);
+}
+
+void TrackPlayback::setFeed(FeatureFeed* feed) {
+    m_feed = feed;
+}
+
+void TrackPlayback::setHistory(const TrackHistory& history) {
+    // Take down what the previous history shows
+    if (m_feed) {
+        for (int track = 0; track < m_shown.size(); track++) {
+            if (m_shown.at(track) >= 0)
+                m_feed->remove(feedId(track));
+        }
+    }
+
+    m_history = history;
+    m_shown.fill(-1, history.trackIds.size());
+    m_time = BeforeHistory;
+    m_pendingTime = BeforeHistory;
+
+    emit historyChanged();
+
+    setTime(start());
+}
+
+double TrackPlayback::start() const {
+    return static_cast<double>(m_history.index.minimum());
+}
+
+double TrackPlayback::end() const {
+    return static_cast<double>(m_history.index.maximum());
+}
+
+int TrackPlayback::trackCount() const {
+    return m_history.trackIds.size();
+}
+
+double TrackPlayback::time() const {
+    return m_pendingTime == BeforeHistory ? start() : static_cast<double>(m_pendingTime);
+}
+
+void TrackPlayback::setTime(double time) {
+    m_pendingTime = static_cast<qint64>(time);
+    m_applyTimer->start();
+}
+
+int TrackPlayback::lastDelta() const {
+    return m_lastDelta;
+}
+
+void TrackPlayback::apply() {
+    if (m_pendingTime == m_time)
+        return;
+
+    QVector<int> entered;
+    QVector<int> left;
+    m_history.index.delta(m_time, m_pendingTime, &entered, &left);
+    m_time = m_pendingTime;
+    m_lastDelta = entered.size() + left.size();
+
+    // Left first, so a track moving to its next sample is only moved
+    QSet<int> tracks;
+    for (int sample : left) {
+        const int track = m_history.tracks.at(sample);
+        if (m_shown.at(track) == sample) {
+            m_shown[track] = -1;
+            tracks.insert(track);
+        }
+    }
+
+    for (int sample : entered) {
+        const int track = m_history.tracks.at(sample);
+        m_shown[track] = sample;
+        tracks.insert(track);
+    }
+
+    if (m_feed) {
+        for (int track : tracks) {
+            const int sample = m_shown.at(track);
+            if (sample < 0) {
+                m_feed->remove(feedId(track));
+            }
+            else {
+                const QPointF& position = m_history.positions.at(sample);
+                m_feed->add(feedId(track), m_history.codes.at(track), position.x(), position.y());
+            }
+        }
+    }
+
+    emit timeChanged();
+}
+
+QString TrackPlayback::feedId(int track) const {
+    return QStringLiteral("track:") + m_history.trackIds.at(track);
+}
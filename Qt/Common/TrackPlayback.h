@@ -0,0 +1,104 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef TRACKPLAYBACK_H
+#define TRACKPLAYBACK_H
+
+#include <QObject>
+#include <QPointF>
+#include <QRectF>
+#include <QStringList>
+#include <QVector>
+
+#include "IntervalIndex.h"
+
+class FeatureFeed;
+class QTimer;
+
+// Time stamped positions of symbol tracks, one validity interval per
+// sample, in milliseconds since the epoch
+struct TrackHistory {
+    // Per track
+    QStringList trackIds;
+    QStringList codes;
+
+    // Per sample
+    QVector<int> tracks;
+    QVector<qint64> starts;
+    QVector<qint64> ends;
+    QVector<QPointF> positions;
+
+    IntervalIndex index;
+
+    int sampleCount() const { return tracks.size(); }
+
+    // Indexes the samples, call once they are all added
+    void buildIndex();
+
+    // Lines of id,sidc,start,end,x,y with times in milliseconds or ISO 8601
+    static bool load(const QString& path, TrackHistory* history, QString* errorMessage = nullptr);
+
+    // Random walks of the codes within extent, a sample every stepMs
+    static TrackHistory generate(const QStringList& codes, const QRectF& extent, qint64 startMs, qint64 spanMs, qint64 stepMs, quint32 seed = 0);
+};
+
+// Plays a track history into a FeatureFeed. Every time set in one turn
+// of the event loop collapses into one, and only the samples entering
+// and leaving since the last time applied are sent.
+class TrackPlayback : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(double start READ start NOTIFY historyChanged)
+    Q_PROPERTY(double end READ end NOTIFY historyChanged)
+    Q_PROPERTY(int trackCount READ trackCount NOTIFY historyChanged)
+    Q_PROPERTY(double time READ time WRITE setTime NOTIFY timeChanged)
+    Q_PROPERTY(int lastDelta READ lastDelta NOTIFY timeChanged)
+
+public:
+    explicit TrackPlayback(QObject* parent = nullptr);
+
+    void setFeed(FeatureFeed* feed);
+    void setHistory(const TrackHistory& history);
+
+    double start() const;
+    double end() const;
+    int trackCount() const;
+
+    double time() const;
+    void setTime(double time);
+
+    // Samples sent for the last time applied
+    int lastDelta() const;
+
+signals:
+    void historyChanged();
+    void timeChanged();
+
+private:
+    void apply();
+    QString feedId(int track) const;
+
+    FeatureFeed* m_feed = nullptr;
+    QTimer* m_applyTimer = nullptr;
+    TrackHistory m_history;
+
+    // Applied and requested times, nothing is shown before the first
+    qint64 m_time;
+    qint64 m_pendingTime;
+    int m_lastDelta = 0;
+
+    // Sample shown for each track, or -1
+    QVector<int> m_shown;
+};
+
+#endif // TRACKPLAYBACK_H
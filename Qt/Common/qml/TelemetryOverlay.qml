@@ -0,0 +1,57 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+import QtQuick 2.6
+
+// Frame time and throughput overlay, toggled with F3
+Rectangle {
+    id: overlay
+
+    // RenderTelemetry exposed by the app item
+    property var telemetry: null
+    property real scaleFactor: 1
+
+    visible: telemetry !== null && telemetry.enabled
+    width: label.width + 16 * scaleFactor
+    height: label.height + 16 * scaleFactor
+    color: "#b0000000"
+    radius: 4 * scaleFactor
+
+    Shortcut {
+        sequence: "F3"
+        context: Qt.ApplicationShortcut
+        onActivated: {
+            if (telemetry)
+                telemetry.enabled = !telemetry.enabled;
+        }
+    }
+
+    // A single text item keeps the per-update cost to one layout
+    Text {
+        id: label
+        anchors.centerIn: parent
+        color: "white"
+        font.family: "Courier"
+        font.pixelSize: 12 * overlay.scaleFactor
+        text: !overlay.visible ? "" :
+              "fps        " + telemetry.fps.toFixed(1) + "\n" +
+              "frame p50  " + telemetry.frameTimeP50.toFixed(2) + " ms\n" +
+              "frame p95  " + telemetry.frameTimeP95.toFixed(2) + " ms\n" +
+              "frame p99  " + telemetry.frameTimeP99.toFixed(2) + " ms\n" +
+              "features   " + telemetry.featureCount + "\n" +
+              "uniques    " + telemetry.uniqueValueCount + "\n" +
+              "cache hits " + telemetry.symbolCacheHits + "\n" +
+              "ingest     " + telemetry.pendingIngest + "\n" +
+              "resident   " + telemetry.residentMegabytes.toFixed(1) + " MB\n" +
+              "evictions  " + telemetry.evictions
+    }
+}
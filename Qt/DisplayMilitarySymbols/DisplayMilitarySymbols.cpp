@@ -23,26 +23,108 @@
 #include "FeatureCollectionTable.h"
 #include "FeatureCollectionLayer.h"
 #include "FeatureCollection.h"
+#include "FeatureLayer.h"
+#include "ServiceImageTiledLayer.h"
+#include "TileInfo.h"
+#include "LevelOfDetail.h"
 
+#include "Envelope.h"
 #include "Point.h"
+#include "Polygon.h"
+#include "PolygonBuilder.h"
+#include "PolylineBuilder.h"
+#include "Viewpoint.h"
 #include "GeometryEngine.h"
 #include "SpatialReference.h"
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <QDir>
+#include <QDateTime>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMouseEvent>
+#include <QSaveFile>
+#include <QSet>
+#include <QTimer>
+#include <QtMath>
+#include <random>
 
+#include "AllocationProfiler.h"
+#include "ColumnarFile.h"
 #include "DisplayMilitarySymbols.h"
+#include "SymbolEngine.h"
+#include "SymbolRegression.h"
+#include "TileGenerator.h"
 
 using namespace std;
 using namespace Esri::ArcGISRuntime;
 
+namespace {
+    // Features per batch between the project and ingest stages
+    const int BatchSize = 500;
+
+    // Batches the project stage may run ahead of the ingest stage
+    const int BatchQueueDepth = 4;
+
+    // Grid positions along each side of a residency cell
+    const int CellSpan = 16;
+
+    // Estimated footprint of the two features of a grid position, with
+    // their geometry, attributes and runtime side
+    const qint64 FeatureBytes = 2048;
+
+    // Share of the memory budget left to the symbol cache
+    const qint64 SymbolBudgetShare = 16;
+
+    // Span and sampling of the synthetic tracks
+    const qint64 TrackSpanMs = 24 * 60 * 60 * 1000;
+    const qint64 TrackStepMs = 15 * 60 * 1000;
+    const QDate TrackEpoch(2017, 1, 1);
+
+    // Vertices of each synthetic tactical graphic
+    const int GraphicVertices = 2000;
+
+    // Deviation from the full geometry allowed at each band, in pixels
+    const double GeneralizePixels = 0.5;
+
+    // Boundaries, phase lines and forward lines of own troops
+    const QStringList LineGraphicCodes = QStringList() << "GFGPGLB--------" << "GFGPGLP--------" << "GFGPGLF--------";
+
+    // Assembly and general areas
+    const QStringList AreaGraphicCodes = QStringList() << "GFGPGAA--------" << "GFGPGAG--------";
+}
+
 DisplayMilitarySymbols::DisplayMilitarySymbols(QQuickItem* parent /* = nullptr */):
-    QQuickItem(parent) {
+    QQuickItem(parent),
+    m_telemetry(new RenderTelemetry(this)),
+    m_pipeline(new LoadPipeline(this)),
+    m_feed(new FeatureFeed(this)),
+    m_playback(new TrackPlayback(this)) {
+    m_playback->setFeed(m_feed);
+
+    connect(this, &QQuickItem::windowChanged, m_telemetry, &RenderTelemetry::setWindow);
+    connect(this, &QQuickItem::windowChanged, m_feed, &FeatureFeed::setWindow);
+    connect(m_feed, &FeatureFeed::updatesReady, this, &DisplayMilitarySymbols::applyFeedUpdates);
+
+    m_telemetry->setCounterSource([this]() {
+        TelemetryCounters counters;
+        counters.featureCount = (m_residentCount + m_feedFeatures.size()) * 2 + m_graphics.size();
+        for (const Shard& shard : m_shards)
+            counters.uniqueValueCount += shard.uRend->uniqueValues()->size();
+        counters.symbolCacheHits = m_symbolCache.hits();
+        counters.pendingIngest = m_pendingIngest;
+        counters.residentMegabytes = (m_residency.stats().residentBytes + m_symbolCache.bytes()) / (1024.0 * 1024.0);
+        counters.evictions = m_residency.stats().evictions + m_symbolCache.evictions();
+        return counters;
+    });
 }
 
 DisplayMilitarySymbols::~DisplayMilitarySymbols() {
+    // Stop the load before the members the stages use go away
+    m_pipeline->cancel();
 }
 
 void DisplayMilitarySymbols::componentComplete() {
@@ -62,475 +144,1281 @@ void DisplayMilitarySymbols::componentComplete() {
     SimpleMarkerSymbol* sms = new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Circle, QColor(Qt::blue), 12, this);
     sms->setOutline(sls);
 
-    // Create the Dictionary and Unique Value Renderer
+    // Create the Dictionary Renderer, the tables of each shard get their
+    // own renderers once the catalog is planned
     const QString stylePath = QDir::currentPath() + QStringLiteral("/styles/mil2525c_b2.stylx");
     const QString styleDict = QDir::currentPath() + QStringLiteral("/styles/master.sym");
 
-    DictionarySymbolStyle* style = new DictionarySymbolStyle(QString("mil2525c_b2"), stylePath, this);
+    m_stylePath = stylePath;
+
+    QString sharedError;
+    if (m_sharedSymbols.attach(stylePath, &sharedError))
+        m_symbolCache.setShared(&m_sharedSymbols);
+    else
+        qWarning() << "Shared symbol cache unavailable:" << sharedError;
+
+    m_style = new DictionarySymbolStyle(QString("mil2525c_b2"), stylePath, this);
     //QMap<QString, QString> config;
     //config["legacy_standard"] = "mil2525bc2";
     //style->setConfigurationProperties(config);
 
-    m_dRend = new DictionaryRenderer(style, this);
-    m_uRend = new UniqueValueRenderer(this);
-    m_uRend->setFieldNames(QStringList() << FieldName);
-    m_uRend->setDefaultSymbol(sms);
+    m_dRend = new DictionaryRenderer(m_style, this);
+    m_defaultSymbol = sms;
 
-    // Create the fields for the Feature Collection table
-    QList<Field> fields;
-    fields.push_back(Field::createText(FieldName, FieldName, 15));
+    // Add a feature collection for each renderer to the map, the shard
+    // tables are appended as they are built
+    m_layers = CatalogSymbolEngine::createLayers(m_map, this);
+
+    // Resolve clicks and hovers from the local index instead of identifying
+    connect(m_mapView, &MapQuickView::mouseClicked, this, [this](QMouseEvent& mouseEvent) {
+        SymbolHitTester::Hit hit = hitTest(mouseEvent);
+        selectFeature(hit.feature);
+        emit symbolSelected(hit.sidc);
+    });
+
+    connect(m_mapView, &MapQuickView::mouseMoved, this, [this](QMouseEvent& mouseEvent) {
+        SymbolHitTester::Hit hit = hitTest(mouseEvent);
+        if (hit.sidc != m_hoveredSidc) {
+            m_hoveredSidc = hit.sidc;
+            emit symbolHovered(m_hoveredSidc);
+        }
+    });
+
+    // Evict and materialize cells once the view settles
+    m_residencyTimer = new QTimer(this);
+    m_residencyTimer->setSingleShot(true);
+    m_residencyTimer->setInterval(100);
+    connect(m_residencyTimer, &QTimer::timeout, this, &DisplayMilitarySymbols::updateResidency);
+    connect(m_mapView, &MapQuickView::viewpointChanged, m_residencyTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
+
+    // Report the stages of the load
+    connect(m_pipeline, &LoadPipeline::stageFinished, this, [](const QString& stage, qint64 elapsedMs) {
+        qDebug() << "Stage " << stage << " finished in " << elapsedMs << " ms";
+    });
+    connect(m_pipeline, &LoadPipeline::failed, this, [](const QString& stage, const QString& error) {
+        qDebug() << "Stage " << stage << " failed: " << error;
+    });
+
+    connect(m_style, &DictionarySymbolStyle::doneLoading, this, [this](Error loadError) {
+        if (!loadError.isEmpty()) {
+            m_pipeline->fail("style", loadError.message());
+            return;
+        }
+
+        startLoad();
+    });
+
+    m_style->load();
+}
+
+void DisplayMilitarySymbols::startLoad() {
+    addTileLayer();
+
+    // import -> ingest, the catalog comes from a columnar file
+    if (!m_importPath.isEmpty()) {
+        const QString path = m_importPath;
+        const ShardPlanner::Partition partition = m_partition;
+
+        m_pipeline->run<SnapshotRestore>("import", [path, partition]() {
+            return readColumns(path, partition);
+        }, [this](const SnapshotRestore& restore) {
+            restoreSnapshot(restore);
+        });
+        return;
+    }
+
+    if (m_snapshotPath.isEmpty()) {
+        loadCatalog();
+        return;
+    }
+
+    const QString path = m_snapshotPath;
+    const quint64 fingerprint = SnapshotReader::fingerprint(m_stylePath, workloadKey());
+    const ShardPlanner::Partition partition = m_partition;
+
+    // snapshot -> ingest, replacing the catalog and layout stages and the
+    // symbol resolution
+    m_pipeline->run<SnapshotRestore>("snapshot", [path, fingerprint, partition]() {
+        SnapshotRestore restore;
+
+        SnapshotReader reader;
+        if (!reader.open(path, fingerprint, &restore.error))
+            return restore;
+
+        restore.state = reader.state();
+
+        CatalogLayout& layout = restore.layout;
+        layout.codes.reserve(reader.featureCount());
+        layout.positions.reserve(reader.featureCount());
+        for (int row = 0; row < reader.featureCount(); row++) {
+            layout.codes.append(reader.code(row));
+            layout.positions.append(reader.dPoint(row));
+        }
+
+        // The unique value table is offset by half the grid spacing
+        if (reader.featureCount() > 0)
+            layout.spacing = 2.0 * (reader.uPoint(0).x() - reader.dPoint(0).x());
+
+        for (int i = 0; i < reader.codeCount(); i++) {
+            const QString json = reader.symbolJsonAt(i);
+            if (!json.isEmpty())
+                restore.symbols.insert(reader.codeAt(i), json);
+        }
+
+        layout.shards = ShardPlanner::plan(layout.codes, partition);
+        restore.ok = true;
+
+        return restore;
+    }, [this](const SnapshotRestore& restore) {
+        restoreSnapshot(restore);
+    });
+}
+
+DisplayMilitarySymbols::SnapshotRestore DisplayMilitarySymbols::readColumns(const QString& path, ShardPlanner::Partition partition) {
+    SnapshotRestore restore;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        restore.error = file.errorString();
+        return restore;
+    }
+
+    ColumnarReader reader(&file);
+    if (!reader.open(&restore.error))
+        return restore;
+
+    CatalogLayout& layout = restore.layout;
+    bool spacingKnown = false;
+
+    ColumnBatch batch;
+    while (reader.next(&batch, &restore.error)) {
+        const QStringList& dictionary = reader.dictionary();
+
+        // The dictionary table carries the grid, the unique value table
+        // only its offset
+        if (batch.table == ColumnBatch::UniqueValueTable) {
+            if (!spacingKnown && batch.rowCount() > 0 && !layout.positions.isEmpty()) {
+                layout.spacing = 2.0 * (batch.x.first() - layout.positions.first().x());
+                spacingKnown = true;
+            }
+            continue;
+        }
+
+        layout.codes.reserve(layout.codes.size() + batch.rowCount());
+        layout.positions.reserve(layout.positions.size() + batch.rowCount());
+        for (int row = 0; row < batch.rowCount(); row++) {
+            layout.codes.append(dictionary.at(batch.codes.at(row)));
+            layout.positions.append(QPointF(batch.x.at(row), batch.y.at(row)));
+        }
+    }
+
+    if (!restore.error.isEmpty())
+        return restore;
+
+    layout.shards = ShardPlanner::plan(layout.codes, partition);
+    restore.ok = true;
+
+    return restore;
+}
+
+bool DisplayMilitarySymbols::exportColumns(const QString& path) {
+    // Both tables as columns, straight from the layout
+    QVector<double> x(m_layout.positions.size());
+    QVector<double> y(m_layout.positions.size());
+    QVector<double> ux(m_layout.positions.size());
+    for (int i = 0; i < m_layout.positions.size(); i++) {
+        x[i] = m_layout.positions.at(i).x();
+        y[i] = m_layout.positions.at(i).y();
+        ux[i] = x.at(i) + (m_layout.spacing * 0.5);
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "Columns not exported: " << file.errorString();
+        return false;
+    }
+
+    ColumnarWriter writer(&file);
+    const bool written = writer.begin()
+        && writer.writeTable(ColumnBatch::DictionaryTable, x, y, m_layout.codes)
+        && writer.writeTable(ColumnBatch::UniqueValueTable, ux, y, m_layout.codes)
+        && writer.finish();
+
+    if (!written || !file.commit()) {
+        qDebug() << "Columns not exported: " << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+bool DisplayMilitarySymbols::setSidcTable(const QString& path, QString* errorMessage /* = nullptr */) {
+    return m_converter.loadTable(path, errorMessage);
+}
+
+void DisplayMilitarySymbols::setImportPath(const QString& path) {
+    m_importPath = path;
+}
+
+void DisplayMilitarySymbols::setExportPath(const QString& path) {
+    m_exportPath = path;
+}
+
+void DisplayMilitarySymbols::restoreSnapshot(const SnapshotRestore& restore) {
+    if (!restore.ok) {
+        qDebug() << "Rebuilding: " << restore.error;
+        loadCatalog();
+        return;
+    }
+
+    for (auto it = restore.symbols.constBegin(); it != restore.symbols.constEnd(); ++it)
+        m_symbolCache.insert(it.key(), it.value());
+
+    if (restore.state.viewScale > 0.0) {
+        m_mapView->setViewpoint(Viewpoint(Point(restore.state.viewX, restore.state.viewY, SpatialReference(restore.state.viewWkid)), restore.state.viewScale));
+    } else if (!restore.layout.positions.isEmpty()) {
+        // No stored view, show everything
+        QRectF extent(restore.layout.positions.first(), QSizeF());
+        for (const QPointF& position : restore.layout.positions)
+            extent |= QRectF(position, QSizeF(restore.layout.spacing, restore.layout.spacing));
+
+        m_mapView->setViewpointGeometry(Envelope(extent.left(), extent.top(), extent.right(), extent.bottom(), SpatialReference(4326)));
+    }
+
+    startIngest(restore.layout);
+}
+
+bool DisplayMilitarySymbols::saveSnapshot(const QString& path) {
+    SnapshotWriter writer;
+
+    SnapshotState state;
+    const Viewpoint viewpoint = m_mapView->currentViewpoint(ViewpointType::CenterAndScale);
+    const Point center(viewpoint.targetGeometry());
+    state.viewX = center.x();
+    state.viewY = center.y();
+    state.viewWkid = center.spatialReference().wkid();
+    state.viewScale = viewpoint.targetScale();
+    writer.setState(state);
+
+    for (int i = 0; i < m_layout.codes.size(); i++) {
+        const QPointF dPoint = m_layout.positions.at(i);
+        writer.addFeature(m_layout.codes.at(i), dPoint, QPointF(dPoint.x() + (m_layout.spacing * 0.5), dPoint.y()));
+    }
+
+    const QHash<QString, QString> symbols = m_symbolCache.symbols();
+    for (auto it = symbols.constBegin(); it != symbols.constEnd(); ++it)
+        writer.setSymbolJson(it.key(), it.value());
+
+    QString error;
+    if (!writer.write(path, SnapshotReader::fingerprint(m_stylePath, workloadKey()), &error)) {
+        qDebug() << "Snapshot not saved: " << error;
+        return false;
+    }
+
+    return true;
+}
+
+void DisplayMilitarySymbols::setSnapshotPath(const QString& path) {
+    m_snapshotPath = path;
+}
+
+void DisplayMilitarySymbols::loadCatalog() {
+    // Get the AOI
+    Point pnt = GeometryEngine::project(Point(-117.1825, 34.0556, SpatialReference(4326)),SpatialReference(3857));
+    Envelope aoi = GeometryEngine::project(GeometryEngine::buffer(pnt, Meters).extent(), SpatialReference(4326));
+
+    m_mapView->setViewpointGeometry(aoi);
+
+    // The workers only see copies, never the item
+    const SidcWorkload workload = m_workload;
+    const int count = m_workloadCount;
+    const int skip = m_workloadSkip;
+    const SidcPatternSpace space = m_patternSpace;
+    const bool usePatterns = m_usePatterns;
+    const ShardPlanner::Partition partition = m_partition;
+    const QRectF extent(QPointF(aoi.xMin(), aoi.yMin()), QPointF(aoi.xMax(), aoi.yMax()));
+
+    // catalog -> layout
+    m_pipeline->run<QStringList>("catalog", [workload, space, usePatterns, count, skip]() {
+        if (!usePatterns)
+            return GenerateSymbolCodes(workload, count, skip);
+
+        // One code per pattern by default, spread over the whole expansion
+        const int sampleCount = count > 0 ? count : space.patternCount();
+        const qint64 stride = qMax<qint64>(1, (space.size() - skip) / qMax(1, sampleCount));
+        return space.sample(skip, sampleCount, stride);
+    }, [this, extent, partition](const QStringList& codes) {
+        const SidcConverter converter = m_converter;
+        m_pipeline->run<CatalogLayout>("layout", [codes, extent, partition, converter]() {
+            SidcConverter::Stats stats;
+            const QStringList normalized = converter.normalize(codes, SidcConverter::RevisionC, &stats);
+            if (stats.converted > 0 || stats.invalid > 0)
+                qDebug() << "Converted" << stats.converted << "2525D codes," << stats.generalized << "generalized,"
+                         << stats.frameOnly << "frame only," << stats.invalid << "invalid";
+
+            return layoutCatalog(normalized, extent, partition);
+        }, [this](const CatalogLayout& layout) {
+            startIngest(layout);
+        });
+    });
+}
+
+DisplayMilitarySymbols::CatalogLayout DisplayMilitarySymbols::layoutCatalog(const QStringList& catalog, const QRectF& extent, ShardPlanner::Partition partition) {
+    CatalogLayout layout;
+
+    // Lay out the grid up front so every shard places its codes where a
+    // single table would
+    const GridLayout grid(extent, catalog.length());
+    layout.spacing = grid.spacing();
+    layout.positions = CatalogSymbolEngine::layout(grid, catalog.length());
+    layout.codes = catalog.mid(0, layout.positions.size());
+
+    // Partition and deduplicate the catalog on all cores
+    layout.shards = ShardPlanner::plan(layout.codes, partition);
+
+    return layout;
+}
+
+void DisplayMilitarySymbols::startIngest(const CatalogLayout& layout) {
+    m_layout = layout;
+    m_residents.fill(Resident(), layout.codes.size());
+    m_ordinalShards.resize(layout.codes.size());
+
+    for (int shard = 0; shard < layout.shards.size(); shard++) {
+        createShard(layout.shards.at(shard));
+        for (int ordinal : layout.shards.at(shard).ordinals)
+            m_ordinalShards[ordinal] = shard;
+    }
+
+    // Group the grid into cells, the unit of residency
+    m_cells.clear();
+    m_residency.clear();
+    m_ordinalCells.resize(layout.codes.size());
+
+    m_cellOrigin = QPointF();
+    for (int ordinal = 0; ordinal < layout.positions.size(); ordinal++) {
+        const QPointF& position = layout.positions.at(ordinal);
+        if (ordinal == 0 || position.x() < m_cellOrigin.x())
+            m_cellOrigin.setX(position.x());
+        if (ordinal == 0 || position.y() < m_cellOrigin.y())
+            m_cellOrigin.setY(position.y());
+    }
+
+    m_cellSize = layout.spacing * CellSpan;
+    m_cellColumns = 0;
+    m_cellRows = 0;
+    for (int ordinal = 0; ordinal < layout.positions.size(); ordinal++) {
+        const QPoint cell = cellAt(layout.positions.at(ordinal));
+        m_cellColumns = qMax(m_cellColumns, cell.x() + 1);
+        m_cellRows = qMax(m_cellRows, cell.y() + 1);
+
+        const int key = cellKey(cell);
+        m_ordinalCells[ordinal] = key;
+        m_cells[key].append(ordinal);
+    }
+
+    // project -> ingest -> symbolize -> renderer, the projection stops
+    // while the GUI thread has BatchQueueDepth batches to ingest
+    std::shared_ptr<BoundedQueue<FeatureBatch>> queue = std::make_shared<BoundedQueue<FeatureBatch>>(BatchQueueDepth, m_pipeline->token());
+    const CancelToken token = m_pipeline->token();
+
+    m_pipeline->start("project", [layout, queue, token]() {
+        for (int shard = 0; shard < layout.shards.size() && !token.isCanceled(); shard++) {
+            const CatalogShard& plan = layout.shards.at(shard);
+
+            for (int start = 0; start < plan.ordinals.size(); start += BatchSize) {
+                FeatureBatch batch;
+                batch.shard = shard;
+
+                const int end = qMin(start + BatchSize, plan.ordinals.size());
+                for (int i = start; i < end; i++) {
+                    const int ordinal = plan.ordinals.at(i);
+                    const QPointF position = layout.positions.at(ordinal);
+
+                    batch.ordinals.append(ordinal);
+                    batch.dPoints.append(position);
+                    batch.uPoints.append(QPointF(position.x() + (layout.spacing * 0.5), position.y()));
+                }
+
+                if (!queue->push(batch))
+                    return;
+            }
+        }
+
+        queue->close();
+    });
+
+    m_pipeline->drain<FeatureBatch>("ingest", queue, [this](const FeatureBatch& batch) {
+        ingestBatch(batch);
+    }, [this]() {
+        applyRenderers();
+    });
+}
+
+void DisplayMilitarySymbols::createShard(const CatalogShard& plan) {
+    Shard shard;
+    shard.key = plan.key;
 
     // Create the Feature Collection Tables
-    m_dTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference(4326), this);
-    m_uTable = new FeatureCollectionTable(fields, GeometryType::Point, SpatialReference(4326), this);
+    shard.dTable = CatalogSymbolEngine::createTable(FieldName, this);
+    shard.uTable = CatalogSymbolEngine::createTable(FieldName, this);
 
     // Assign the renderers to the tables
-    m_dTable->setRenderer(m_dRend);
-    m_uTable->setRenderer(m_uRend);
+    shard.uRend = new UniqueValueRenderer(this);
+    shard.uRend->setFieldNames(QStringList() << FieldName);
+    shard.uRend->setDefaultSymbol(m_defaultSymbol);
 
-    // Create a feature collection and the tables
-    m_uCollection = new FeatureCollection(this);
-    m_uCollection->tables()->append(m_dTable);
+    shard.dTable->setRenderer(new DictionaryRenderer(m_style, this));
+    shard.uTable->setRenderer(shard.uRend);
 
-    m_dCollection = new FeatureCollection(this);
-    m_dCollection->tables()->append(m_uTable);
+    // Track the features still being added to the tables
+    connect(shard.dTable, &FeatureTable::addFeatureCompleted, this, [this](QUuid, bool) {
+        m_pendingIngest--;
+    });
+    connect(shard.uTable, &FeatureTable::addFeatureCompleted, this, [this](QUuid, bool) {
+        m_pendingIngest--;
+    });
 
-    // Add the collections to the map
-    m_dLayer = new FeatureCollectionLayer(m_dCollection, this);
-    m_uLayer = new FeatureCollectionLayer(m_uCollection, this);
-    m_map->operationalLayers()->append(m_dLayer);
-    m_map->operationalLayers()->append(m_uLayer);
+    // The runtime ingests the tables of every shard independently
+    CatalogSymbolEngine::addTables(m_layers, shard.dTable, shard.uTable);
 
-    connect(style, &DictionarySymbolStyle::doneLoading, this, [this](Error loadError) {
-           if (!loadError.isEmpty())
-               return;
+    m_shards.append(shard);
+}
 
-           // Get the sic codes
-           /*QStringList codes;
-           codes << "IFAPSCC--------" << "IFAPSCO--------" << "IFAPSCP--------" << "IFAPSCS--------" << "IFAPSRAI-------" << "IFAPSRAS-------" << "IFAPSRC--------" << "IFAPSRD--------" << "IFAPSRE--------" << "IFAPSRF--------" << "IFAPSRI--------";
-           codes << "IFAPSRMA-------" << "IFAPSRMD-------" << "IFAPSRMF-------" << "IFAPSRMG-------" << "IFAPSRMT-------" << "IFAPSRTA-------" << "IFAPSRTI-------" << "IFAPSRTT-------" << "IFAPSRU--------" << "IFGPSCC--------" << "IFGPSCO--------";
-           codes << "IFGPSCP--------" << "IFGPSCS--------" << "IFGPSCT--------" << "IFGPSRAA-------" << "IFGPSRAT-------" << "IFGPSRB--------" << "IFGPSRCA-------" << "IFGPSRCS-------" << "IFGPSRD--------" << "IFGPSRE--------" << "IFGPSRF--------";
-           codes << "IFGPSRH--------" << "IFGPSRI--------" << "IFGPSRMA-------" << "IFGPSRMF-------" << "IFGPSRMG-------" << "IFGPSRMM-------" << "IFGPSRMT-------" << "IFGPSRS--------" << "IFGPSRTA-------" << "IFGPSRTI-------" << "IFGPSRTT-------";
-           //codes << "IFGPSRU--------" << "IFPPSCD--------" << "IFPPSRD--------" << "IFPPSRE--------" << "IFPPSRI--------" << "IFPPSRM--------" << "IFPPSRS--------" << "IFPPSRT--------" << "IFPPSRU--------" << "IFSPSCC--------" << "IFSPSCO--------";
-           //codes << "IFSPSCP--------" << "IFSPSCS--------" << "IFSPSRAA-------" << "IFSPSRAT-------" << "IFSPSRCA-------" << "IFSPSRCI-------" << "IFSPSRD--------" << "IFSPSRE--------" << "IFSPSRF--------" << "IFSPSRH--------" << "IFSPSRI--------";
-           //codes << "IFSPSRMA-------" << "IFSPSRMF-------" << "IFSPSRMG-------" << "IFSPSRMM-------" << "IFSPSRMT-------" << "IFSPSRS--------" << "IFSPSRTA-------" << "IFSPSRTI-------" << "IFSPSRTT-------" << "IFSPSRU--------" << "IFUPSCO--------";
-           //codes << "IFUPSCP--------" << "IFUPSCS--------" << "IFUPSRD--------" << "IFUPSRE--------" << "IFUPSRM--------" << "IFUPSRS--------" << "IFUPSRT--------" << "IFUPSRU--------" << "IHAPSCC--------" << "IHAPSCO--------" << "IHAPSCP--------";
-           //codes << "IHAPSCS--------" << "IHAPSRAI-------" << "IHAPSRAS-------" << "IHAPSRC--------" << "IHAPSRD--------" << "IHAPSRE--------" << "IHAPSRF--------" << "IHAPSRI--------" << "IHAPSRMA-------" << "IHAPSRMD-------" << "IHAPSRMF-------";
-           //codes << "IHAPSRMG-------" << "IHAPSRMT-------" << "IHAPSRTA-------" << "IHAPSRTI-------" << "IHAPSRTT-------" << "IHAPSRU--------" << "IHGPSCC--------" << "IHGPSCO--------" << "IHGPSCP--------" << "IHGPSCS--------" << "IHGPSCT--------";
-           //codes << "IHGPSRAA-------" << "IHGPSRAT-------" << "IHGPSRB--------" << "IHGPSRCA-------" << "IHGPSRCS-------" << "IHGPSRD--------" << "IHGPSRE--------" << "IHGPSRF--------" << "IHGPSRH--------" << "IHGPSRI--------" << "IHGPSRMA-------";
-           */
-           QStringList codes = GenerateSymbolCodes();
+void DisplayMilitarySymbols::ingestBatch(const FeatureBatch& batch) {
+    for (int i = 0; i < batch.ordinals.size(); i++) {
+        const int ordinal = batch.ordinals.at(i);
 
-           // Get the AOI
-           Point pnt = GeometryEngine::project(Point(-117.1825, 34.0556, SpatialReference(4326)),SpatialReference(3857));
-           Envelope aoi = GeometryEngine::project(GeometryEngine::buffer(pnt, Meters).extent(), SpatialReference(4326));
+        // Cells beyond the budget are materialized once the view reaches them
+        const int cell = m_ordinalCells.at(ordinal);
+        if (!m_residency.isResident(cell)) {
+            const qint64 bytes = m_cells.value(cell).size() * FeatureBytes;
+            if (!m_residency.fits(bytes))
+                continue;
+            m_residency.insert(cell, bytes);
+        }
 
-           m_mapView->setViewpointGeometry(aoi);
+        materialize(batch.shard, ordinal, batch.dPoints.at(i), batch.uPoints.at(i));
+    }
 
+    m_ingested += batch.ordinals.size();
+    qDebug() << "Processed " << m_ingested << " of " << m_layout.codes.length();
+}
 
-           // Get the grid size
-           int width = ceil(sqrt(codes.length()));
-           double spacing = (aoi.xMax() - aoi.xMin()) / width;
+void DisplayMilitarySymbols::materialize(int shardIndex, int ordinal, const QPointF& dPosition, const QPointF& uPosition) {
+    Shard& shard = m_shards[shardIndex];
+    const QString& code = m_layout.codes.at(ordinal);
 
-           // Create features within the grid
-           int count = 0;
-           for (double x = aoi.xMin(); x <= aoi.xMax(); x += spacing) {
-               if (count >= codes.length())
-                   break;
+    // Add the Features to the tables
+    m_pendingIngest += 2;
+    const CatalogSymbolEngine::Features features = CatalogSymbolEngine::addFeatures(shard.dTable, shard.uTable, FieldName, code, dPosition, uPosition, this);
+    Feature* dFeature = features.dFeature;
+    Feature* uFeature = features.uFeature;
 
-               for (double y = aoi.yMax(); y >= aoi.yMin(); y -= spacing) {
-                   if (count >= codes.length())
-                       break;
+    Resident& resident = m_residents[ordinal];
+    resident.dFeature = dFeature;
+    resident.uFeature = uFeature;
+    resident.symbol = m_filter.addSymbol(code, QList<Feature*>() << dFeature << uFeature);
+    m_residentCount++;
 
-                   Feature* dFeature = m_dTable->createFeature(this);
-                   Feature* uFeature = m_uTable->createFeature(this);
+    m_hitTester.addFeature(dFeature, code, dPosition.x(), dPosition.y(), DictionaryGroup, resident.symbol);
+    m_hitTester.addFeature(uFeature, code, uPosition.x(), uPosition.y(), UniqueValueGroup, resident.symbol);
 
-                   Point dPoint = Point(x, y, SpatialReference(4326));
-                   Point uPoint = Point(x + (spacing * 0.5), y, SpatialReference(4326));
+    if (!shard.codes.contains(code))
+        symbolize(shard, code, dFeature);
+}
 
-                   dFeature->setGeometry(dPoint);
-                   uFeature->setGeometry(uPoint);
+void DisplayMilitarySymbols::materializeCell(int cell) {
+    const QVector<int> ordinals = m_cells.value(cell);
+    m_residency.insert(cell, ordinals.size() * FeatureBytes);
 
-                   dFeature->attributes()->replaceAttribute(FieldName, codes[count]);
-                   uFeature->attributes()->replaceAttribute(FieldName, codes[count]);
+    for (int ordinal : ordinals) {
+        if (m_residents.at(ordinal).dFeature)
+            continue;
 
-                   m_dFeatures.push_back(dFeature);
-                   m_uFeatures.push_back(uFeature);
+        const QPointF position = m_layout.positions.at(ordinal);
+        materialize(m_ordinalShards.at(ordinal), ordinal, position, QPointF(position.x() + (m_layout.spacing * 0.5), position.y()));
+    }
+}
 
-                   // Add the FEature to the table
-                   m_dTable->addFeature(dFeature);
-                   m_uTable->addFeature(uFeature);
+void DisplayMilitarySymbols::evictCell(int cell) {
+    // One delete per table
+    QHash<FeatureTable*, QList<Feature*>> deleted;
 
-                   QString json = m_dRend->symbol(dFeature)->toJson();
-                   //qDebug() << json;
+    for (int ordinal : m_cells.value(cell)) {
+        Resident& resident = m_residents[ordinal];
+        if (!resident.dFeature)
+            continue;
 
-                   //MultilayerPointSymbol* symbol = (MultilayerPointSymbol*) MultilayerPointSymbol::fromJson(json);
-                   MultilayerPointSymbol* symbol = (MultilayerPointSymbol*) m_dRend->symbol(dFeature);
-                   symbol->setSize(symbol->size() * 2);
+        const QPointF position = m_layout.positions.at(ordinal);
+        m_hitTester.removeFeature(resident.dFeature, position.x(), position.y());
+        m_hitTester.removeFeature(resident.uFeature, position.x() + (m_layout.spacing * 0.5), position.y());
+        m_filter.removeSymbol(resident.symbol);
 
-                   UniqueValue* uval = new UniqueValue(codes[count], codes[count], QVariantList() << codes[count], symbol, this);
-                   m_uRend->uniqueValues()->append(uval);
+        deleted[resident.dFeature->featureTable()].append(resident.dFeature);
+        deleted[resident.uFeature->featureTable()].append(resident.uFeature);
 
-                   count++;
+        resident = Resident();
+        m_residentCount--;
+    }
 
-                   qDebug() << "Processed " << count << " of " << codes.length();
-               }
-           }
-        });
+    for (auto it = deleted.constBegin(); it != deleted.constEnd(); ++it) {
+        it.key()->deleteFeatures(it.value());
+        for (Feature* feature : it.value())
+            feature->deleteLater();
+    }
+}
+
+void DisplayMilitarySymbols::updateResidency() {
+    if (m_residency.budget() == 0 || m_cells.isEmpty() || m_cellSize <= 0.0)
+        return;
+
+    const Envelope visible = GeometryEngine::project(m_mapView->visibleArea(), SpatialReference(4326)).extent();
+    if (visible.isEmpty())
+        return;
+
+    // One cell of margin around the view, so panning does not show holes
+    const QPoint first = cellAt(QPointF(visible.xMin(), visible.yMin())) - QPoint(1, 1);
+    const QPoint last = cellAt(QPointF(visible.xMax(), visible.yMax())) + QPoint(1, 1);
+    const QPointF center((visible.xMin() + visible.xMax()) * 0.5, (visible.yMin() + visible.yMax()) * 0.5);
+
+    QSet<int> visibleCells;
+    QList<QPair<double, int>> missing;
+    for (int x = qMax(0, first.x()); x <= qMin(m_cellColumns - 1, last.x()); x++) {
+        for (int y = qMax(0, first.y()); y <= qMin(m_cellRows - 1, last.y()); y++) {
+            const int key = cellKey(QPoint(x, y));
+            if (!m_cells.contains(key))
+                continue;
+
+            visibleCells.insert(key);
+            if (!m_residency.touch(key)) {
+                const QPointF offset = m_cellOrigin + QPointF((x + 0.5) * m_cellSize, (y + 0.5) * m_cellSize) - center;
+                missing.append(qMakePair(offset.x() * offset.x() + offset.y() * offset.y(), key));
+            }
+        }
+    }
+
+    for (int cell : m_residency.evict(visibleCells))
+        evictCell(cell);
+
+    // Nearest the center first, as far as the budget goes
+    std::sort(missing.begin(), missing.end());
+    bool materialized = false;
+    for (const QPair<double, int>& cell : missing) {
+        if (!m_residency.fits(m_cells.value(cell.second).size() * FeatureBytes))
+            break;
+
+        materializeCell(cell.second);
+        materialized = true;
+    }
+
+    if (!materialized)
+        return;
+
+    flushUniqueValues();
+
+    // The filter only knows the features it was applied to
+    if (!m_filter.expression().isEmpty())
+        m_filter.apply(m_filter.expression(), QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer);
+}
+
+void DisplayMilitarySymbols::flushUniqueValues() {
+    // One change per renderer instead of one per unique value
+    for (Shard& shard : m_shards) {
+        for (UniqueValue* uval : shard.values)
+            shard.uRend->uniqueValues()->append(uval);
+        shard.values.clear();
+    }
+}
+
+QPoint DisplayMilitarySymbols::cellAt(const QPointF& position) const {
+    if (m_cellSize <= 0.0)
+        return QPoint();
+
+    return QPoint(static_cast<int>(std::floor((position.x() - m_cellOrigin.x()) / m_cellSize)),
+                  static_cast<int>(std::floor((position.y() - m_cellOrigin.y()) / m_cellSize)));
+}
+
+int DisplayMilitarySymbols::cellKey(const QPoint& cell) {
+    return (cell.x() << 16) | (cell.y() & 0xFFFF);
+}
+
+void DisplayMilitarySymbols::setMemoryBudget(qint64 bytes) {
+    m_residency.setBudget(bytes);
+
+    // The symbols take a small share, there are only as many as codes
+    m_symbolCache.setBudget(bytes / SymbolBudgetShare);
+
+    if (m_loaded)
+        updateResidency();
+}
+
+QVariantMap DisplayMilitarySymbols::residencyStats() const {
+    const ResidencyStats stats = m_residency.stats();
+
+    QVariantMap result;
+    result["budgetBytes"] = stats.budgetBytes;
+    result["residentBytes"] = stats.residentBytes;
+    result["residentCells"] = stats.residentCount;
+    result["cells"] = m_cells.size();
+    result["residentFeatures"] = m_residentCount * 2;
+    result["materializations"] = stats.materializations;
+    result["evictions"] = stats.evictions;
+    result["symbolBytes"] = m_symbolCache.bytes();
+    result["symbolEvictions"] = m_symbolCache.evictions();
+    return result;
+}
+
+void DisplayMilitarySymbols::symbolize(Shard& shard, const QString& code, Feature* dFeature) {
+    static const int SymbolizeStage = AllocationProfiler::stage("symbolize");
+    AllocationScope allocationScope(SymbolizeStage);
+
+    QString json = m_symbolCache.resolve(code, [this, dFeature]() {
+        return m_dRend->symbol(dFeature)->toJson();
+    });
+
+    // From the JSON, so a restored session does not touch the dictionary
+    MultilayerPointSymbol* symbol = CatalogSymbolEngine::uniqueValueSymbol(json, this);
+    m_hitTester.setGroupSymbolSize(DictionaryGroup, symbol->size());
+    symbol->setSize(symbol->size() * 2);
+    m_hitTester.setGroupSymbolSize(UniqueValueGroup, symbol->size());
+
+    // Held back until the renderer stage
+    shard.values.append(new UniqueValue(code, code, QVariantList() << code, symbol, this));
+    shard.codes.insert(code);
+}
+
+void DisplayMilitarySymbols::applyRenderers() {
+    flushUniqueValues();
+
+    emit shardsChanged();
+
+    if (!m_exportPath.isEmpty())
+        exportColumns(m_exportPath);
+
+    m_loaded = true;
+    if (!m_regressionBaseline.isEmpty())
+        startRegression();
+
+    if (!m_feedBacklog.isEmpty()) {
+        const QVector<FeatureUpdate> backlog = m_feedBacklog;
+        m_feedBacklog.clear();
+        applyFeedUpdates(backlog);
+    }
+
+    buildSearchIndex();
+    loadTracks();
+    loadGraphics();
+    updateResidency();
+
+    if (m_tileLayer && m_tilePyramid.fingerprint() != catalogFingerprint())
+        qDebug() << "Tiles in " << m_tileCachePath << " were rendered from another catalog";
+
+    if (!m_tileRoot.isEmpty())
+        startTileGeneration();
+}
 
+quint64 DisplayMilitarySymbols::catalogFingerprint() const {
+    return SnapshotReader::fingerprint(m_stylePath) ^ (static_cast<quint64>(qHash(m_layout.codes)) << 32) ^ m_layout.codes.size();
+}
+
+QByteArray DisplayMilitarySymbols::workloadKey() const {
+    // Known before the catalog is generated, so a snapshot of another
+    // workload is rebuilt like one of another style
+    QByteArray key = m_usePatterns ? "patterns " + QByteArray::number(m_patternSpace.fingerprint())
+                                   : "workload " + QByteArray::number(m_workload.fingerprint());
+    key += ' ' + QByteArray::number(m_workloadCount) + ' ' + QByteArray::number(m_workloadSkip);
+    key += ' ' + m_importPath.toUtf8();
+    return key;
+}
+
+void DisplayMilitarySymbols::setTileGeneration(const QString& root, int minLevel, int maxLevel) {
+    m_tileRoot = root;
+    m_tileMinLevel = minLevel;
+    m_tileMaxLevel = maxLevel;
+}
+
+void DisplayMilitarySymbols::startTileGeneration() {
+    TilePyramid pyramid;
+    pyramid.setExtent(catalogExtent());
+    pyramid.setLevels(m_tileMinLevel, m_tileMaxLevel);
+    pyramid.setFingerprint(catalogFingerprint());
+
+    // Only the catalog goes into the tiles
+    QList<Layer*> hidden;
+    for (int i = 0; i < m_map->basemap()->baseLayers()->size(); i++)
+        hidden.append(m_map->basemap()->baseLayers()->at(i));
+    // and the features are drawn at every level
+    if (m_tileLayer) {
+        hidden.append(m_tileLayer);
+        m_layers.dLayer->setMinScale(0.0);
+        m_layers.uLayer->setMinScale(0.0);
+    }
+
+    m_tileGenerator = new TileGenerator(m_mapView, this);
+    m_tileGenerator->setHiddenLayers(hidden);
+
+    connect(m_tileGenerator, &TileGenerator::finished, this, [this](const QString&, int written) {
+        emit tilesGenerated(written);
+    });
+    connect(m_tileGenerator, &TileGenerator::failed, this, [this](const QString& error) {
+        qDebug() << "Tiles not generated: " << error;
+        emit tilesGenerated(0);
+    });
+
+    m_tileGenerator->start(pyramid, m_tileRoot);
+}
+
+void DisplayMilitarySymbols::setTileCachePath(const QString& root) {
+    m_tileCachePath = root;
+}
+
+void DisplayMilitarySymbols::addTileLayer() {
+    if (m_tileCachePath.isEmpty() || m_tileLayer)
+        return;
+
+    QString error;
+    if (!m_tilePyramid.load(m_tileCachePath, &error)) {
+        qDebug() << "Tiles not loaded: " << error;
+        return;
+    }
+
+    // Every level down to the deepest, the runtime asks for the levels
+    // without tiles as well
+    QList<LevelOfDetail> levels;
+    for (int level = 0; level <= m_tilePyramid.maxLevel(); level++)
+        levels.append(LevelOfDetail(level, TilePyramid::resolution(level), TilePyramid::scale(level)));
+
+    const SpatialReference webMercator = SpatialReference::webMercator();
+    const QPointF origin = TilePyramid::origin();
+    const TileInfo tileInfo(96, TileImageFormat::PNG, levels, Point(origin.x(), origin.y(), webMercator), webMercator, TilePyramid::TileSize, TilePyramid::TileSize);
+
+    const QRectF extent = m_tilePyramid.extent();
+    const QPointF lowerLeft = TilePyramid::toWebMercator(extent.topLeft());
+    const QPointF upperRight = TilePyramid::toWebMercator(extent.bottomRight());
+    const Envelope fullExtent(lowerLeft.x(), lowerLeft.y(), upperRight.x(), upperRight.y(), webMercator);
+
+    m_tileLayer = new ServiceImageTiledLayer(tileInfo, fullExtent, this);
+
+    // Tiles beyond the pyramid are left empty
+    const QString root = m_tileCachePath;
+    connect(m_tileLayer, &ServiceImageTiledLayer::tileUrlRequest, this, [this, root](const TileKey& tileKey) {
+        PyramidTile tile;
+        tile.level = tileKey.level();
+        tile.column = tileKey.column();
+        tile.row = tileKey.row();
+
+        const QString path = TilePyramid::tilePath(root, tile);
+        m_tileLayer->setTileUrl(tileKey, QFile::exists(path) ? QUrl::fromLocalFile(path) : QUrl());
+    });
+
+    // The features take over once the tiles would be magnified
+    const double handover = TilePyramid::scale(m_tilePyramid.maxLevel()) / 2.0;
+    m_tileLayer->setMaxScale(handover);
+    m_layers.dLayer->setMinScale(handover);
+    m_layers.uLayer->setMinScale(handover);
+
+    m_map->operationalLayers()->insert(0, m_tileLayer);
+}
+
+QRectF DisplayMilitarySymbols::catalogExtent() const {
+    QRectF extent;
+    for (const QPointF& position : m_layout.positions)
+        extent |= QRectF(position, QSizeF(m_layout.spacing, m_layout.spacing));
+
+    return extent;
+}
+
+void DisplayMilitarySymbols::loadTracks() {
+    if (m_tracksPath.isEmpty() && m_syntheticTracks <= 0)
+        return;
+
+    const QString path = m_tracksPath;
+    const int count = m_syntheticTracks;
+    const SidcWorkload workload = m_workload;
+
+    // Synthetic tracks walk over the catalog
+    const QRectF extent = catalogExtent();
+
+    m_pipeline->run<TrackHistory>("tracks", [path, count, workload, extent]() {
+        TrackHistory history;
+        if (!path.isEmpty()) {
+            QString error;
+            if (!TrackHistory::load(path, &history, &error))
+                qDebug() << "Tracks not loaded: " << error;
+            return history;
+        }
+
+        // A day from a fixed midnight UTC, a sample every TrackStepMs, and
+        // the walks from the workload seed, so every run plays the same
+        const qint64 startMs = QDateTime(TrackEpoch, QTime(0, 0), Qt::UTC).toMSecsSinceEpoch();
+        return TrackHistory::generate(workload.generate(count), extent, startMs, TrackSpanMs, TrackStepMs, workload.seed());
+    }, [this](const TrackHistory& history) {
+        m_playback->setHistory(history);
+    });
+}
+
+void DisplayMilitarySymbols::setTracksPath(const QString& path) {
+    m_tracksPath = path;
+}
+
+void DisplayMilitarySymbols::setSyntheticTracks(int count) {
+    m_syntheticTracks = count;
+}
+
+TrackPlayback* DisplayMilitarySymbols::playback() const {
+    return m_playback;
+}
+
+void DisplayMilitarySymbols::setTacticalGraphics(int count) {
+    m_graphicCount = count;
+}
+
+void DisplayMilitarySymbols::loadGraphics() {
+    if (m_graphicCount <= 0)
+        return;
+
+    const int count = m_graphicCount;
+    const QRectF extent = catalogExtent();
+    const ScaleBands bands = m_graphicBands;
+
+    // The shapes and every level of them are computed on the worker, a
+    // change of band only swaps the geometries
+    m_pipeline->run<QVector<TacticalGraphic>>("graphics", [count, extent, bands]() {
+        return generateGraphics(count, extent, bands);
+    }, [this](const QVector<TacticalGraphic>& graphics) {
+        createGraphics(graphics);
+    });
+}
+
+QVector<DisplayMilitarySymbols::TacticalGraphic> DisplayMilitarySymbols::generateGraphics(int count, const QRectF& extent, const ScaleBands& bands) {
+    QVector<TacticalGraphic> graphics;
+    graphics.reserve(count);
+
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::normal_distribution<double> turn(0.0, 0.15);
+
+    const double reach = qMin(extent.width(), extent.height());
+
+    for (int i = 0; i < count; i++) {
+        TacticalGraphic graphic;
+        graphic.area = (i % 5) >= 3;
+
+        const QPointF origin(extent.left() + unit(generator) * extent.width(), extent.top() + unit(generator) * extent.height());
+
+        QVector<QPointF> points;
+        points.reserve(GraphicVertices + 1);
+
+        if (graphic.area) {
+            graphic.sidc = AreaGraphicCodes.at(i % AreaGraphicCodes.size());
+
+            // A wavy ring, so every band has something to simplify
+            const double radius = reach * (0.01 + 0.04 * unit(generator));
+            const double phase = 2.0 * M_PI * unit(generator);
+            for (int v = 0; v < GraphicVertices; v++) {
+                const double angle = 2.0 * M_PI * v / GraphicVertices;
+                const double r = radius * (1.0 + 0.15 * std::sin(7.0 * angle + phase) + 0.05 * std::sin(31.0 * angle) + 0.01 * unit(generator));
+                points.append(QPointF(origin.x() + r * std::cos(angle), origin.y() + r * std::sin(angle)));
+            }
+            points.append(points.first());
+        }
+        else {
+            graphic.sidc = LineGraphicCodes.at(i % LineGraphicCodes.size());
+
+            // A random walk a quarter of the extent long
+            const double step = reach / (4.0 * GraphicVertices);
+            double heading = 2.0 * M_PI * unit(generator);
+            QPointF position = origin;
+            for (int v = 0; v < GraphicVertices; v++) {
+                points.append(position);
+                heading += turn(generator);
+                position += QPointF(step * std::cos(heading), step * std::sin(heading));
+            }
+        }
+
+        graphic.levels = LineGeneralizer::levels(points, bands, GeneralizePixels, graphic.area);
+        graphics.append(graphic);
+    }
+
+    return graphics;
+}
+
+void DisplayMilitarySymbols::createGraphics(const QVector<TacticalGraphic>& graphics) {
+    QList<Field> fields;
+    fields.push_back(Field::createText(FieldName, FieldName, 15));
+
+    // Drawn by the dictionary style like the point symbols
+    m_lineTable = new FeatureCollectionTable(fields, GeometryType::Polyline, SpatialReference(4326), this);
+    m_areaTable = new FeatureCollectionTable(fields, GeometryType::Polygon, SpatialReference(4326), this);
+    m_lineTable->setRenderer(new DictionaryRenderer(m_style, this));
+    m_areaTable->setRenderer(new DictionaryRenderer(m_style, this));
+
+    // Areas below the lines
+    m_layers.uCollection->tables()->append(m_areaTable);
+    m_layers.uCollection->tables()->append(m_lineTable);
+
+    m_graphics = graphics;
+    for (TacticalGraphic& graphic : m_graphics) {
+        FeatureCollectionTable* table = graphic.area ? m_areaTable : m_lineTable;
+        graphic.feature = table->createFeature(this);
+        graphic.feature->attributes()->replaceAttribute(FieldName, graphic.sidc);
+    }
+
+    // Added with the geometries of the current band
+    m_graphicBand = -1;
+    generalizeGraphics();
+
+    QList<Feature*> lines;
+    QList<Feature*> areas;
+    for (const TacticalGraphic& graphic : m_graphics)
+        (graphic.area ? areas : lines).append(graphic.feature);
+
+    m_lineTable->addFeatures(lines);
+    m_areaTable->addFeatures(areas);
+
+    connect(m_mapView, &MapQuickView::mapScaleChanged, this, &DisplayMilitarySymbols::generalizeGraphics);
+}
+
+void DisplayMilitarySymbols::generalizeGraphics() {
+    const int band = m_graphicBands.bandForScale(m_mapView->mapScale());
+    if (band == m_graphicBand)
+        return;
+
+    const bool added = m_graphicBand >= 0;
+    m_graphicBand = band;
+
+    QList<Feature*> lines;
+    QList<Feature*> areas;
+    for (TacticalGraphic& graphic : m_graphics) {
+        const QVector<QPointF>& level = graphic.levels.at(band);
+
+        if (graphic.area) {
+            PolygonBuilder builder(SpatialReference(4326));
+            for (const QPointF& point : level)
+                builder.addPoint(point.x(), point.y());
+            graphic.feature->setGeometry(builder.toGeometry());
+            areas.append(graphic.feature);
+        }
+        else {
+            PolylineBuilder builder(SpatialReference(4326));
+            for (const QPointF& point : level)
+                builder.addPoint(point.x(), point.y());
+            graphic.feature->setGeometry(builder.toGeometry());
+            lines.append(graphic.feature);
+        }
+    }
+
+    // Before the first band the features are not in the tables yet
+    if (added) {
+        m_lineTable->updateFeatures(lines);
+        m_areaTable->updateFeatures(areas);
+    }
+}
+
+void DisplayMilitarySymbols::buildSearchIndex() {
+    const QStringList codes = m_layout.codes;
+    const QString stylePath = m_stylePath;
+
+    // The names are read from the style on the worker as well
+    m_pipeline->run<SymbolSearchIndex>("search", [codes, stylePath]() {
+        QString error;
+        const QHash<QString, QString> names = SymbolSearchIndex::styleNames(stylePath, &error);
+        if (!error.isEmpty())
+            qDebug() << "No symbol names: " << error;
+
+        SymbolSearchIndex index;
+        for (int ordinal = 0; ordinal < codes.size(); ordinal++)
+            index.add(ordinal, codes.at(ordinal), SymbolSearchIndex::describe(codes.at(ordinal), names));
+
+        return index;
+    }, [this](const SymbolSearchIndex& index) {
+        m_search = index;
+    });
+}
+
+QVariantList DisplayMilitarySymbols::search(const QString& text, int count) {
+    QElapsedTimer timer;
+    timer.start();
+
+    const QVector<SymbolSearchIndex::Match> matches = m_search.search(text, count);
+
+    m_searchMs = timer.nsecsElapsed() / 1000000.0;
+    emit searched();
+
+    QVariantList results;
+    for (const SymbolSearchIndex::Match& match : matches) {
+        QVariantMap result;
+        result["sidc"] = match.sidc;
+        result["name"] = match.name;
+        results.append(result);
+    }
+
+    return results;
+}
+
+double DisplayMilitarySymbols::searchMs() const {
+    return m_searchMs;
+}
+
+void DisplayMilitarySymbols::showSymbol(const QString& sidc) {
+    const int ordinal = m_search.ordinal(sidc);
+    if (ordinal < 0 || ordinal >= m_residents.size())
+        return;
+
+    // Bring back the cell if it was evicted
+    if (!m_residents.at(ordinal).dFeature) {
+        materializeCell(m_ordinalCells.at(ordinal));
+        flushUniqueValues();
+    }
+
+    Feature* feature = m_residents.at(ordinal).dFeature;
+
+    // Keep the scale, only pan
+    const Point location(feature->geometry());
+    m_mapView->setViewpoint(Viewpoint(location, m_mapView->mapScale()));
+
+    selectFeature(feature);
+    emit symbolSelected(sidc);
+}
+
+void DisplayMilitarySymbols::runRegression(const QString& baselinePath, const QString& reportPath) {
+    m_regressionBaseline = baselinePath;
+    m_regressionReport = reportPath;
+
+    // Wait for the catalog, applyRenderers will start the regression
+    if (m_loaded)
+        startRegression();
+}
+
+void DisplayMilitarySymbols::startRegression() {
+    SymbolRegression* regression = new SymbolRegression(this);
+
+    QSet<QString> seen;
+    for (const Shard& shard : m_shards) {
+        for (int i = 0; i < shard.uRend->uniqueValues()->size(); i++) {
+            UniqueValue* uval = shard.uRend->uniqueValues()->at(i);
+            const QString code = uval->values().first().toString();
+            if (seen.contains(code))
+                continue;
+            seen.insert(code);
+
+            // Resolved again, a cached symbol would hide a changed style
+            Feature* feature = shard.dTable->createFeature(regression);
+            feature->attributes()->replaceAttribute(FieldName, code);
+
+            regression->addSymbol(code, "dictionary", m_dRend->symbol(feature));
+            regression->addSymbol(code, "uniquevalue", Symbol::fromJson(uval->symbol()->toJson()));
+        }
+    }
+
+    connect(regression, &SymbolRegression::finished, this, [this, regression](int changes) {
+        regression->deleteLater();
+        m_regressionBaseline.clear();
+        emit regressionFinished(changes);
+    });
+
+    regression->start(m_regressionBaseline, m_regressionReport);
+}
+
+void DisplayMilitarySymbols::setPartition(ShardPlanner::Partition partition) {
+    m_partition = partition;
+}
+
+QStringList DisplayMilitarySymbols::shardKeys() const {
+    QStringList keys;
+    for (const Shard& shard : m_shards)
+        keys.append(shard.key);
+
+    return keys;
+}
+
+void DisplayMilitarySymbols::setShardVisible(const QString& key, bool visible) {
+    for (const Shard& shard : m_shards) {
+        if (shard.key != key)
+            continue;
+
+        // Each table of a collection is shown by a layer of its own
+        for (FeatureCollectionLayer* collectionLayer : QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer) {
+            for (FeatureLayer* layer : collectionLayer->layers()) {
+                if (layer->featureTable() == shard.dTable || layer->featureTable() == shard.uTable)
+                    layer->setVisible(visible);
+            }
+        }
+    }
+}
+
+bool DisplayMilitarySymbols::applyFilter(const QString& expression) {
+    QString error;
+    if (!m_filter.apply(expression, QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer, &error)) {
+        qDebug() << "Invalid filter: " << error;
+        return false;
+    }
+
+    return true;
+}
+
+QString DisplayMilitarySymbols::allocationReport() const {
+    return AllocationProfiler::report();
+}
+
+RenderTelemetry* DisplayMilitarySymbols::telemetry() const {
+    return m_telemetry;
+}
+
+FeatureFeed* DisplayMilitarySymbols::feed() const {
+    return m_feed;
+}
+
+void DisplayMilitarySymbols::applyFeedUpdates(const QVector<FeatureUpdate>& updates) {
+    // The symbols are resolved from the style, held back until it is used
+    if (!m_loaded) {
+        m_feedBacklog += updates;
+        return;
+    }
+
+    if (m_feedShard < 0) {
+        CatalogShard plan;
+        plan.key = "feed";
+        createShard(plan);
+        m_feedShard = m_shards.size() - 1;
+        emit shardsChanged();
+    }
+
+    Shard& shard = m_shards[m_feedShard];
+
+    for (const FeatureUpdate& update : updates) {
+        const QPointF position(update.x, update.y);
+        const QString sidc = m_converter.normalize(update.sidc, SidcConverter::RevisionC);
+        auto it = m_feedFeatures.find(update.id);
+
+        if (update.kind == FeatureUpdate::Remove) {
+            if (it == m_feedFeatures.end())
+                continue;
+
+            m_hitTester.removeFeature(it->dFeature, it->position.x(), it->position.y());
+            m_hitTester.removeFeature(it->uFeature, it->position.x() + (m_layout.spacing * 0.5), it->position.y());
+            m_filter.removeSymbol(it->symbol);
+
+            shard.dTable->deleteFeature(it->dFeature);
+            shard.uTable->deleteFeature(it->uFeature);
+            it->dFeature->deleteLater();
+            it->uFeature->deleteLater();
+
+            m_feedFeatures.erase(it);
+            continue;
+        }
+
+        // An add of a known id moves it, an update of an unknown one adds it
+        if (it == m_feedFeatures.end()) {
+            if (sidc.isEmpty())
+                continue;
+
+            FeedFeature feedFeature;
+            feedFeature.dFeature = shard.dTable->createFeature(this);
+            feedFeature.uFeature = shard.uTable->createFeature(this);
+            placeFeedFeature(feedFeature, sidc, position);
+
+            m_pendingIngest += 2;
+            shard.dTable->addFeature(feedFeature.dFeature);
+            shard.uTable->addFeature(feedFeature.uFeature);
+
+            m_feedFeatures.insert(update.id, feedFeature);
+            continue;
+        }
+
+        m_hitTester.removeFeature(it->dFeature, it->position.x(), it->position.y());
+        m_hitTester.removeFeature(it->uFeature, it->position.x() + (m_layout.spacing * 0.5), it->position.y());
+        m_filter.removeSymbol(it->symbol);
+
+        placeFeedFeature(*it, sidc.isEmpty() ? it->sidc : sidc, position);
+
+        shard.dTable->updateFeature(it->dFeature);
+        shard.uTable->updateFeature(it->uFeature);
+    }
+
+    // Unlike the catalog, the feed has no renderer stage to wait for
+    flushUniqueValues();
+
+    // Added and moved symbols are drawn until the filter is applied again,
+    // only the changed ones are sent to the layers
+    if (!m_filter.expression().isEmpty())
+        m_filter.apply(m_filter.expression(), QList<FeatureCollectionLayer*>() << m_layers.dLayer << m_layers.uLayer);
+}
+
+void DisplayMilitarySymbols::placeFeedFeature(FeedFeature& feedFeature, const QString& sidc, const QPointF& position) {
+    const Point dPoint(position.x(), position.y(), SpatialReference(4326));
+    const Point uPoint(position.x() + (m_layout.spacing * 0.5), position.y(), SpatialReference(4326));
+
+    feedFeature.dFeature->setGeometry(dPoint);
+    feedFeature.uFeature->setGeometry(uPoint);
+    feedFeature.dFeature->attributes()->replaceAttribute(FieldName, sidc);
+    feedFeature.uFeature->attributes()->replaceAttribute(FieldName, sidc);
+
+    feedFeature.sidc = sidc;
+    feedFeature.position = position;
+    feedFeature.symbol = m_filter.addSymbol(sidc, QList<Feature*>() << feedFeature.dFeature << feedFeature.uFeature);
+
+    m_hitTester.addFeature(feedFeature.dFeature, sidc, dPoint.x(), dPoint.y(), DictionaryGroup, feedFeature.symbol);
+    m_hitTester.addFeature(feedFeature.uFeature, sidc, uPoint.x(), uPoint.y(), UniqueValueGroup, feedFeature.symbol);
+
+    // Each code is resolved once for the feed
+    Shard& shard = m_shards[m_feedShard];
+    if (!shard.codes.contains(sidc))
+        symbolize(shard, sidc, feedFeature.dFeature);
+}
+
+SymbolHitTester::Hit DisplayMilitarySymbols::hitTest(const QMouseEvent& mouseEvent) {
+    // The dictionary table is shown by uLayer, the unique value table by dLayer
+    m_hitTester.setGroupVisible(DictionaryGroup, m_layers.uLayer->isVisible());
+    m_hitTester.setGroupVisible(UniqueValueGroup, m_layers.dLayer->isVisible());
+
+    // Hit test in the spatial reference of the tables, measuring one pixel
+    // to convert the symbol sizes
+    const Point location = GeometryEngine::project(m_mapView->screenToLocation(mouseEvent.x(), mouseEvent.y()), SpatialReference(4326));
+    const Point next = GeometryEngine::project(m_mapView->screenToLocation(mouseEvent.x() + 1, mouseEvent.y()), SpatialReference(4326));
+
+    return m_hitTester.hitTest(location.x(), location.y(), std::abs(next.x() - location.x()), [this](int symbol) {
+        return m_filter.isVisible(symbol);
+    });
+}
+
+void DisplayMilitarySymbols::selectFeature(Feature* feature) {
+    QList<FeatureCollectionLayer*> layers;
+    layers << m_layers.dLayer << m_layers.uLayer;
+
+    for (FeatureCollectionLayer* collectionLayer : layers) {
+        for (FeatureLayer* layer : collectionLayer->layers()) {
+            layer->clearSelection();
+            if (feature && layer->featureTable() == feature->featureTable())
+                layer->selectFeature(feature);
+        }
+    }
+}
+
+void DisplayMilitarySymbols::setWorkload(const SidcWorkload& workload, int count, int skip) {
+    m_workload = workload;
+    m_workloadCount = count;
+    m_workloadSkip = skip;
+    m_usePatterns = false;
+}
 
-        style->load();
+void DisplayMilitarySymbols::setPatternSpace(const SidcPatternSpace& space, int count, int skip) {
+    m_patternSpace = space;
+    m_workloadCount = count;
+    m_workloadSkip = skip;
+    m_usePatterns = true;
 }
 
-QStringList DisplayMilitarySymbols::GenerateSymbolCodes(int count, int skip) {
+QStringList DisplayMilitarySymbols::GenerateSymbolCodes(const SidcWorkload& workload, int count, int skip) {
+    // Synthetic workload, reproducible from its seed
     if (count > 0)
-        count++;
+        return workload.generate(count, skip);
 
+    // The built-in catalog, the wider catalogs come from the workload
+    // and pattern options
     QStringList codes;
     codes << "IFAPSCC--------" << "IFAPSCO--------" << "IFAPSCP--------" << "IFAPSCS--------" << "IFAPSRAI-------" << "IFAPSRAS-------" << "IFAPSRC--------" << "IFAPSRD--------" << "IFAPSRE--------" << "IFAPSRF--------" << "IFAPSRI--------";
     codes << "IFAPSRMA-------" << "IFAPSRMD-------" << "IFAPSRMF-------" << "IFAPSRMG-------" << "IFAPSRMT-------" << "IFAPSRTA-------" << "IFAPSRTI-------" << "IFAPSRTT-------" << "IFAPSRU--------" << "IFGPSCC--------" << "IFGPSCO--------";
-    /*
-    codes << "IFGPSCP--------" << "IFGPSCS--------" << "IFGPSCT--------" << "IFGPSRAA-------" << "IFGPSRAT-------" << "IFGPSRB--------" << "IFGPSRCA-------" << "IFGPSRCS-------" << "IFGPSRD--------" << "IFGPSRE--------" << "IFGPSRF--------";
-    codes << "IFGPSRH--------" << "IFGPSRI--------" << "IFGPSRMA-------" << "IFGPSRMF-------" << "IFGPSRMG-------" << "IFGPSRMM-------" << "IFGPSRMT-------" << "IFGPSRS--------" << "IFGPSRTA-------" << "IFGPSRTI-------" << "IFGPSRTT-------";
-    codes << "IFGPSRU--------" << "IFPPSCD--------" << "IFPPSRD--------" << "IFPPSRE--------" << "IFPPSRI--------" << "IFPPSRM--------" << "IFPPSRS--------" << "IFPPSRT--------" << "IFPPSRU--------" << "IFSPSCC--------" << "IFSPSCO--------";
-    codes << "IFSPSCP--------" << "IFSPSCS--------" << "IFSPSRAA-------" << "IFSPSRAT-------" << "IFSPSRCA-------" << "IFSPSRCI-------" << "IFSPSRD--------" << "IFSPSRE--------" << "IFSPSRF--------" << "IFSPSRH--------" << "IFSPSRI--------";
-    codes << "IFSPSRMA-------" << "IFSPSRMF-------" << "IFSPSRMG-------" << "IFSPSRMM-------" << "IFSPSRMT-------" << "IFSPSRS--------" << "IFSPSRTA-------" << "IFSPSRTI-------" << "IFSPSRTT-------" << "IFSPSRU--------" << "IFUPSCO--------";
-    codes << "IFUPSCP--------" << "IFUPSCS--------" << "IFUPSRD--------" << "IFUPSRE--------" << "IFUPSRM--------" << "IFUPSRS--------" << "IFUPSRT--------" << "IFUPSRU--------" << "IHAPSCC--------" << "IHAPSCO--------" << "IHAPSCP--------";
-    codes << "IHAPSCS--------" << "IHAPSRAI-------" << "IHAPSRAS-------" << "IHAPSRC--------" << "IHAPSRD--------" << "IHAPSRE--------" << "IHAPSRF--------" << "IHAPSRI--------" << "IHAPSRMA-------" << "IHAPSRMD-------" << "IHAPSRMF-------";
-    codes << "IHAPSRMG-------" << "IHAPSRMT-------" << "IHAPSRTA-------" << "IHAPSRTI-------" << "IHAPSRTT-------" << "IHAPSRU--------" << "IHGPSCC--------" << "IHGPSCO--------" << "IHGPSCP--------" << "IHGPSCS--------" << "IHGPSCT--------";
-    codes << "IHGPSRAA-------" << "IHGPSRAT-------" << "IHGPSRB--------" << "IHGPSRCA-------" << "IHGPSRCS-------" << "IHGPSRD--------" << "IHGPSRE--------" << "IHGPSRF--------" << "IHGPSRH--------" << "IHGPSRI--------" << "IHGPSRMA-------";
-    codes << "IHGPSRMF-------" << "IHGPSRMG-------" << "IHGPSRMM-------" << "IHGPSRMT-------" << "IHGPSRS--------" << "IHGPSRTA-------" << "IHGPSRTI-------" << "IHGPSRTT-------" << "IHGPSRU--------" << "IHPPSCD--------" << "IHPPSRD--------";
-    codes << "IHPPSRE--------" << "IHPPSRI--------" << "IHPPSRM--------" << "IHPPSRS--------" << "IHPPSRT--------" << "IHPPSRU--------" << "IHSPSCC--------" << "IHSPSCO--------" << "IHSPSCP--------" << "IHSPSCS--------" << "IHSPSRAA-------";
-    codes << "IHSPSRAT-------" << "IHSPSRCA-------" << "IHSPSRCI-------" << "IHSPSRD--------" << "IHSPSRE--------" << "IHSPSRF--------" << "IHSPSRH--------" << "IHSPSRI--------" << "IHSPSRMA-------" << "IHSPSRMF-------" << "IHSPSRMG-------";
-    codes << "IHSPSRMM-------" << "IHSPSRMT-------" << "IHSPSRS--------" << "IHSPSRTA-------" << "IHSPSRTI-------" << "IHSPSRTT-------" << "IHSPSRU--------" << "IHUPSCO--------" << "IHUPSCP--------" << "IHUPSCS--------" << "IHUPSRD--------";
-    codes << "IHUPSRE--------" << "IHUPSRM--------" << "IHUPSRS--------" << "IHUPSRT--------" << "IHUPSRU--------" << "INAPSCC--------" << "INAPSCO--------" << "INAPSCP--------" << "INAPSCS--------" << "INAPSRAI-------" << "INAPSRAS-------";
-    codes << "INAPSRC--------" << "INAPSRD--------" << "INAPSRE--------" << "INAPSRF--------" << "INAPSRI--------" << "INAPSRMA-------" << "INAPSRMD-------" << "INAPSRMF-------" << "INAPSRMG-------" << "INAPSRMT-------" << "INAPSRTA-------";
-    codes << "INAPSRTI-------" << "INAPSRTT-------" << "INAPSRU--------" << "INGPSCC--------" << "INGPSCO--------" << "INGPSCP--------" << "INGPSCS--------" << "INGPSCT--------" << "INGPSRAA-------" << "INGPSRAT-------" << "INGPSRB--------";
-    codes << "INGPSRCA-------" << "INGPSRCS-------" << "INGPSRD--------" << "INGPSRE--------" << "INGPSRF--------" << "INGPSRH--------" << "INGPSRI--------" << "INGPSRMA-------" << "INGPSRMF-------" << "INGPSRMG-------" << "INGPSRMM-------";
-    codes << "INGPSRMT-------" << "INGPSRS--------" << "INGPSRTA-------" << "INGPSRTI-------" << "INGPSRTT-------" << "INGPSRU--------" << "INPPSCD--------" << "INPPSRD--------" << "INPPSRE--------" << "INPPSRI--------" << "INPPSRM--------";
-    codes << "INPPSRS--------" << "INPPSRT--------" << "INPPSRU--------" << "INSPSCC--------" << "INSPSCO--------" << "INSPSCP--------" << "INSPSCS--------" << "INSPSRAA-------" << "INSPSRAT-------" << "INSPSRCA-------" << "INSPSRCI-------";
-    codes << "INSPSRD--------" << "INSPSRE--------" << "INSPSRF--------" << "INSPSRH--------" << "INSPSRI--------" << "INSPSRMA-------" << "INSPSRMF-------" << "INSPSRMG-------" << "INSPSRMM-------" << "INSPSRMT-------" << "INSPSRS--------";
-    codes << "INSPSRTA-------" << "INSPSRTI-------" << "INSPSRTT-------" << "INSPSRU--------" << "INUPSCO--------" << "INUPSCP--------" << "INUPSCS--------" << "INUPSRD--------" << "INUPSRE--------" << "INUPSRM--------" << "INUPSRS--------";
-    codes << "INUPSRT--------" << "INUPSRU--------" << "IUAPSCC--------" << "IUAPSCO--------" << "IUAPSCP--------" << "IUAPSCS--------" << "IUAPSRAI-------" << "IUAPSRAS-------" << "IUAPSRC--------" << "IUAPSRD--------" << "IUAPSRE--------";
-    codes << "IUAPSRF--------" << "IUAPSRI--------" << "IUAPSRMA-------" << "IUAPSRMD-------" << "IUAPSRMF-------" << "IUAPSRMG-------" << "IUAPSRMT-------" << "IUAPSRTA-------" << "IUAPSRTI-------" << "IUAPSRTT-------" << "IUAPSRU--------";
-    codes << "IUGPSCC--------" << "IUGPSCO--------" << "IUGPSCP--------" << "IUGPSCS--------" << "IUGPSCT--------" << "IUGPSRAA-------" << "IUGPSRAT-------" << "IUGPSRB--------" << "IUGPSRCA-------" << "IUGPSRCS-------" << "IUGPSRD--------";
-    codes << "IUGPSRE--------" << "IUGPSRF--------" << "IUGPSRH--------" << "IUGPSRI--------" << "IUGPSRMA-------" << "IUGPSRMF-------" << "IUGPSRMG-------" << "IUGPSRMM-------" << "IUGPSRMT-------" << "IUGPSRS--------" << "IUGPSRTA-------";
-    codes << "IUGPSRTI-------" << "IUGPSRTT-------" << "IUGPSRU--------" << "IUPPSCD--------" << "IUPPSRD--------" << "IUPPSRE--------" << "IUPPSRI--------" << "IUPPSRM--------" << "IUPPSRS--------" << "IUPPSRT--------" << "IUPPSRU--------";
-    codes << "IUSPSCC--------" << "IUSPSCO--------" << "IUSPSCP--------" << "IUSPSCS--------" << "IUSPSRAA-------" << "IUSPSRAT-------" << "IUSPSRCA-------" << "IUSPSRCI-------" << "IUSPSRD--------" << "IUSPSRE--------" << "IUSPSRF--------";
-    codes << "IUSPSRH--------" << "IUSPSRI--------" << "IUSPSRMA-------" << "IUSPSRMF-------" << "IUSPSRMG-------" << "IUSPSRMM-------" << "IUSPSRMT-------" << "IUSPSRS--------" << "IUSPSRTA-------" << "IUSPSRTI-------" << "IUSPSRTT-------";
-    codes << "IUSPSRU--------" << "IUUPSCO--------" << "IUUPSCP--------" << "IUUPSCS--------" << "IUUPSRD--------" << "IUUPSRE--------" << "IUUPSRM--------" << "IUUPSRS--------" << "IUUPSRT--------" << "IUUPSRU--------" << "SFAP-----------";
-    codes << "SFAPC----------" << "SFAPCF---------" << "SFAPCH---------" << "SFAPCL---------" << "SFAPM----------" << "SFAPME---------" << "SFAPMF---------" << "SFAPMFA--------" << "SFAPMFB--------" << "SFAPMFC--------" << "SFAPMFCH-------";
-    codes << "SFAPMFCL-------" << "SFAPMFCM-------" << "SFAPMFD--------" << "SFAPMFF--------" << "SFAPMFFI-------" << "SFAPMFH--------" << "SFAPMFJ--------" << "SFAPMFK--------" << "SFAPMFKB-------" << "SFAPMFKD-------" << "SFAPMFL--------";
-    codes << "SFAPMFM--------" << "SFAPMFO--------" << "SFAPMFP--------" << "SFAPMFPM-------" << "SFAPMFPN-------" << "SFAPMFQ--------" << "SFAPMFQA-------" << "SFAPMFQB-------" << "SFAPMFQC-------" << "SFAPMFQD-------" << "SFAPMFQF-------";
-    codes << "SFAPMFQH-------" << "SFAPMFQI-------" << "SFAPMFQJ-------" << "SFAPMFQK-------" << "SFAPMFQL-------" << "SFAPMFQM-------" << "SFAPMFQN-------" << "SFAPMFQO-------" << "SFAPMFQP-------" << "SFAPMFQR-------" << "SFAPMFQRW------";
-    codes << "SFAPMFQRX------" << "SFAPMFQRZ------" << "SFAPMFQS-------" << "SFAPMFQT-------" << "SFAPMFQU-------" << "SFAPMFQY-------" << "SFAPMFR--------" << "SFAPMFRW-------" << "SFAPMFRX-------" << "SFAPMFRZ-------" << "SFAPMFS--------";
-    codes << "SFAPMFT--------" << "SFAPMFU--------" << "SFAPMFUH-------" << "SFAPMFUL-------" << "SFAPMFUM-------" << "SFAPMFY--------" << "SFAPMH---------" << "SFAPMHA--------" << "SFAPMHC--------" << "SFAPMHCH-------" << "SFAPMHCL-------";
-    codes << "SFAPMHCM-------" << "SFAPMHD--------" << "SFAPMHH--------" << "SFAPMHI--------" << "SFAPMHJ--------" << "SFAPMHK--------" << "SFAPMHM--------" << "SFAPMHO--------" << "SFAPMHQ--------" << "SFAPMHR--------" << "SFAPMHS--------";
-    codes << "SFAPMHT--------" << "SFAPMHU--------" << "SFAPMHUH-------" << "SFAPMHUL-------" << "SFAPMHUM-------" << "SFAPML---------" << "SFAPMV---------" << "SFAPW----------" << "SFAPWB---------" << "SFAPWD---------" << "SFAPWM---------";
-    codes << "SFAPWMA--------" << "SFAPWMAA-------" << "SFAPWMAP-------" << "SFAPWMAS-------" << "SFAPWMB--------" << "SFAPWMCM-------" << "SFAPWMS--------" << "SFAPWMSA-------" << "SFAPWMSB-------" << "SFAPWMSS-------" << "SFAPWMSU-------";
-    codes << "SFAPWMU--------" << "SFFP-----------" << "SFFPA----------" << "SFFPAF---------" << "SFFPAFA--------" << "SFFPAFK--------" << "SFFPAFU--------" << "SFFPAFUH-------" << "SFFPAFUL-------" << "SFFPAFUM-------" << "SFFPAH---------";
-    codes << "SFFPAHA--------" << "SFFPAHH--------" << "SFFPAHU--------" << "SFFPAHUH-------" << "SFFPAHUL-------" << "SFFPAHUM-------" << "SFFPAV---------" << "SFFPB----------" << "SFFPG----------" << "SFFPGC---------" << "SFFPGP---------";
-    codes << "SFFPGPA--------" << "SFFPGR---------" << "SFFPGS---------" << "SFFPN----------" << "SFFPNB---------" << "SFFPNN---------" << "SFFPNS---------" << "SFFPNU---------" << "SFGP-----------" << "SFGPE----------" << "SFGPES---------";
-    codes << "SFGPESE--------" << "SFGPESR--------" << "SFGPEV---------" << "SFGPEVA--------" << "SFGPEVAA-------" << "SFGPEVAAR------" << "SFGPEVAC-------" << "SFGPEVAI-------" << "SFGPEVAL-------" << "SFGPEVAS-------" << "SFGPEVAT-------";
-    codes << "SFGPEVATH------" << "SFGPEVATHR-----" << "SFGPEVATL------" << "SFGPEVATLR-----" << "SFGPEVATM------" << "SFGPEVATMR-----" << "SFGPEVC--------" << "SFGPEVCA-------" << "SFGPEVCAH------" << "SFGPEVCAL------" << "SFGPEVCAM------";
-    codes << "SFGPEVCF-------" << "SFGPEVCFH------" << "SFGPEVCFL------" << "SFGPEVCFM------" << "SFGPEVCJ-------" << "SFGPEVCJH------" << "SFGPEVCJL------" << "SFGPEVCJM------" << "SFGPEVCM-------" << "SFGPEVCMH------" << "SFGPEVCML------";
-    codes << "SFGPEVCMM------" << "SFGPEVCO-------" << "SFGPEVCOH------" << "SFGPEVCOL------" << "SFGPEVCOM------" << "SFGPEVCT-------" << "SFGPEVCTH------" << "SFGPEVCTL------" << "SFGPEVCTM------" << "SFGPEVCU-------" << "SFGPEVCUH------";
-    codes << "SFGPEVCUL------" << "SFGPEVCUM------" << "SFGPEVE--------" << "SFGPEVEA-------" << "SFGPEVEAA------" << "SFGPEVEAT------" << "SFGPEVEB-------" << "SFGPEVEC-------" << "SFGPEVED-------" << "SFGPEVEDA------" << "SFGPEVEE-------";
-    codes << "SFGPEVEF-------" << "SFGPEVEH-------" << "SFGPEVEM-------" << "SFGPEVEML------" << "SFGPEVEMV------" << "SFGPEVER-------" << "SFGPEVES-------" << "SFGPEVM--------" << "SFGPEVS--------" << "SFGPEVSC-------" << "SFGPEVSP-------";
-    codes << "SFGPEVSR-------" << "SFGPEVST-------" << "SFGPEVSW-------" << "SFGPEVT--------" << "SFGPEVU--------" << "SFGPEVUA-------" << "SFGPEVUAA------" << "SFGPEVUB-------" << "SFGPEVUL-------" << "SFGPEVUR-------" << "SFGPEVUS-------";
-    codes << "SFGPEVUSH------" << "SFGPEVUSL------" << "SFGPEVUSM------" << "SFGPEVUT-------" << "SFGPEVUTH------" << "SFGPEVUTL------" << "SFGPEVUX-------" << "SFGPEWA--------" << "SFGPEWAH-------" << "SFGPEWAL-------" << "SFGPEWAM-------";
-    codes << "SFGPEWD--------" << "SFGPEWDH-------" << "SFGPEWDHS------" << "SFGPEWDL-------" << "SFGPEWDLS------" << "SFGPEWDM-------" << "SFGPEWDMS------" << "SFGPEWG--------" << "SFGPEWGH-------" << "SFGPEWGL-------" << "SFGPEWGM-------";
-    codes << "SFGPEWGR-------" << "SFGPEWH--------" << "SFGPEWHH-------" << "SFGPEWHHS------" << "SFGPEWHL-------" << "SFGPEWHLS------" << "SFGPEWHM-------" << "SFGPEWHMS------" << "SFGPEWM--------" << "SFGPEWMA-------" << "SFGPEWMAI------";
-    codes << "SFGPEWMAIE-----" << "SFGPEWMAIR-----" << "SFGPEWMAL------" << "SFGPEWMALE-----" << "SFGPEWMALR-----" << "SFGPEWMAS------" << "SFGPEWMASE-----" << "SFGPEWMASR-----" << "SFGPEWMAT------" << "SFGPEWMATE-----" << "SFGPEWMATR-----";
-    codes << "SFGPEWMS-------" << "SFGPEWMSI------" << "SFGPEWMSL------" << "SFGPEWMSS------" << "SFGPEWMT-------" << "SFGPEWMTH------" << "SFGPEWMTL------" << "SFGPEWMTM------" << "SFGPEWO--------" << "SFGPEWOH-------" << "SFGPEWOL-------";
-    codes << "SFGPEWOM-------" << "SFGPEWR--------" << "SFGPEWRH-------" << "SFGPEWRL-------" << "SFGPEWRR-------" << "SFGPEWS--------" << "SFGPEWSH-------" << "SFGPEWSL-------" << "SFGPEWSM-------" << "SFGPEWT--------" << "SFGPEWTH-------";
-    codes << "SFGPEWTL-------" << "SFGPEWTM-------" << "SFGPEWX--------" << "SFGPEWXH-------" << "SFGPEWXL-------" << "SFGPEWXM-------" << "SFGPEWZ--------" << "SFGPEWZH-------" << "SFGPEWZL-------" << "SFGPEWZM-------" << "SFGPEXF--------";
-    codes << "SFGPEXI--------" << "SFGPEXL--------" << "SFGPEXM--------" << "SFGPEXMC-------" << "SFGPEXML-------" << "SFGPEXN--------" << "SFGPI----------" << "SFGPIB---------" << "SFGPIBA--------" << "SFGPIBN--------" << "SFGPIE---------";
-    codes << "SFGPIG---------" << "SFGPIMA--------" << "SFGPIMC--------" << "SFGPIME--------" << "SFGPIMF--------" << "SFGPIMFA-------" << "SFGPIMFP-------" << "SFGPIMFPW------" << "SFGPIMFS-------" << "SFGPIMG--------" << "SFGPIMM--------";
-    codes << "SFGPIMN--------" << "SFGPIMNB-------" << "SFGPIMS--------" << "SFGPIMV--------" << "SFGPIP---------" << "SFGPIPD--------" << "SFGPIR---------" << "SFGPIRM--------" << "SFGPIRN--------" << "SFGPIRNB-------" << "SFGPIRNC-------";
-    codes << "SFGPIRNN-------" << "SFGPIRP--------" << "SFGPIT---------" << "SFGPIU---------" << "SFGPIUE--------" << "SFGPIUED-------" << "SFGPIUEF-------" << "SFGPIUEN-------" << "SFGPIUP--------" << "SFGPIUR--------" << "SFGPIUT--------";
-    codes << "SFGPIX---------" << "SFGPIXH--------" << "SFGPU----------" << "SFGPUC---------" << "SFGPUCA--------" << "SFGPUCAA-------" << "SFGPUCAAA------" << "SFGPUCAAAS-----" << "SFGPUCAAAT-----" << "SFGPUCAAAW-----" << "SFGPUCAAC------";
-    codes << "SFGPUCAAD------" << "SFGPUCAAL------" << "SFGPUCAAM------" << "SFGPUCAAO------" << "SFGPUCAAOS-----" << "SFGPUCAAS------" << "SFGPUCAAU------" << "SFGPUCAT-------" << "SFGPUCATA------" << "SFGPUCATH------" << "SFGPUCATL------";
-    codes << "SFGPUCATM------" << "SFGPUCATR------" << "SFGPUCATW------" << "SFGPUCATWR-----" << "SFGPUCAW-------" << "SFGPUCAWA------" << "SFGPUCAWH------" << "SFGPUCAWL------" << "SFGPUCAWM------" << "SFGPUCAWR------" << "SFGPUCAWS------";
-    codes << "SFGPUCAWW------" << "SFGPUCAWWR-----" << "SFGPUCD--------" << "SFGPUCDC-------" << "SFGPUCDG-------" << "SFGPUCDH-------" << "SFGPUCDHH------" << "SFGPUCDHP------" << "SFGPUCDM-------" << "SFGPUCDMH------" << "SFGPUCDML------";
-    codes << "SFGPUCDMLA-----" << "SFGPUCDMM------" << "SFGPUCDO-------" << "SFGPUCDS-------" << "SFGPUCDSC------" << "SFGPUCDSS------" << "SFGPUCDSV------" << "SFGPUCDT-------" << "SFGPUCE--------" << "SFGPUCEC-------" << "SFGPUCECA------";
-    codes << "SFGPUCECC------" << "SFGPUCECH------" << "SFGPUCECL------" << "SFGPUCECM------" << "SFGPUCECO------" << "SFGPUCECR------" << "SFGPUCECS------" << "SFGPUCECT------" << "SFGPUCECW------" << "SFGPUCEN-------" << "SFGPUCENN------";
-    codes << "SFGPUCF--------" << "SFGPUCFH-------" << "SFGPUCFHA------" << "SFGPUCFHC------" << "SFGPUCFHE------" << "SFGPUCFHH------" << "SFGPUCFHL------" << "SFGPUCFHM------" << "SFGPUCFHO------" << "SFGPUCFHS------" << "SFGPUCFHX------";
-    codes << "SFGPUCFM-------" << "SFGPUCFML------" << "SFGPUCFMS------" << "SFGPUCFMT------" << "SFGPUCFMTA-----" << "SFGPUCFMTC-----" << "SFGPUCFMTO-----" << "SFGPUCFMTS-----" << "SFGPUCFMW------" << "SFGPUCFO-------" << "SFGPUCFOA------";
-    codes << "SFGPUCFOL------" << "SFGPUCFOO------" << "SFGPUCFOS------" << "SFGPUCFR-------" << "SFGPUCFRM------" << "SFGPUCFRMR-----" << "SFGPUCFRMS-----" << "SFGPUCFRMT-----" << "SFGPUCFRS------" << "SFGPUCFRSR-----" << "SFGPUCFRSS-----";
-    codes << "SFGPUCFRST-----" << "SFGPUCFS-------" << "SFGPUCFSA------" << "SFGPUCFSL------" << "SFGPUCFSO------" << "SFGPUCFSS------" << "SFGPUCFT-------" << "SFGPUCFTA------" << "SFGPUCFTC------" << "SFGPUCFTCD-----" << "SFGPUCFTCM-----";
-    codes << "SFGPUCFTF------" << "SFGPUCFTR------" << "SFGPUCFTS------" << "SFGPUCI--------" << "SFGPUCIA-------" << "SFGPUCIC-------" << "SFGPUCII-------" << "SFGPUCIL-------" << "SFGPUCIM-------" << "SFGPUCIN-------" << "SFGPUCIO-------";
-    codes << "SFGPUCIS-------" << "SFGPUCIZ-------" << "SFGPUCM--------" << "SFGPUCMS-------" << "SFGPUCMT-------" << "SFGPUCR--------" << "SFGPUCRA-------" << "SFGPUCRC-------" << "SFGPUCRH-------" << "SFGPUCRL-------" << "SFGPUCRO-------";
-    codes << "SFGPUCRR-------" << "SFGPUCRRD------" << "SFGPUCRRF------" << "SFGPUCRRL------" << "SFGPUCRS-------" << "SFGPUCRV-------" << "SFGPUCRVA------" << "SFGPUCRVG------" << "SFGPUCRVM------" << "SFGPUCRVO------" << "SFGPUCRX-------";
-    codes << "SFGPUCS--------" << "SFGPUCSA-------" << "SFGPUCSG-------" << "SFGPUCSGA------" << "SFGPUCSGD------" << "SFGPUCSGM------" << "SFGPUCSM-------" << "SFGPUCSR-------" << "SFGPUCSW-------" << "SFGPUCV--------" << "SFGPUCVC-------";
-    codes << "SFGPUCVF-------" << "SFGPUCVFA------" << "SFGPUCVFR------" << "SFGPUCVFU------" << "SFGPUCVR-------" << "SFGPUCVRA------" << "SFGPUCVRM------" << "SFGPUCVRS------" << "SFGPUCVRU------" << "SFGPUCVRUC-----" << "SFGPUCVRUE-----";
-    codes << "SFGPUCVRUH-----" << "SFGPUCVRUL-----" << "SFGPUCVRUM-----" << "SFGPUCVRW------" << "SFGPUCVS-------" << "SFGPUCVU-------" << "SFGPUCVUF------" << "SFGPUCVUR------" << "SFGPUCVV-------" << "SFGPUH---------" << "SFGPUS---------";
-    codes << "SFGPUSA--------" << "SFGPUSAC-------" << "SFGPUSAF-------" << "SFGPUSAFC------" << "SFGPUSAFT------" << "SFGPUSAJ-------" << "SFGPUSAJC------" << "SFGPUSAJT------" << "SFGPUSAL-------" << "SFGPUSALC------" << "SFGPUSALT------";
-    codes << "SFGPUSAM-------" << "SFGPUSAMC------" << "SFGPUSAMT------" << "SFGPUSAO-------" << "SFGPUSAOC------" << "SFGPUSAOT------" << "SFGPUSAP-------" << "SFGPUSAPB------" << "SFGPUSAPBC-----" << "SFGPUSAPBT-----" << "SFGPUSAPC------";
-    codes << "SFGPUSAPM------" << "SFGPUSAPMC-----" << "SFGPUSAPMT-----" << "SFGPUSAPT------" << "SFGPUSAQ-------" << "SFGPUSAQC------" << "SFGPUSAQT------" << "SFGPUSAR-------" << "SFGPUSARC------" << "SFGPUSART------" << "SFGPUSAS-------";
-    codes << "SFGPUSASC------" << "SFGPUSAST------" << "SFGPUSAT-------" << "SFGPUSAW-------" << "SFGPUSAWC------" << "SFGPUSAWT------" << "SFGPUSAX-------" << "SFGPUSAXC------" << "SFGPUSAXT------" << "SFGPUSM--------" << "SFGPUSMC-------";
-    codes << "SFGPUSMD-------" << "SFGPUSMDC------" << "SFGPUSMDT------" << "SFGPUSMM-------" << "SFGPUSMMC------" << "SFGPUSMMT------" << "SFGPUSMP-------" << "SFGPUSMPC------" << "SFGPUSMPT------" << "SFGPUSMT-------" << "SFGPUSMV-------";
-    codes << "SFGPUSMVC------" << "SFGPUSMVT------" << "SFGPUSS--------" << "SFGPUSS1-------" << "SFGPUSS1C------" << "SFGPUSS1T------" << "SFGPUSS2-------" << "SFGPUSS2C------" << "SFGPUSS2T------" << "SFGPUSS3-------" << "SFGPUSS3A------";
-    codes << "SFGPUSS3AC-----" << "SFGPUSS3AT-----" << "SFGPUSS3C------" << "SFGPUSS3T------" << "SFGPUSS4-------" << "SFGPUSS4C------" << "SFGPUSS4T------" << "SFGPUSS5-------" << "SFGPUSS5C------" << "SFGPUSS5T------" << "SFGPUSS6-------";
-    codes << "SFGPUSS6C------" << "SFGPUSS6T------" << "SFGPUSS7-------" << "SFGPUSS7C------" << "SFGPUSS7T------" << "SFGPUSS8-------" << "SFGPUSS8C------" << "SFGPUSS8T------" << "SFGPUSS9-------" << "SFGPUSS9C------" << "SFGPUSS9T------";
-    codes << "SFGPUSSC-------" << "SFGPUSSL-------" << "SFGPUSSLC------" << "SFGPUSSLT------" << "SFGPUSST-------" << "SFGPUSSW-------" << "SFGPUSSWC------" << "SFGPUSSWP------" << "SFGPUSSWPC-----" << "SFGPUSSWPT-----" << "SFGPUSSWT------";
-    codes << "SFGPUSSX-------" << "SFGPUSSXC------" << "SFGPUSSXT------" << "SFGPUST--------" << "SFGPUSTA-------" << "SFGPUSTAC------" << "SFGPUSTAT------" << "SFGPUSTC-------" << "SFGPUSTI-------" << "SFGPUSTIC------" << "SFGPUSTIT------";
-    codes << "SFGPUSTM-------" << "SFGPUSTMC------" << "SFGPUSTMT------" << "SFGPUSTR-------" << "SFGPUSTRC------" << "SFGPUSTRT------" << "SFGPUSTS-------" << "SFGPUSTSC------" << "SFGPUSTST------" << "SFGPUSTT-------" << "SFGPUSX--------";
-    codes << "SFGPUSXC-------" << "SFGPUSXE-------" << "SFGPUSXEC------" << "SFGPUSXET------" << "SFGPUSXH-------" << "SFGPUSXHC------" << "SFGPUSXHT------" << "SFGPUSXO-------" << "SFGPUSXOC------" << "SFGPUSXOM------" << "SFGPUSXOMC-----";
-    codes << "SFGPUSXOMT-----" << "SFGPUSXOT------" << "SFGPUSXR-------" << "SFGPUSXRC------" << "SFGPUSXRT------" << "SFGPUSXT-------" << "SFGPUU---------" << "SFGPUUA--------" << "SFGPUUAB-------" << "SFGPUUABR------" << "SFGPUUAC-------";
-    codes << "SFGPUUACC------" << "SFGPUUACCK-----" << "SFGPUUACCM-----" << "SFGPUUACR------" << "SFGPUUACRS-----" << "SFGPUUACRW-----" << "SFGPUUACS------" << "SFGPUUACSA-----" << "SFGPUUACSM-----" << "SFGPUUAD-------" << "SFGPUUAN-------";
-    codes << "SFGPUUE--------" << "SFGPUUI--------" << "SFGPUUL--------" << "SFGPUULC-------" << "SFGPUULD-------" << "SFGPUULF-------" << "SFGPUULM-------" << "SFGPUULS-------" << "SFGPUUM--------" << "SFGPUUMA-------" << "SFGPUUMC-------";
-    codes << "SFGPUUMJ-------" << "SFGPUUMMO------" << "SFGPUUMO-------" << "SFGPUUMQ-------" << "SFGPUUMR-------" << "SFGPUUMRG------" << "SFGPUUMRS------" << "SFGPUUMRSS-----" << "SFGPUUMRX------" << "SFGPUUMS-------" << "SFGPUUMSE------";
-    codes << "SFGPUUMSEA-----" << "SFGPUUMSEC-----" << "SFGPUUMSED-----" << "SFGPUUMSEI-----" << "SFGPUUMSEJ-----" << "SFGPUUMSET-----" << "SFGPUUMT-------" << "SFGPUUP--------" << "SFGPUUS--------" << "SFGPUUSA-------" << "SFGPUUSC-------";
-    codes << "SFGPUUSCL------" << "SFGPUUSF-------" << "SFGPUUSM-------" << "SFGPUUSML------" << "SFGPUUSMN------" << "SFGPUUSMS------" << "SFGPUUSO-------" << "SFGPUUSR-------" << "SFGPUUSRS------" << "SFGPUUSRT------" << "SFGPUUSRW------";
-    codes << "SFGPUUSS-------" << "SFGPUUSW-------" << "SFGPUUSX-------" << "SFPP-----------" << "SFPPL----------" << "SFPPS----------" << "SFPPT----------" << "SFPPV----------" << "SFSP-----------" << "SFSPC----------" << "SFSPCA---------";
-    codes << "SFSPCALA-------" << "SFSPCALC-------" << "SFSPCALS-------" << "SFSPCALSM------" << "SFSPCALST------" << "SFSPCD---------" << "SFSPCH---------" << "SFSPCL---------" << "SFSPCLBB-------" << "SFSPCLCC-------" << "SFSPCLCV-------";
-    codes << "SFSPCLDD-------" << "SFSPCLFF-------" << "SFSPCLLL-------" << "SFSPCLLLAS-----" << "SFSPCLLLMI-----" << "SFSPCLLLSU-----" << "SFSPCM---------" << "SFSPCMMA-------" << "SFSPCMMH-------" << "SFSPCMML-------" << "SFSPCMMS-------";
-    codes << "SFSPCP---------" << "SFSPCPSB-------" << "SFSPCPSU-------" << "SFSPCPSUG------" << "SFSPCPSUM------" << "SFSPCPSUT------" << "SFSPCU---------" << "SFSPCUM--------" << "SFSPCUN--------" << "SFSPCUR--------" << "SFSPCUS--------";
-    codes << "SFSPG----------" << "SFSPGC---------" << "SFSPGG---------" << "SFSPGT---------" << "SFSPGU---------" << "SFSPN----------" << "SFSPNF---------" << "SFSPNH---------" << "SFSPNI---------" << "SFSPNM---------" << "SFSPNR---------";
-    codes << "SFSPNS---------" << "SFSPO----------" << "SFSPXA---------" << "SFSPXAR--------" << "SFSPXAS--------" << "SFSPXF---------" << "SFSPXFDF-------" << "SFSPXFDR-------" << "SFSPXFTR-------" << "SFSPXH---------" << "SFSPXL---------";
-    codes << "SFSPXM---------" << "SFSPXMC--------" << "SFSPXMF--------" << "SFSPXMH--------" << "SFSPXMO--------" << "SFSPXMP--------" << "SFSPXMR--------" << "SFSPXMTO-------" << "SFSPXMTU-------" << "SFSPXP---------" << "SFSPXR---------";
-    codes << "SFUP-----------" << "SFUPE----------" << "SFUPND---------" << "SFUPS----------" << "SFUPS1---------" << "SFUPS2---------" << "SFUPS3---------" << "SFUPS4---------" << "SFUPSB---------" << "SFUPSC---------" << "SFUPSCA--------";
-    codes << "SFUPSCB--------" << "SFUPSCF--------" << "SFUPSCG--------" << "SFUPSCM--------" << "SFUPSF---------" << "SFUPSK---------" << "SFUPSL---------" << "SFUPSN---------" << "SFUPSNA--------" << "SFUPSNB--------" << "SFUPSNF--------";
-    codes << "SFUPSNG--------" << "SFUPSNM--------" << "SFUPSO---------" << "SFUPSOF--------" << "SFUPSR---------" << "SFUPSU---------" << "SFUPSUM--------" << "SFUPSUN--------" << "SFUPSUS--------" << "SFUPSX---------" << "SFUPV----------";
-    codes << "SFUPW----------" << "SFUPWD---------" << "SFUPWDM--------" << "SFUPWDMG-------" << "SFUPWDMM-------" << "SFUPWM---------" << "SFUPWMA--------" << "SFUPWMB--------" << "SFUPWMBD-------" << "SFUPWMC--------" << "SFUPWMD--------";
-    codes << "SFUPWME--------" << "SFUPWMF--------" << "SFUPWMFC-------" << "SFUPWMFD-------" << "SFUPWMFE-------" << "SFUPWMFO-------" << "SFUPWMFR-------" << "SFUPWMFX-------" << "SFUPWMG--------" << "SFUPWMGC-------" << "SFUPWMGD-------";
-    codes << "SFUPWMGE-------" << "SFUPWMGO-------" << "SFUPWMGR-------" << "SFUPWMGX-------" << "SFUPWMM--------" << "SFUPWMMC-------" << "SFUPWMMD-------" << "SFUPWMME-------" << "SFUPWMMO-------" << "SFUPWMMR-------" << "SFUPWMMX-------";
-    codes << "SFUPWMN--------" << "SFUPWMO--------" << "SFUPWMOD-------" << "SFUPWMR--------" << "SFUPWMS--------" << "SFUPWMSD-------" << "SFUPWMSX-------" << "SFUPWMX--------" << "SFUPWT---------" << "SFUPX----------" << "SHAP-----------";
-    codes << "SHAPC----------" << "SHAPCF---------" << "SHAPCH---------" << "SHAPCL---------" << "SHAPM----------" << "SHAPME---------" << "SHAPMF---------" << "SHAPMFA--------" << "SHAPMFB--------" << "SHAPMFC--------" << "SHAPMFCH-------";
-    codes << "SHAPMFCL-------" << "SHAPMFCM-------" << "SHAPMFD--------" << "SHAPMFF--------" << "SHAPMFFI-------" << "SHAPMFH--------" << "SHAPMFJ--------" << "SHAPMFK--------" << "SHAPMFKB-------" << "SHAPMFKD-------" << "SHAPMFL--------";
-    codes << "SHAPMFM--------" << "SHAPMFO--------" << "SHAPMFP--------" << "SHAPMFPM-------" << "SHAPMFPN-------" << "SHAPMFQ--------" << "SHAPMFQA-------" << "SHAPMFQB-------" << "SHAPMFQC-------" << "SHAPMFQD-------" << "SHAPMFQF-------";
-    codes << "SHAPMFQH-------" << "SHAPMFQI-------" << "SHAPMFQJ-------" << "SHAPMFQK-------" << "SHAPMFQL-------" << "SHAPMFQM-------" << "SHAPMFQN-------" << "SHAPMFQO-------" << "SHAPMFQP-------" << "SHAPMFQR-------" << "SHAPMFQRW------";
-    codes << "SHAPMFQRX------" << "SHAPMFQRZ------" << "SHAPMFQS-------" << "SHAPMFQT-------" << "SHAPMFQU-------" << "SHAPMFQY-------" << "SHAPMFR--------" << "SHAPMFRW-------" << "SHAPMFRX-------" << "SHAPMFRZ-------" << "SHAPMFS--------";
-    codes << "SHAPMFT--------" << "SHAPMFU--------" << "SHAPMFUH-------" << "SHAPMFUL-------" << "SHAPMFUM-------" << "SHAPMFY--------" << "SHAPMH---------" << "SHAPMHA--------" << "SHAPMHC--------" << "SHAPMHCH-------" << "SHAPMHCL-------";
-    codes << "SHAPMHCM-------" << "SHAPMHD--------" << "SHAPMHH--------" << "SHAPMHI--------" << "SHAPMHJ--------" << "SHAPMHK--------" << "SHAPMHM--------" << "SHAPMHO--------" << "SHAPMHQ--------" << "SHAPMHR--------" << "SHAPMHS--------";
-    codes << "SHAPMHT--------" << "SHAPMHU--------" << "SHAPMHUH-------" << "SHAPMHUL-------" << "SHAPMHUM-------" << "SHAPML---------" << "SHAPMV---------" << "SHAPW----------" << "SHAPWB---------" << "SHAPWD---------" << "SHAPWM---------";
-    codes << "SHAPWMA--------" << "SHAPWMAA-------" << "SHAPWMAP-------" << "SHAPWMAS-------" << "SHAPWMB--------" << "SHAPWMCM-------" << "SHAPWMS--------" << "SHAPWMSA-------" << "SHAPWMSB-------" << "SHAPWMSS-------" << "SHAPWMSU-------";
-    codes << "SHAPWMU--------" << "SHFP-----------" << "SHFPA----------" << "SHFPAF---------" << "SHFPAFA--------" << "SHFPAFK--------" << "SHFPAFU--------" << "SHFPAFUH-------" << "SHFPAFUL-------" << "SHFPAFUM-------" << "SHFPAH---------";
-    codes << "SHFPAHA--------" << "SHFPAHH--------" << "SHFPAHU--------" << "SHFPAHUH-------" << "SHFPAHUL-------" << "SHFPAHUM-------" << "SHFPAV---------" << "SHFPB----------" << "SHFPG----------" << "SHFPGC---------" << "SHFPGP---------";
-    codes << "SHFPGPA--------" << "SHFPGR---------" << "SHFPGS---------" << "SHFPN----------" << "SHFPNB---------" << "SHFPNN---------" << "SHFPNS---------" << "SHFPNU---------" << "SHGP-----------" << "SHGPE----------" << "SHGPES---------";
-    codes << "SHGPESE--------" << "SHGPESR--------" << "SHGPEV---------" << "SHGPEVA--------" << "SHGPEVAA-------" << "SHGPEVAAR------" << "SHGPEVAC-------" << "SHGPEVAI-------" << "SHGPEVAL-------" << "SHGPEVAS-------" << "SHGPEVAT-------";
-    codes << "SHGPEVATH------" << "SHGPEVATHR-----" << "SHGPEVATL------" << "SHGPEVATLR-----" << "SHGPEVATM------" << "SHGPEVATMR-----" << "SHGPEVC--------" << "SHGPEVCA-------" << "SHGPEVCAH------" << "SHGPEVCAL------" << "SHGPEVCAM------";
-    codes << "SHGPEVCF-------" << "SHGPEVCFH------" << "SHGPEVCFL------" << "SHGPEVCFM------" << "SHGPEVCJ-------" << "SHGPEVCJH------" << "SHGPEVCJL------" << "SHGPEVCJM------" << "SHGPEVCM-------" << "SHGPEVCMH------" << "SHGPEVCML------";
-    codes << "SHGPEVCMM------" << "SHGPEVCO-------" << "SHGPEVCOH------" << "SHGPEVCOL------" << "SHGPEVCOM------" << "SHGPEVCT-------" << "SHGPEVCTH------" << "SHGPEVCTL------" << "SHGPEVCTM------" << "SHGPEVCU-------" << "SHGPEVCUH------";
-    codes << "SHGPEVCUL------" << "SHGPEVCUM------" << "SHGPEVE--------" << "SHGPEVEA-------" << "SHGPEVEAA------" << "SHGPEVEAT------" << "SHGPEVEB-------" << "SHGPEVEC-------" << "SHGPEVED-------" << "SHGPEVEDA------" << "SHGPEVEE-------";
-    codes << "SHGPEVEF-------" << "SHGPEVEH-------" << "SHGPEVEM-------" << "SHGPEVEML------" << "SHGPEVEMV------" << "SHGPEVER-------" << "SHGPEVES-------" << "SHGPEVM--------" << "SHGPEVS--------" << "SHGPEVSC-------" << "SHGPEVSP-------";
-    codes << "SHGPEVSR-------" << "SHGPEVST-------" << "SHGPEVSW-------" << "SHGPEVT--------" << "SHGPEVU--------" << "SHGPEVUA-------" << "SHGPEVUAA------" << "SHGPEVUB-------" << "SHGPEVUL-------" << "SHGPEVUR-------" << "SHGPEVUS-------";
-    codes << "SHGPEVUSH------" << "SHGPEVUSL------" << "SHGPEVUSM------" << "SHGPEVUT-------" << "SHGPEVUTH------" << "SHGPEVUTL------" << "SHGPEVUX-------" << "SHGPEWA--------" << "SHGPEWAH-------" << "SHGPEWAL-------" << "SHGPEWAM-------";
-    codes << "SHGPEWD--------" << "SHGPEWDH-------" << "SHGPEWDHS------" << "SHGPEWDL-------" << "SHGPEWDLS------" << "SHGPEWDM-------" << "SHGPEWDMS------" << "SHGPEWG--------" << "SHGPEWGH-------" << "SHGPEWGL-------" << "SHGPEWGM-------";
-    codes << "SHGPEWGR-------" << "SHGPEWH--------" << "SHGPEWHH-------" << "SHGPEWHHS------" << "SHGPEWHL-------" << "SHGPEWHLS------" << "SHGPEWHM-------" << "SHGPEWHMS------" << "SHGPEWM--------" << "SHGPEWMA-------" << "SHGPEWMAI------";
-    codes << "SHGPEWMAIE-----" << "SHGPEWMAIR-----" << "SHGPEWMAL------" << "SHGPEWMALE-----" << "SHGPEWMALR-----" << "SHGPEWMAS------" << "SHGPEWMASE-----" << "SHGPEWMASR-----" << "SHGPEWMAT------" << "SHGPEWMATE-----" << "SHGPEWMATR-----";
-    codes << "SHGPEWMS-------" << "SHGPEWMSI------" << "SHGPEWMSL------" << "SHGPEWMSS------" << "SHGPEWMT-------" << "SHGPEWMTH------" << "SHGPEWMTL------" << "SHGPEWMTM------" << "SHGPEWO--------" << "SHGPEWOH-------" << "SHGPEWOL-------";
-    codes << "SHGPEWOM-------" << "SHGPEWR--------" << "SHGPEWRH-------" << "SHGPEWRL-------" << "SHGPEWRR-------" << "SHGPEWS--------" << "SHGPEWSH-------" << "SHGPEWSL-------" << "SHGPEWSM-------" << "SHGPEWT--------" << "SHGPEWTH-------";
-    codes << "SHGPEWTL-------" << "SHGPEWTM-------" << "SHGPEWX--------" << "SHGPEWXH-------" << "SHGPEWXL-------" << "SHGPEWXM-------" << "SHGPEWZ--------" << "SHGPEWZH-------" << "SHGPEWZL-------" << "SHGPEWZM-------" << "SHGPEXF--------";
-    codes << "SHGPEXI--------" << "SHGPEXL--------" << "SHGPEXM--------" << "SHGPEXMC-------" << "SHGPEXML-------" << "SHGPEXN--------" << "SHGPI----------" << "SHGPIB---------" << "SHGPIBA--------" << "SHGPIBN--------" << "SHGPIE---------";
-    codes << "SHGPIG---------" << "SHGPIMA--------" << "SHGPIMC--------" << "SHGPIME--------" << "SHGPIMF--------" << "SHGPIMFA-------" << "SHGPIMFP-------" << "SHGPIMFPW------" << "SHGPIMFS-------" << "SHGPIMG--------" << "SHGPIMM--------";
-    codes << "SHGPIMN--------" << "SHGPIMNB-------" << "SHGPIMS--------" << "SHGPIMV--------" << "SHGPIP---------" << "SHGPIPD--------" << "SHGPIR---------" << "SHGPIRM--------" << "SHGPIRN--------" << "SHGPIRNB-------" << "SHGPIRNC-------";
-    codes << "SHGPIRNN-------" << "SHGPIRP--------" << "SHGPIT---------" << "SHGPIU---------" << "SHGPIUE--------" << "SHGPIUED-------" << "SHGPIUEF-------" << "SHGPIUEN-------" << "SHGPIUP--------" << "SHGPIUR--------" << "SHGPIUT--------";
-    codes << "SHGPIX---------" << "SHGPIXH--------" << "SHGPU----------" << "SHGPUC---------" << "SHGPUCA--------" << "SHGPUCAA-------" << "SHGPUCAAA------" << "SHGPUCAAAS-----" << "SHGPUCAAAT-----" << "SHGPUCAAAW-----" << "SHGPUCAAC------";
-    codes << "SHGPUCAAD------" << "SHGPUCAAL------" << "SHGPUCAAM------" << "SHGPUCAAO------" << "SHGPUCAAOS-----" << "SHGPUCAAS------" << "SHGPUCAAU------" << "SHGPUCAT-------" << "SHGPUCATA------" << "SHGPUCATH------" << "SHGPUCATL------";
-    codes << "SHGPUCATM------" << "SHGPUCATR------" << "SHGPUCATW------" << "SHGPUCATWR-----" << "SHGPUCAW-------" << "SHGPUCAWA------" << "SHGPUCAWH------" << "SHGPUCAWL------" << "SHGPUCAWM------" << "SHGPUCAWR------" << "SHGPUCAWS------";
-    codes << "SHGPUCAWW------" << "SHGPUCAWWR-----" << "SHGPUCD--------" << "SHGPUCDC-------" << "SHGPUCDG-------" << "SHGPUCDH-------" << "SHGPUCDHH------" << "SHGPUCDHP------" << "SHGPUCDM-------" << "SHGPUCDMH------" << "SHGPUCDML------";
-    codes << "SHGPUCDMLA-----" << "SHGPUCDMM------" << "SHGPUCDO-------" << "SHGPUCDS-------" << "SHGPUCDSC------" << "SHGPUCDSS------" << "SHGPUCDSV------" << "SHGPUCDT-------" << "SHGPUCE--------" << "SHGPUCEC-------" << "SHGPUCECA------";
-    codes << "SHGPUCECC------" << "SHGPUCECH------" << "SHGPUCECL------" << "SHGPUCECM------" << "SHGPUCECO------" << "SHGPUCECR------" << "SHGPUCECS------" << "SHGPUCECT------" << "SHGPUCECW------" << "SHGPUCEN-------" << "SHGPUCENN------";
-    codes << "SHGPUCF--------" << "SHGPUCFH-------" << "SHGPUCFHA------" << "SHGPUCFHC------" << "SHGPUCFHE------" << "SHGPUCFHH------" << "SHGPUCFHL------" << "SHGPUCFHM------" << "SHGPUCFHO------" << "SHGPUCFHS------" << "SHGPUCFHX------";
-    codes << "SHGPUCFM-------" << "SHGPUCFML------" << "SHGPUCFMS------" << "SHGPUCFMT------" << "SHGPUCFMTA-----" << "SHGPUCFMTC-----" << "SHGPUCFMTO-----" << "SHGPUCFMTS-----" << "SHGPUCFMW------" << "SHGPUCFO-------" << "SHGPUCFOA------";
-    codes << "SHGPUCFOL------" << "SHGPUCFOO------" << "SHGPUCFOS------" << "SHGPUCFR-------" << "SHGPUCFRM------" << "SHGPUCFRMR-----" << "SHGPUCFRMS-----" << "SHGPUCFRMT-----" << "SHGPUCFRS------" << "SHGPUCFRSR-----" << "SHGPUCFRSS-----";
-    codes << "SHGPUCFRST-----" << "SHGPUCFS-------" << "SHGPUCFSA------" << "SHGPUCFSL------" << "SHGPUCFSO------" << "SHGPUCFSS------" << "SHGPUCFT-------" << "SHGPUCFTA------" << "SHGPUCFTC------" << "SHGPUCFTCD-----" << "SHGPUCFTCM-----";
-    codes << "SHGPUCFTF------" << "SHGPUCFTR------" << "SHGPUCFTS------" << "SHGPUCI--------" << "SHGPUCIA-------" << "SHGPUCIC-------" << "SHGPUCII-------" << "SHGPUCIL-------" << "SHGPUCIM-------" << "SHGPUCIN-------" << "SHGPUCIO-------";
-    codes << "SHGPUCIS-------" << "SHGPUCIZ-------" << "SHGPUCM--------" << "SHGPUCMS-------" << "SHGPUCMT-------" << "SHGPUCR--------" << "SHGPUCRA-------" << "SHGPUCRC-------" << "SHGPUCRH-------" << "SHGPUCRL-------" << "SHGPUCRO-------";
-    codes << "SHGPUCRR-------" << "SHGPUCRRD------" << "SHGPUCRRF------" << "SHGPUCRRL------" << "SHGPUCRS-------" << "SHGPUCRV-------" << "SHGPUCRVA------" << "SHGPUCRVG------" << "SHGPUCRVM------" << "SHGPUCRVO------" << "SHGPUCRX-------";
-    codes << "SHGPUCS--------" << "SHGPUCSA-------" << "SHGPUCSG-------" << "SHGPUCSGA------" << "SHGPUCSGD------" << "SHGPUCSGM------" << "SHGPUCSM-------" << "SHGPUCSR-------" << "SHGPUCSW-------" << "SHGPUCV--------" << "SHGPUCVC-------";
-    codes << "SHGPUCVF-------" << "SHGPUCVFA------" << "SHGPUCVFR------" << "SHGPUCVFU------" << "SHGPUCVR-------" << "SHGPUCVRA------" << "SHGPUCVRM------" << "SHGPUCVRS------" << "SHGPUCVRU------" << "SHGPUCVRUC-----" << "SHGPUCVRUE-----";
-    codes << "SHGPUCVRUH-----" << "SHGPUCVRUL-----" << "SHGPUCVRUM-----" << "SHGPUCVRW------" << "SHGPUCVS-------" << "SHGPUCVU-------" << "SHGPUCVUF------" << "SHGPUCVUR------" << "SHGPUCVV-------" << "SHGPUH---------" << "SHGPUS---------";
-    codes << "SHGPUSA--------" << "SHGPUSAC-------" << "SHGPUSAF-------" << "SHGPUSAFC------" << "SHGPUSAFT------" << "SHGPUSAJ-------" << "SHGPUSAJC------" << "SHGPUSAJT------" << "SHGPUSAL-------" << "SHGPUSALC------" << "SHGPUSALT------";
-    codes << "SHGPUSAM-------" << "SHGPUSAMC------" << "SHGPUSAMT------" << "SHGPUSAO-------" << "SHGPUSAOC------" << "SHGPUSAOT------" << "SHGPUSAP-------" << "SHGPUSAPB------" << "SHGPUSAPBC-----" << "SHGPUSAPBT-----" << "SHGPUSAPC------";
-    codes << "SHGPUSAPM------" << "SHGPUSAPMC-----" << "SHGPUSAPMT-----" << "SHGPUSAPT------" << "SHGPUSAQ-------" << "SHGPUSAQC------" << "SHGPUSAQT------" << "SHGPUSAR-------" << "SHGPUSARC------" << "SHGPUSART------" << "SHGPUSAS-------";
-    codes << "SHGPUSASC------" << "SHGPUSAST------" << "SHGPUSAT-------" << "SHGPUSAW-------" << "SHGPUSAWC------" << "SHGPUSAWT------" << "SHGPUSAX-------" << "SHGPUSAXC------" << "SHGPUSAXT------" << "SHGPUSM--------" << "SHGPUSMC-------";
-    codes << "SHGPUSMD-------" << "SHGPUSMDC------" << "SHGPUSMDT------" << "SHGPUSMM-------" << "SHGPUSMMC------" << "SHGPUSMMT------" << "SHGPUSMP-------" << "SHGPUSMPC------" << "SHGPUSMPT------" << "SHGPUSMT-------" << "SHGPUSMV-------";
-    codes << "SHGPUSMVC------" << "SHGPUSMVT------" << "SHGPUSS--------" << "SHGPUSS1-------" << "SHGPUSS1C------" << "SHGPUSS1T------" << "SHGPUSS2-------" << "SHGPUSS2C------" << "SHGPUSS2T------" << "SHGPUSS3-------" << "SHGPUSS3A------";
-    codes << "SHGPUSS3AC-----" << "SHGPUSS3AT-----" << "SHGPUSS3C------" << "SHGPUSS3T------" << "SHGPUSS4-------" << "SHGPUSS4C------" << "SHGPUSS4T------" << "SHGPUSS5-------" << "SHGPUSS5C------" << "SHGPUSS5T------" << "SHGPUSS6-------";
-    codes << "SHGPUSS6C------" << "SHGPUSS6T------" << "SHGPUSS7-------" << "SHGPUSS7C------" << "SHGPUSS7T------" << "SHGPUSS8-------" << "SHGPUSS8C------" << "SHGPUSS8T------" << "SHGPUSS9-------" << "SHGPUSS9C------" << "SHGPUSS9T------";
-    codes << "SHGPUSSC-------" << "SHGPUSSL-------" << "SHGPUSSLC------" << "SHGPUSSLT------" << "SHGPUSST-------" << "SHGPUSSW-------" << "SHGPUSSWC------" << "SHGPUSSWP------" << "SHGPUSSWPC-----" << "SHGPUSSWPT-----" << "SHGPUSSWT------";
-    codes << "SHGPUSSX-------" << "SHGPUSSXC------" << "SHGPUSSXT------" << "SHGPUST--------" << "SHGPUSTA-------" << "SHGPUSTAC------" << "SHGPUSTAT------" << "SHGPUSTC-------" << "SHGPUSTI-------" << "SHGPUSTIC------" << "SHGPUSTIT------";
-    codes << "SHGPUSTM-------" << "SHGPUSTMC------" << "SHGPUSTMT------" << "SHGPUSTR-------" << "SHGPUSTRC------" << "SHGPUSTRT------" << "SHGPUSTS-------" << "SHGPUSTSC------" << "SHGPUSTST------" << "SHGPUSTT-------" << "SHGPUSX--------";
-    codes << "SHGPUSXC-------" << "SHGPUSXE-------" << "SHGPUSXEC------" << "SHGPUSXET------" << "SHGPUSXH-------" << "SHGPUSXHC------" << "SHGPUSXHT------" << "SHGPUSXO-------" << "SHGPUSXOC------" << "SHGPUSXOM------" << "SHGPUSXOMC-----";
-    codes << "SHGPUSXOMT-----" << "SHGPUSXOT------" << "SHGPUSXR-------" << "SHGPUSXRC------" << "SHGPUSXRT------" << "SHGPUSXT-------" << "SHGPUU---------" << "SHGPUUA--------" << "SHGPUUAB-------" << "SHGPUUABR------" << "SHGPUUAC-------";
-    codes << "SHGPUUACC------" << "SHGPUUACCK-----" << "SHGPUUACCM-----" << "SHGPUUACR------" << "SHGPUUACRS-----" << "SHGPUUACRW-----" << "SHGPUUACS------" << "SHGPUUACSA-----" << "SHGPUUACSM-----" << "SHGPUUAD-------" << "SHGPUUAN-------";
-    codes << "SHGPUUE--------" << "SHGPUUI--------" << "SHGPUUL--------" << "SHGPUULC-------" << "SHGPUULD-------" << "SHGPUULF-------" << "SHGPUULM-------" << "SHGPUULS-------" << "SHGPUUM--------" << "SHGPUUMA-------" << "SHGPUUMC-------";
-    codes << "SHGPUUMJ-------" << "SHGPUUMMO------" << "SHGPUUMO-------" << "SHGPUUMQ-------" << "SHGPUUMR-------" << "SHGPUUMRG------" << "SHGPUUMRS------" << "SHGPUUMRSS-----" << "SHGPUUMRX------" << "SHGPUUMS-------" << "SHGPUUMSE------";
-    codes << "SHGPUUMSEA-----" << "SHGPUUMSEC-----" << "SHGPUUMSED-----" << "SHGPUUMSEI-----" << "SHGPUUMSEJ-----" << "SHGPUUMSET-----" << "SHGPUUMT-------" << "SHGPUUP--------" << "SHGPUUS--------" << "SHGPUUSA-------" << "SHGPUUSC-------";
-    codes << "SHGPUUSCL------" << "SHGPUUSF-------" << "SHGPUUSM-------" << "SHGPUUSML------" << "SHGPUUSMN------" << "SHGPUUSMS------" << "SHGPUUSO-------" << "SHGPUUSR-------" << "SHGPUUSRS------" << "SHGPUUSRT------" << "SHGPUUSRW------";
-    codes << "SHGPUUSS-------" << "SHGPUUSW-------" << "SHGPUUSX-------" << "SHPP-----------" << "SHPPL----------" << "SHPPS----------" << "SHPPT----------" << "SHPPV----------" << "SHSP-----------" << "SHSPC----------" << "SHSPCA---------";
-    codes << "SHSPCALA-------" << "SHSPCALC-------" << "SHSPCALS-------" << "SHSPCALSM------" << "SHSPCALST------" << "SHSPCD---------" << "SHSPCH---------" << "SHSPCL---------" << "SHSPCLBB-------" << "SHSPCLCC-------" << "SHSPCLCV-------";
-    codes << "SHSPCLDD-------" << "SHSPCLFF-------" << "SHSPCLLL-------" << "SHSPCLLLAS-----" << "SHSPCLLLMI-----" << "SHSPCLLLSU-----" << "SHSPCM---------" << "SHSPCMMA-------" << "SHSPCMMH-------" << "SHSPCMML-------" << "SHSPCMMS-------";
-    codes << "SHSPCP---------" << "SHSPCPSB-------" << "SHSPCPSU-------" << "SHSPCPSUG------" << "SHSPCPSUM------" << "SHSPCPSUT------" << "SHSPCU---------" << "SHSPCUM--------" << "SHSPCUN--------" << "SHSPCUR--------" << "SHSPCUS--------";
-    codes << "SHSPG----------" << "SHSPGC---------" << "SHSPGG---------" << "SHSPGT---------" << "SHSPGU---------" << "SHSPN----------" << "SHSPNF---------" << "SHSPNH---------" << "SHSPNI---------" << "SHSPNM---------" << "SHSPNR---------";
-    codes << "SHSPNS---------" << "SHSPO----------" << "SHSPXA---------" << "SHSPXAR--------" << "SHSPXAS--------" << "SHSPXF---------" << "SHSPXFDF-------" << "SHSPXFDR-------" << "SHSPXFTR-------" << "SHSPXH---------" << "SHSPXL---------";
-    codes << "SHSPXM---------" << "SHSPXMC--------" << "SHSPXMF--------" << "SHSPXMH--------" << "SHSPXMO--------" << "SHSPXMP--------" << "SHSPXMR--------" << "SHSPXMTO-------" << "SHSPXMTU-------" << "SHSPXP---------" << "SHSPXR---------";
-    codes << "SHUP-----------" << "SHUPE----------" << "SHUPND---------" << "SHUPS----------" << "SHUPS1---------" << "SHUPS2---------" << "SHUPS3---------" << "SHUPS4---------" << "SHUPSB---------" << "SHUPSC---------" << "SHUPSCA--------";
-    codes << "SHUPSCB--------" << "SHUPSCF--------" << "SHUPSCG--------" << "SHUPSCM--------" << "SHUPSF---------" << "SHUPSK---------" << "SHUPSL---------" << "SHUPSN---------" << "SHUPSNA--------" << "SHUPSNB--------" << "SHUPSNF--------";
-    codes << "SHUPSNG--------" << "SHUPSNM--------" << "SHUPSO---------" << "SHUPSOF--------" << "SHUPSR---------" << "SHUPSU---------" << "SHUPSUM--------" << "SHUPSUN--------" << "SHUPSUS--------" << "SHUPSX---------" << "SHUPV----------";
-    codes << "SHUPW----------" << "SHUPWD---------" << "SHUPWDM--------" << "SHUPWDMG-------" << "SHUPWDMM-------" << "SHUPWM---------" << "SHUPWMA--------" << "SHUPWMB--------" << "SHUPWMBD-------" << "SHUPWMC--------" << "SHUPWMD--------";
-    codes << "SHUPWME--------" << "SHUPWMF--------" << "SHUPWMFC-------" << "SHUPWMFD-------" << "SHUPWMFE-------" << "SHUPWMFO-------" << "SHUPWMFR-------" << "SHUPWMFX-------" << "SHUPWMG--------" << "SHUPWMGC-------" << "SHUPWMGD-------";
-    codes << "SHUPWMGE-------" << "SHUPWMGO-------" << "SHUPWMGR-------" << "SHUPWMGX-------" << "SHUPWMM--------" << "SHUPWMMC-------" << "SHUPWMMD-------" << "SHUPWMME-------" << "SHUPWMMO-------" << "SHUPWMMR-------" << "SHUPWMMX-------";
-    codes << "SHUPWMN--------" << "SHUPWMO--------" << "SHUPWMOD-------" << "SHUPWMR--------" << "SHUPWMS--------" << "SHUPWMSD-------" << "SHUPWMSX-------" << "SHUPWMX--------" << "SHUPWT---------" << "SHUPX----------" << "SNAP-----------";
-    codes << "SNAPC----------" << "SNAPCF---------" << "SNAPCH---------" << "SNAPCL---------" << "SNAPM----------" << "SNAPME---------" << "SNAPMF---------" << "SNAPMFA--------" << "SNAPMFB--------" << "SNAPMFC--------" << "SNAPMFCH-------";
-    codes << "SNAPMFCL-------" << "SNAPMFCM-------" << "SNAPMFD--------" << "SNAPMFF--------" << "SNAPMFFI-------" << "SNAPMFH--------" << "SNAPMFJ--------" << "SNAPMFK--------" << "SNAPMFKB-------" << "SNAPMFKD-------" << "SNAPMFL--------";
-    codes << "SNAPMFM--------" << "SNAPMFO--------" << "SNAPMFP--------" << "SNAPMFPM-------" << "SNAPMFPN-------" << "SNAPMFQ--------" << "SNAPMFQA-------" << "SNAPMFQB-------" << "SNAPMFQC-------" << "SNAPMFQD-------" << "SNAPMFQF-------";
-    codes << "SNAPMFQH-------" << "SNAPMFQI-------" << "SNAPMFQJ-------" << "SNAPMFQK-------" << "SNAPMFQL-------" << "SNAPMFQM-------" << "SNAPMFQN-------" << "SNAPMFQO-------" << "SNAPMFQP-------" << "SNAPMFQR-------" << "SNAPMFQRW------";
-    codes << "SNAPMFQRX------" << "SNAPMFQRZ------" << "SNAPMFQS-------" << "SNAPMFQT-------" << "SNAPMFQU-------" << "SNAPMFQY-------" << "SNAPMFR--------" << "SNAPMFRW-------" << "SNAPMFRX-------" << "SNAPMFRZ-------" << "SNAPMFS--------";
-    codes << "SNAPMFT--------" << "SNAPMFU--------" << "SNAPMFUH-------" << "SNAPMFUL-------" << "SNAPMFUM-------" << "SNAPMFY--------" << "SNAPMH---------" << "SNAPMHA--------" << "SNAPMHC--------" << "SNAPMHCH-------" << "SNAPMHCL-------";
-    codes << "SNAPMHCM-------" << "SNAPMHD--------" << "SNAPMHH--------" << "SNAPMHI--------" << "SNAPMHJ--------" << "SNAPMHK--------" << "SNAPMHM--------" << "SNAPMHO--------" << "SNAPMHQ--------" << "SNAPMHR--------" << "SNAPMHS--------";
-    codes << "SNAPMHT--------" << "SNAPMHU--------" << "SNAPMHUH-------" << "SNAPMHUL-------" << "SNAPMHUM-------" << "SNAPML---------" << "SNAPMV---------" << "SNAPW----------" << "SNAPWB---------" << "SNAPWD---------" << "SNAPWM---------";
-    codes << "SNAPWMA--------" << "SNAPWMAA-------" << "SNAPWMAP-------" << "SNAPWMAS-------" << "SNAPWMB--------" << "SNAPWMCM-------" << "SNAPWMS--------" << "SNAPWMSA-------" << "SNAPWMSB-------" << "SNAPWMSS-------" << "SNAPWMSU-------";
-    codes << "SNAPWMU--------" << "SNFP-----------" << "SNFPA----------" << "SNFPAF---------" << "SNFPAFA--------" << "SNFPAFK--------" << "SNFPAFU--------" << "SNFPAFUH-------" << "SNFPAFUL-------" << "SNFPAFUM-------" << "SNFPAH---------";
-    codes << "SNFPAHA--------" << "SNFPAHH--------" << "SNFPAHU--------" << "SNFPAHUH-------" << "SNFPAHUL-------" << "SNFPAHUM-------" << "SNFPAV---------" << "SNFPB----------" << "SNFPG----------" << "SNFPGC---------" << "SNFPGP---------";
-    codes << "SNFPGPA--------" << "SNFPGR---------" << "SNFPGS---------" << "SNFPN----------" << "SNFPNB---------" << "SNFPNN---------" << "SNFPNS---------" << "SNFPNU---------" << "SNGP-----------" << "SNGPE----------" << "SNGPES---------";
-    codes << "SNGPESE--------" << "SNGPESR--------" << "SNGPEV---------" << "SNGPEVA--------" << "SNGPEVAA-------" << "SNGPEVAAR------" << "SNGPEVAC-------" << "SNGPEVAI-------" << "SNGPEVAL-------" << "SNGPEVAS-------" << "SNGPEVAT-------";
-    codes << "SNGPEVATH------" << "SNGPEVATHR-----" << "SNGPEVATL------" << "SNGPEVATLR-----" << "SNGPEVATM------" << "SNGPEVATMR-----" << "SNGPEVC--------" << "SNGPEVCA-------" << "SNGPEVCAH------" << "SNGPEVCAL------" << "SNGPEVCAM------";
-    codes << "SNGPEVCF-------" << "SNGPEVCFH------" << "SNGPEVCFL------" << "SNGPEVCFM------" << "SNGPEVCJ-------" << "SNGPEVCJH------" << "SNGPEVCJL------" << "SNGPEVCJM------" << "SNGPEVCM-------" << "SNGPEVCMH------" << "SNGPEVCML------";
-    codes << "SNGPEVCMM------" << "SNGPEVCO-------" << "SNGPEVCOH------" << "SNGPEVCOL------" << "SNGPEVCOM------" << "SNGPEVCT-------" << "SNGPEVCTH------" << "SNGPEVCTL------" << "SNGPEVCTM------" << "SNGPEVCU-------" << "SNGPEVCUH------";
-    codes << "SNGPEVCUL------" << "SNGPEVCUM------" << "SNGPEVE--------" << "SNGPEVEA-------" << "SNGPEVEAA------" << "SNGPEVEAT------" << "SNGPEVEB-------" << "SNGPEVEC-------" << "SNGPEVED-------" << "SNGPEVEDA------" << "SNGPEVEE-------";
-    codes << "SNGPEVEF-------" << "SNGPEVEH-------" << "SNGPEVEM-------" << "SNGPEVEML------" << "SNGPEVEMV------" << "SNGPEVER-------" << "SNGPEVES-------" << "SNGPEVM--------" << "SNGPEVS--------" << "SNGPEVSC-------" << "SNGPEVSP-------";
-    codes << "SNGPEVSR-------" << "SNGPEVST-------" << "SNGPEVSW-------" << "SNGPEVT--------" << "SNGPEVU--------" << "SNGPEVUA-------" << "SNGPEVUAA------" << "SNGPEVUB-------" << "SNGPEVUL-------" << "SNGPEVUR-------" << "SNGPEVUS-------";
-    codes << "SNGPEVUSH------" << "SNGPEVUSL------" << "SNGPEVUSM------" << "SNGPEVUT-------" << "SNGPEVUTH------" << "SNGPEVUTL------" << "SNGPEVUX-------" << "SNGPEWA--------" << "SNGPEWAH-------" << "SNGPEWAL-------" << "SNGPEWAM-------";
-    codes << "SNGPEWD--------" << "SNGPEWDH-------" << "SNGPEWDHS------" << "SNGPEWDL-------" << "SNGPEWDLS------" << "SNGPEWDM-------" << "SNGPEWDMS------" << "SNGPEWG--------" << "SNGPEWGH-------" << "SNGPEWGL-------" << "SNGPEWGM-------";
-    codes << "SNGPEWGR-------" << "SNGPEWH--------" << "SNGPEWHH-------" << "SNGPEWHHS------" << "SNGPEWHL-------" << "SNGPEWHLS------" << "SNGPEWHM-------" << "SNGPEWHMS------" << "SNGPEWM--------" << "SNGPEWMA-------" << "SNGPEWMAI------";
-    codes << "SNGPEWMAIE-----" << "SNGPEWMAIR-----" << "SNGPEWMAL------" << "SNGPEWMALE-----" << "SNGPEWMALR-----" << "SNGPEWMAS------" << "SNGPEWMASE-----" << "SNGPEWMASR-----" << "SNGPEWMAT------" << "SNGPEWMATE-----" << "SNGPEWMATR-----";
-    codes << "SNGPEWMS-------" << "SNGPEWMSI------" << "SNGPEWMSL------" << "SNGPEWMSS------" << "SNGPEWMT-------" << "SNGPEWMTH------" << "SNGPEWMTL------" << "SNGPEWMTM------" << "SNGPEWO--------" << "SNGPEWOH-------" << "SNGPEWOL-------";
-    codes << "SNGPEWOM-------" << "SNGPEWR--------" << "SNGPEWRH-------" << "SNGPEWRL-------" << "SNGPEWRR-------" << "SNGPEWS--------" << "SNGPEWSH-------" << "SNGPEWSL-------" << "SNGPEWSM-------" << "SNGPEWT--------" << "SNGPEWTH-------";
-    codes << "SNGPEWTL-------" << "SNGPEWTM-------" << "SNGPEWX--------" << "SNGPEWXH-------" << "SNGPEWXL-------" << "SNGPEWXM-------" << "SNGPEWZ--------" << "SNGPEWZH-------" << "SNGPEWZL-------" << "SNGPEWZM-------" << "SNGPEXF--------";
-    codes << "SNGPEXI--------" << "SNGPEXL--------" << "SNGPEXM--------" << "SNGPEXMC-------" << "SNGPEXML-------" << "SNGPEXN--------" << "SNGPI----------" << "SNGPIB---------" << "SNGPIBA--------" << "SNGPIBN--------" << "SNGPIE---------";
-    codes << "SNGPIG---------" << "SNGPIMA--------" << "SNGPIMC--------" << "SNGPIME--------" << "SNGPIMF--------" << "SNGPIMFA-------" << "SNGPIMFP-------" << "SNGPIMFPW------" << "SNGPIMFS-------" << "SNGPIMG--------" << "SNGPIMM--------";
-    codes << "SNGPIMN--------" << "SNGPIMNB-------" << "SNGPIMS--------" << "SNGPIMV--------" << "SNGPIP---------" << "SNGPIPD--------" << "SNGPIR---------" << "SNGPIRM--------" << "SNGPIRN--------" << "SNGPIRNB-------" << "SNGPIRNC-------";
-    codes << "SNGPIRNN-------" << "SNGPIRP--------" << "SNGPIT---------" << "SNGPIU---------" << "SNGPIUE--------" << "SNGPIUED-------" << "SNGPIUEF-------" << "SNGPIUEN-------" << "SNGPIUP--------" << "SNGPIUR--------" << "SNGPIUT--------";
-    codes << "SNGPIX---------" << "SNGPIXH--------" << "SNGPU----------" << "SNGPUC---------" << "SNGPUCA--------" << "SNGPUCAA-------" << "SNGPUCAAA------" << "SNGPUCAAAS-----" << "SNGPUCAAAT-----" << "SNGPUCAAAW-----" << "SNGPUCAAC------";
-    codes << "SNGPUCAAD------" << "SNGPUCAAL------" << "SNGPUCAAM------" << "SNGPUCAAO------" << "SNGPUCAAOS-----" << "SNGPUCAAS------" << "SNGPUCAAU------" << "SNGPUCAT-------" << "SNGPUCATA------" << "SNGPUCATH------" << "SNGPUCATL------";
-    codes << "SNGPUCATM------" << "SNGPUCATR------" << "SNGPUCATW------" << "SNGPUCATWR-----" << "SNGPUCAW-------" << "SNGPUCAWA------" << "SNGPUCAWH------" << "SNGPUCAWL------" << "SNGPUCAWM------" << "SNGPUCAWR------" << "SNGPUCAWS------";
-    codes << "SNGPUCAWW------" << "SNGPUCAWWR-----" << "SNGPUCD--------" << "SNGPUCDC-------" << "SNGPUCDG-------" << "SNGPUCDH-------" << "SNGPUCDHH------" << "SNGPUCDHP------" << "SNGPUCDM-------" << "SNGPUCDMH------" << "SNGPUCDML------";
-    codes << "SNGPUCDMLA-----" << "SNGPUCDMM------" << "SNGPUCDO-------" << "SNGPUCDS-------" << "SNGPUCDSC------" << "SNGPUCDSS------" << "SNGPUCDSV------" << "SNGPUCDT-------" << "SNGPUCE--------" << "SNGPUCEC-------" << "SNGPUCECA------";
-    codes << "SNGPUCECC------" << "SNGPUCECH------" << "SNGPUCECL------" << "SNGPUCECM------" << "SNGPUCECO------" << "SNGPUCECR------" << "SNGPUCECS------" << "SNGPUCECT------" << "SNGPUCECW------" << "SNGPUCEN-------" << "SNGPUCENN------";
-    codes << "SNGPUCF--------" << "SNGPUCFH-------" << "SNGPUCFHA------" << "SNGPUCFHC------" << "SNGPUCFHE------" << "SNGPUCFHH------" << "SNGPUCFHL------" << "SNGPUCFHM------" << "SNGPUCFHO------" << "SNGPUCFHS------" << "SNGPUCFHX------";
-    codes << "SNGPUCFM-------" << "SNGPUCFML------" << "SNGPUCFMS------" << "SNGPUCFMT------" << "SNGPUCFMTA-----" << "SNGPUCFMTC-----" << "SNGPUCFMTO-----" << "SNGPUCFMTS-----" << "SNGPUCFMW------" << "SNGPUCFO-------" << "SNGPUCFOA------";
-    codes << "SNGPUCFOL------" << "SNGPUCFOO------" << "SNGPUCFOS------" << "SNGPUCFR-------" << "SNGPUCFRM------" << "SNGPUCFRMR-----" << "SNGPUCFRMS-----" << "SNGPUCFRMT-----" << "SNGPUCFRS------" << "SNGPUCFRSR-----" << "SNGPUCFRSS-----";
-    codes << "SNGPUCFRST-----" << "SNGPUCFS-------" << "SNGPUCFSA------" << "SNGPUCFSL------" << "SNGPUCFSO------" << "SNGPUCFSS------" << "SNGPUCFT-------" << "SNGPUCFTA------" << "SNGPUCFTC------" << "SNGPUCFTCD-----" << "SNGPUCFTCM-----";
-    codes << "SNGPUCFTF------" << "SNGPUCFTR------" << "SNGPUCFTS------" << "SNGPUCI--------" << "SNGPUCIA-------" << "SNGPUCIC-------" << "SNGPUCII-------" << "SNGPUCIL-------" << "SNGPUCIM-------" << "SNGPUCIN-------" << "SNGPUCIO-------";
-    codes << "SNGPUCIS-------" << "SNGPUCIZ-------" << "SNGPUCM--------" << "SNGPUCMS-------" << "SNGPUCMT-------" << "SNGPUCR--------" << "SNGPUCRA-------" << "SNGPUCRC-------" << "SNGPUCRH-------" << "SNGPUCRL-------" << "SNGPUCRO-------";
-    codes << "SNGPUCRR-------" << "SNGPUCRRD------" << "SNGPUCRRF------" << "SNGPUCRRL------" << "SNGPUCRS-------" << "SNGPUCRV-------" << "SNGPUCRVA------" << "SNGPUCRVG------" << "SNGPUCRVM------" << "SNGPUCRVO------" << "SNGPUCRX-------";
-    codes << "SNGPUCS--------" << "SNGPUCSA-------" << "SNGPUCSG-------" << "SNGPUCSGA------" << "SNGPUCSGD------" << "SNGPUCSGM------" << "SNGPUCSM-------" << "SNGPUCSR-------" << "SNGPUCSW-------" << "SNGPUCV--------" << "SNGPUCVC-------";
-    codes << "SNGPUCVF-------" << "SNGPUCVFA------" << "SNGPUCVFR------" << "SNGPUCVFU------" << "SNGPUCVR-------" << "SNGPUCVRA------" << "SNGPUCVRM------" << "SNGPUCVRS------" << "SNGPUCVRU------" << "SNGPUCVRUC-----" << "SNGPUCVRUE-----";
-    codes << "SNGPUCVRUH-----" << "SNGPUCVRUL-----" << "SNGPUCVRUM-----" << "SNGPUCVRW------" << "SNGPUCVS-------" << "SNGPUCVU-------" << "SNGPUCVUF------" << "SNGPUCVUR------" << "SNGPUCVV-------" << "SNGPUH---------" << "SNGPUS---------";
-    codes << "SNGPUSA--------" << "SNGPUSAC-------" << "SNGPUSAF-------" << "SNGPUSAFC------" << "SNGPUSAFT------" << "SNGPUSAJ-------" << "SNGPUSAJC------" << "SNGPUSAJT------" << "SNGPUSAL-------" << "SNGPUSALC------" << "SNGPUSALT------";
-    codes << "SNGPUSAM-------" << "SNGPUSAMC------" << "SNGPUSAMT------" << "SNGPUSAO-------" << "SNGPUSAOC------" << "SNGPUSAOT------" << "SNGPUSAP-------" << "SNGPUSAPB------" << "SNGPUSAPBC-----" << "SNGPUSAPBT-----" << "SNGPUSAPC------";
-    codes << "SNGPUSAPM------" << "SNGPUSAPMC-----" << "SNGPUSAPMT-----" << "SNGPUSAPT------" << "SNGPUSAQ-------" << "SNGPUSAQC------" << "SNGPUSAQT------" << "SNGPUSAR-------" << "SNGPUSARC------" << "SNGPUSART------" << "SNGPUSAS-------";
-    codes << "SNGPUSASC------" << "SNGPUSAST------" << "SNGPUSAT-------" << "SNGPUSAW-------" << "SNGPUSAWC------" << "SNGPUSAWT------" << "SNGPUSAX-------" << "SNGPUSAXC------" << "SNGPUSAXT------" << "SNGPUSM--------" << "SNGPUSMC-------";
-    codes << "SNGPUSMD-------" << "SNGPUSMDC------" << "SNGPUSMDT------" << "SNGPUSMM-------" << "SNGPUSMMC------" << "SNGPUSMMT------" << "SNGPUSMP-------" << "SNGPUSMPC------" << "SNGPUSMPT------" << "SNGPUSMT-------" << "SNGPUSMV-------";
-    codes << "SNGPUSMVC------" << "SNGPUSMVT------" << "SNGPUSS--------" << "SNGPUSS1-------" << "SNGPUSS1C------" << "SNGPUSS1T------" << "SNGPUSS2-------" << "SNGPUSS2C------" << "SNGPUSS2T------" << "SNGPUSS3-------" << "SNGPUSS3A------";
-    codes << "SNGPUSS3AC-----" << "SNGPUSS3AT-----" << "SNGPUSS3C------" << "SNGPUSS3T------" << "SNGPUSS4-------" << "SNGPUSS4C------" << "SNGPUSS4T------" << "SNGPUSS5-------" << "SNGPUSS5C------" << "SNGPUSS5T------" << "SNGPUSS6-------";
-    codes << "SNGPUSS6C------" << "SNGPUSS6T------" << "SNGPUSS7-------" << "SNGPUSS7C------" << "SNGPUSS7T------" << "SNGPUSS8-------" << "SNGPUSS8C------" << "SNGPUSS8T------" << "SNGPUSS9-------" << "SNGPUSS9C------" << "SNGPUSS9T------";
-    codes << "SNGPUSSC-------" << "SNGPUSSL-------" << "SNGPUSSLC------" << "SNGPUSSLT------" << "SNGPUSST-------" << "SNGPUSSW-------" << "SNGPUSSWC------" << "SNGPUSSWP------" << "SNGPUSSWPC-----" << "SNGPUSSWPT-----" << "SNGPUSSWT------";
-    codes << "SNGPUSSX-------" << "SNGPUSSXC------" << "SNGPUSSXT------" << "SNGPUST--------" << "SNGPUSTA-------" << "SNGPUSTAC------" << "SNGPUSTAT------" << "SNGPUSTC-------" << "SNGPUSTI-------" << "SNGPUSTIC------" << "SNGPUSTIT------";
-    codes << "SNGPUSTM-------" << "SNGPUSTMC------" << "SNGPUSTMT------" << "SNGPUSTR-------" << "SNGPUSTRC------" << "SNGPUSTRT------" << "SNGPUSTS-------" << "SNGPUSTSC------" << "SNGPUSTST------" << "SNGPUSTT-------" << "SNGPUSX--------";
-    codes << "SNGPUSXC-------" << "SNGPUSXE-------" << "SNGPUSXEC------" << "SNGPUSXET------" << "SNGPUSXH-------" << "SNGPUSXHC------" << "SNGPUSXHT------" << "SNGPUSXO-------" << "SNGPUSXOC------" << "SNGPUSXOM------" << "SNGPUSXOMC-----";
-    codes << "SNGPUSXOMT-----" << "SNGPUSXOT------" << "SNGPUSXR-------" << "SNGPUSXRC------" << "SNGPUSXRT------" << "SNGPUSXT-------" << "SNGPUU---------" << "SNGPUUA--------" << "SNGPUUAB-------" << "SNGPUUABR------" << "SNGPUUAC-------";
-    codes << "SNGPUUACC------" << "SNGPUUACCK-----" << "SNGPUUACCM-----" << "SNGPUUACR------" << "SNGPUUACRS-----" << "SNGPUUACRW-----" << "SNGPUUACS------" << "SNGPUUACSA-----" << "SNGPUUACSM-----" << "SNGPUUAD-------" << "SNGPUUAN-------";
-    codes << "SNGPUUE--------" << "SNGPUUI--------" << "SNGPUUL--------" << "SNGPUULC-------" << "SNGPUULD-------" << "SNGPUULF-------" << "SNGPUULM-------" << "SNGPUULS-------" << "SNGPUUM--------" << "SNGPUUMA-------" << "SNGPUUMC-------";
-    codes << "SNGPUUMJ-------" << "SNGPUUMMO------" << "SNGPUUMO-------" << "SNGPUUMQ-------" << "SNGPUUMR-------" << "SNGPUUMRG------" << "SNGPUUMRS------" << "SNGPUUMRSS-----" << "SNGPUUMRX------" << "SNGPUUMS-------" << "SNGPUUMSE------";
-    codes << "SNGPUUMSEA-----" << "SNGPUUMSEC-----" << "SNGPUUMSED-----" << "SNGPUUMSEI-----" << "SNGPUUMSEJ-----" << "SNGPUUMSET-----" << "SNGPUUMT-------" << "SNGPUUP--------" << "SNGPUUS--------" << "SNGPUUSA-------" << "SNGPUUSC-------";
-    codes << "SNGPUUSCL------" << "SNGPUUSF-------" << "SNGPUUSM-------" << "SNGPUUSML------" << "SNGPUUSMN------" << "SNGPUUSMS------" << "SNGPUUSO-------" << "SNGPUUSR-------" << "SNGPUUSRS------" << "SNGPUUSRT------" << "SNGPUUSRW------";
-    codes << "SNGPUUSS-------" << "SNGPUUSW-------" << "SNGPUUSX-------" << "SNPP-----------" << "SNPPL----------" << "SNPPS----------" << "SNPPT----------" << "SNPPV----------" << "SNSP-----------" << "SNSPC----------" << "SNSPCA---------";
-    codes << "SNSPCALA-------" << "SNSPCALC-------" << "SNSPCALS-------" << "SNSPCALSM------" << "SNSPCALST------" << "SNSPCD---------" << "SNSPCH---------" << "SNSPCL---------" << "SNSPCLBB-------" << "SNSPCLCC-------" << "SNSPCLCV-------";
-    codes << "SNSPCLDD-------" << "SNSPCLFF-------" << "SNSPCLLL-------" << "SNSPCLLLAS-----" << "SNSPCLLLMI-----" << "SNSPCLLLSU-----" << "SNSPCM---------" << "SNSPCMMA-------" << "SNSPCMMH-------" << "SNSPCMML-------" << "SNSPCMMS-------";
-    codes << "SNSPCP---------" << "SNSPCPSB-------" << "SNSPCPSU-------" << "SNSPCPSUG------" << "SNSPCPSUM------" << "SNSPCPSUT------" << "SNSPCU---------" << "SNSPCUM--------" << "SNSPCUN--------" << "SNSPCUR--------" << "SNSPCUS--------";
-    codes << "SNSPG----------" << "SNSPGC---------" << "SNSPGG---------" << "SNSPGT---------" << "SNSPGU---------" << "SNSPN----------" << "SNSPNF---------" << "SNSPNH---------" << "SNSPNI---------" << "SNSPNM---------" << "SNSPNR---------";
-    codes << "SNSPNS---------" << "SNSPO----------" << "SNSPXA---------" << "SNSPXAR--------" << "SNSPXAS--------" << "SNSPXF---------" << "SNSPXFDF-------" << "SNSPXFDR-------" << "SNSPXFTR-------" << "SNSPXH---------" << "SNSPXL---------";
-    codes << "SNSPXM---------" << "SNSPXMC--------" << "SNSPXMF--------" << "SNSPXMH--------" << "SNSPXMO--------" << "SNSPXMP--------" << "SNSPXMR--------" << "SNSPXMTO-------" << "SNSPXMTU-------" << "SNSPXP---------" << "SNSPXR---------";
-    codes << "SNUP-----------" << "SNUPE----------" << "SNUPND---------" << "SNUPS----------" << "SNUPS1---------" << "SNUPS2---------" << "SNUPS3---------" << "SNUPS4---------" << "SNUPSB---------" << "SNUPSC---------" << "SNUPSCA--------";
-    codes << "SNUPSCB--------" << "SNUPSCF--------" << "SNUPSCG--------" << "SNUPSCM--------" << "SNUPSF---------" << "SNUPSK---------" << "SNUPSL---------" << "SNUPSN---------" << "SNUPSNA--------" << "SNUPSNB--------" << "SNUPSNF--------";
-    codes << "SNUPSNG--------" << "SNUPSNM--------" << "SNUPSO---------" << "SNUPSOF--------" << "SNUPSR---------" << "SNUPSU---------" << "SNUPSUM--------" << "SNUPSUN--------" << "SNUPSUS--------" << "SNUPSX---------" << "SNUPV----------";
-    codes << "SNUPW----------" << "SNUPWD---------" << "SNUPWDM--------" << "SNUPWDMG-------" << "SNUPWDMM-------" << "SNUPWM---------" << "SNUPWMA--------" << "SNUPWMB--------" << "SNUPWMBD-------" << "SNUPWMC--------" << "SNUPWMD--------";
-    codes << "SNUPWME--------" << "SNUPWMF--------" << "SNUPWMFC-------" << "SNUPWMFD-------" << "SNUPWMFE-------" << "SNUPWMFO-------" << "SNUPWMFR-------" << "SNUPWMFX-------" << "SNUPWMG--------" << "SNUPWMGC-------" << "SNUPWMGD-------";
-    codes << "SNUPWMGE-------" << "SNUPWMGO-------" << "SNUPWMGR-------" << "SNUPWMGX-------" << "SNUPWMM--------" << "SNUPWMMC-------" << "SNUPWMMD-------" << "SNUPWMME-------" << "SNUPWMMO-------" << "SNUPWMMR-------" << "SNUPWMMX-------";
-    codes << "SNUPWMN--------" << "SNUPWMO--------" << "SNUPWMOD-------" << "SNUPWMR--------" << "SNUPWMS--------" << "SNUPWMSD-------" << "SNUPWMSX-------" << "SNUPWMX--------" << "SNUPWT---------" << "SNUPX----------" << "SUAP-----------";
-    codes << "SUAPC----------" << "SUAPCF---------" << "SUAPCH---------" << "SUAPCL---------" << "SUAPM----------" << "SUAPME---------" << "SUAPMF---------" << "SUAPMFA--------" << "SUAPMFB--------" << "SUAPMFC--------" << "SUAPMFCH-------";
-    codes << "SUAPMFCL-------" << "SUAPMFCM-------" << "SUAPMFD--------" << "SUAPMFF--------" << "SUAPMFFI-------" << "SUAPMFH--------" << "SUAPMFJ--------" << "SUAPMFK--------" << "SUAPMFKB-------" << "SUAPMFKD-------" << "SUAPMFL--------";
-    codes << "SUAPMFM--------" << "SUAPMFO--------" << "SUAPMFP--------" << "SUAPMFPM-------" << "SUAPMFPN-------" << "SUAPMFQ--------" << "SUAPMFQA-------" << "SUAPMFQB-------" << "SUAPMFQC-------" << "SUAPMFQD-------" << "SUAPMFQF-------";
-    codes << "SUAPMFQH-------" << "SUAPMFQI-------" << "SUAPMFQJ-------" << "SUAPMFQK-------" << "SUAPMFQL-------" << "SUAPMFQM-------" << "SUAPMFQN-------" << "SUAPMFQO-------" << "SUAPMFQP-------" << "SUAPMFQR-------" << "SUAPMFQRW------";
-    codes << "SUAPMFQRX------" << "SUAPMFQRZ------" << "SUAPMFQS-------" << "SUAPMFQT-------" << "SUAPMFQU-------" << "SUAPMFQY-------" << "SUAPMFR--------" << "SUAPMFRW-------" << "SUAPMFRX-------" << "SUAPMFRZ-------" << "SUAPMFS--------";
-    codes << "SUAPMFT--------" << "SUAPMFU--------" << "SUAPMFUH-------" << "SUAPMFUL-------" << "SUAPMFUM-------" << "SUAPMFY--------" << "SUAPMH---------" << "SUAPMHA--------" << "SUAPMHC--------" << "SUAPMHCH-------" << "SUAPMHCL-------";
-    codes << "SUAPMHCM-------" << "SUAPMHD--------" << "SUAPMHH--------" << "SUAPMHI--------" << "SUAPMHJ--------" << "SUAPMHK--------" << "SUAPMHM--------" << "SUAPMHO--------" << "SUAPMHQ--------" << "SUAPMHR--------" << "SUAPMHS--------";
-    codes << "SUAPMHT--------" << "SUAPMHU--------" << "SUAPMHUH-------" << "SUAPMHUL-------" << "SUAPMHUM-------" << "SUAPML---------" << "SUAPMV---------" << "SUAPW----------" << "SUAPWB---------" << "SUAPWD---------" << "SUAPWM---------";
-    codes << "SUAPWMA--------" << "SUAPWMAA-------" << "SUAPWMAP-------" << "SUAPWMAS-------" << "SUAPWMB--------" << "SUAPWMCM-------" << "SUAPWMS--------" << "SUAPWMSA-------" << "SUAPWMSB-------" << "SUAPWMSS-------" << "SUAPWMSU-------";
-    codes << "SUAPWMU--------" << "SUFP-----------" << "SUFPA----------" << "SUFPAF---------" << "SUFPAFA--------" << "SUFPAFK--------" << "SUFPAFU--------" << "SUFPAFUH-------" << "SUFPAFUL-------" << "SUFPAFUM-------" << "SUFPAH---------";
-    codes << "SUFPAHA--------" << "SUFPAHH--------" << "SUFPAHU--------" << "SUFPAHUH-------" << "SUFPAHUL-------" << "SUFPAHUM-------" << "SUFPAV---------" << "SUFPB----------" << "SUFPG----------" << "SUFPGC---------" << "SUFPGP---------";
-    codes << "SUFPGPA--------" << "SUFPGR---------" << "SUFPGS---------" << "SUFPN----------" << "SUFPNB---------" << "SUFPNN---------" << "SUFPNS---------" << "SUFPNU---------" << "SUGP-----------" << "SUGPE----------" << "SUGPES---------";
-    codes << "SUGPESE--------" << "SUGPESR--------" << "SUGPEV---------" << "SUGPEVA--------" << "SUGPEVAA-------" << "SUGPEVAAR------" << "SUGPEVAC-------" << "SUGPEVAI-------" << "SUGPEVAL-------" << "SUGPEVAS-------" << "SUGPEVAT-------";
-    codes << "SUGPEVATH------" << "SUGPEVATHR-----" << "SUGPEVATL------" << "SUGPEVATLR-----" << "SUGPEVATM------" << "SUGPEVATMR-----" << "SUGPEVC--------" << "SUGPEVCA-------" << "SUGPEVCAH------" << "SUGPEVCAL------" << "SUGPEVCAM------";
-    codes << "SUGPEVCF-------" << "SUGPEVCFH------" << "SUGPEVCFL------" << "SUGPEVCFM------" << "SUGPEVCJ-------" << "SUGPEVCJH------" << "SUGPEVCJL------" << "SUGPEVCJM------" << "SUGPEVCM-------" << "SUGPEVCMH------" << "SUGPEVCML------";
-    codes << "SUGPEVCMM------" << "SUGPEVCO-------" << "SUGPEVCOH------" << "SUGPEVCOL------" << "SUGPEVCOM------" << "SUGPEVCT-------" << "SUGPEVCTH------" << "SUGPEVCTL------" << "SUGPEVCTM------" << "SUGPEVCU-------" << "SUGPEVCUH------";
-    codes << "SUGPEVCUL------" << "SUGPEVCUM------" << "SUGPEVE--------" << "SUGPEVEA-------" << "SUGPEVEAA------" << "SUGPEVEAT------" << "SUGPEVEB-------" << "SUGPEVEC-------" << "SUGPEVED-------" << "SUGPEVEDA------" << "SUGPEVEE-------";
-    codes << "SUGPEVEF-------" << "SUGPEVEH-------" << "SUGPEVEM-------" << "SUGPEVEML------" << "SUGPEVEMV------" << "SUGPEVER-------" << "SUGPEVES-------" << "SUGPEVM--------" << "SUGPEVS--------" << "SUGPEVSC-------" << "SUGPEVSP-------";
-    codes << "SUGPEVSR-------" << "SUGPEVST-------" << "SUGPEVSW-------" << "SUGPEVT--------" << "SUGPEVU--------" << "SUGPEVUA-------" << "SUGPEVUAA------" << "SUGPEVUB-------" << "SUGPEVUL-------" << "SUGPEVUR-------" << "SUGPEVUS-------";
-    codes << "SUGPEVUSH------" << "SUGPEVUSL------" << "SUGPEVUSM------" << "SUGPEVUT-------" << "SUGPEVUTH------" << "SUGPEVUTL------" << "SUGPEVUX-------" << "SUGPEWA--------" << "SUGPEWAH-------" << "SUGPEWAL-------" << "SUGPEWAM-------";
-    codes << "SUGPEWD--------" << "SUGPEWDH-------" << "SUGPEWDHS------" << "SUGPEWDL-------" << "SUGPEWDLS------" << "SUGPEWDM-------" << "SUGPEWDMS------" << "SUGPEWG--------" << "SUGPEWGH-------" << "SUGPEWGL-------" << "SUGPEWGM-------";
-    codes << "SUGPEWGR-------" << "SUGPEWH--------" << "SUGPEWHH-------" << "SUGPEWHHS------" << "SUGPEWHL-------" << "SUGPEWHLS------" << "SUGPEWHM-------" << "SUGPEWHMS------" << "SUGPEWM--------" << "SUGPEWMA-------" << "SUGPEWMAI------";
-    codes << "SUGPEWMAIE-----" << "SUGPEWMAIR-----" << "SUGPEWMAL------" << "SUGPEWMALE-----" << "SUGPEWMALR-----" << "SUGPEWMAS------" << "SUGPEWMASE-----" << "SUGPEWMASR-----" << "SUGPEWMAT------" << "SUGPEWMATE-----" << "SUGPEWMATR-----";
-    codes << "SUGPEWMS-------" << "SUGPEWMSI------" << "SUGPEWMSL------" << "SUGPEWMSS------" << "SUGPEWMT-------" << "SUGPEWMTH------" << "SUGPEWMTL------" << "SUGPEWMTM------" << "SUGPEWO--------" << "SUGPEWOH-------" << "SUGPEWOL-------";
-    codes << "SUGPEWOM-------" << "SUGPEWR--------" << "SUGPEWRH-------" << "SUGPEWRL-------" << "SUGPEWRR-------" << "SUGPEWS--------" << "SUGPEWSH-------" << "SUGPEWSL-------" << "SUGPEWSM-------" << "SUGPEWT--------" << "SUGPEWTH-------";
-    codes << "SUGPEWTL-------" << "SUGPEWTM-------" << "SUGPEWX--------" << "SUGPEWXH-------" << "SUGPEWXL-------" << "SUGPEWXM-------" << "SUGPEWZ--------" << "SUGPEWZH-------" << "SUGPEWZL-------" << "SUGPEWZM-------" << "SUGPEXF--------";
-    codes << "SUGPEXI--------" << "SUGPEXL--------" << "SUGPEXM--------" << "SUGPEXMC-------" << "SUGPEXML-------" << "SUGPEXN--------" << "SUGPI----------" << "SUGPIB---------" << "SUGPIBA--------" << "SUGPIBN--------" << "SUGPIE---------";
-    codes << "SUGPIG---------" << "SUGPIMA--------" << "SUGPIMC--------" << "SUGPIME--------" << "SUGPIMF--------" << "SUGPIMFA-------" << "SUGPIMFP-------" << "SUGPIMFPW------" << "SUGPIMFS-------" << "SUGPIMG--------" << "SUGPIMM--------";
-    codes << "SUGPIMN--------" << "SUGPIMNB-------" << "SUGPIMS--------" << "SUGPIMV--------" << "SUGPIP---------" << "SUGPIPD--------" << "SUGPIR---------" << "SUGPIRM--------" << "SUGPIRN--------" << "SUGPIRNB-------" << "SUGPIRNC-------";
-    codes << "SUGPIRNN-------" << "SUGPIRP--------" << "SUGPIT---------" << "SUGPIU---------" << "SUGPIUE--------" << "SUGPIUED-------" << "SUGPIUEF-------" << "SUGPIUEN-------" << "SUGPIUP--------" << "SUGPIUR--------" << "SUGPIUT--------";
-    codes << "SUGPIX---------" << "SUGPIXH--------" << "SUGPU----------" << "SUGPUC---------" << "SUGPUCA--------" << "SUGPUCAA-------" << "SUGPUCAAA------" << "SUGPUCAAAS-----" << "SUGPUCAAAT-----" << "SUGPUCAAAW-----" << "SUGPUCAAC------";
-    codes << "SUGPUCAAD------" << "SUGPUCAAL------" << "SUGPUCAAM------" << "SUGPUCAAO------" << "SUGPUCAAOS-----" << "SUGPUCAAS------" << "SUGPUCAAU------" << "SUGPUCAT-------" << "SUGPUCATA------" << "SUGPUCATH------" << "SUGPUCATL------";
-    codes << "SUGPUCATM------" << "SUGPUCATR------" << "SUGPUCATW------" << "SUGPUCATWR-----" << "SUGPUCAW-------" << "SUGPUCAWA------" << "SUGPUCAWH------" << "SUGPUCAWL------" << "SUGPUCAWM------" << "SUGPUCAWR------" << "SUGPUCAWS------";
-    codes << "SUGPUCAWW------" << "SUGPUCAWWR-----" << "SUGPUCD--------" << "SUGPUCDC-------" << "SUGPUCDG-------" << "SUGPUCDH-------" << "SUGPUCDHH------" << "SUGPUCDHP------" << "SUGPUCDM-------" << "SUGPUCDMH------" << "SUGPUCDML------";
-    codes << "SUGPUCDMLA-----" << "SUGPUCDMM------" << "SUGPUCDO-------" << "SUGPUCDS-------" << "SUGPUCDSC------" << "SUGPUCDSS------" << "SUGPUCDSV------" << "SUGPUCDT-------" << "SUGPUCE--------" << "SUGPUCEC-------" << "SUGPUCECA------";
-    codes << "SUGPUCECC------" << "SUGPUCECH------" << "SUGPUCECL------" << "SUGPUCECM------" << "SUGPUCECO------" << "SUGPUCECR------" << "SUGPUCECS------" << "SUGPUCECT------" << "SUGPUCECW------" << "SUGPUCEN-------" << "SUGPUCENN------";
-    codes << "SUGPUCF--------" << "SUGPUCFH-------" << "SUGPUCFHA------" << "SUGPUCFHC------" << "SUGPUCFHE------" << "SUGPUCFHH------" << "SUGPUCFHL------" << "SUGPUCFHM------" << "SUGPUCFHO------" << "SUGPUCFHS------" << "SUGPUCFHX------";
-    codes << "SUGPUCFM-------" << "SUGPUCFML------" << "SUGPUCFMS------" << "SUGPUCFMT------" << "SUGPUCFMTA-----" << "SUGPUCFMTC-----" << "SUGPUCFMTO-----" << "SUGPUCFMTS-----" << "SUGPUCFMW------" << "SUGPUCFO-------" << "SUGPUCFOA------";
-    codes << "SUGPUCFOL------" << "SUGPUCFOO------" << "SUGPUCFOS------" << "SUGPUCFR-------" << "SUGPUCFRM------" << "SUGPUCFRMR-----" << "SUGPUCFRMS-----" << "SUGPUCFRMT-----" << "SUGPUCFRS------" << "SUGPUCFRSR-----" << "SUGPUCFRSS-----";
-    codes << "SUGPUCFRST-----" << "SUGPUCFS-------" << "SUGPUCFSA------" << "SUGPUCFSL------" << "SUGPUCFSO------" << "SUGPUCFSS------" << "SUGPUCFT-------" << "SUGPUCFTA------" << "SUGPUCFTC------" << "SUGPUCFTCD-----" << "SUGPUCFTCM-----";
-    codes << "SUGPUCFTF------" << "SUGPUCFTR------" << "SUGPUCFTS------" << "SUGPUCI--------" << "SUGPUCIA-------" << "SUGPUCIC-------" << "SUGPUCII-------" << "SUGPUCIL-------" << "SUGPUCIM-------" << "SUGPUCIN-------" << "SUGPUCIO-------";
-    codes << "SUGPUCIS-------" << "SUGPUCIZ-------" << "SUGPUCM--------" << "SUGPUCMS-------" << "SUGPUCMT-------" << "SUGPUCR--------" << "SUGPUCRA-------" << "SUGPUCRC-------" << "SUGPUCRH-------" << "SUGPUCRL-------" << "SUGPUCRO-------";
-    codes << "SUGPUCRR-------" << "SUGPUCRRD------" << "SUGPUCRRF------" << "SUGPUCRRL------" << "SUGPUCRS-------" << "SUGPUCRV-------" << "SUGPUCRVA------" << "SUGPUCRVG------" << "SUGPUCRVM------" << "SUGPUCRVO------" << "SUGPUCRX-------";
-    codes << "SUGPUCS--------" << "SUGPUCSA-------" << "SUGPUCSG-------" << "SUGPUCSGA------" << "SUGPUCSGD------" << "SUGPUCSGM------" << "SUGPUCSM-------" << "SUGPUCSR-------" << "SUGPUCSW-------" << "SUGPUCV--------" << "SUGPUCVC-------";
-    codes << "SUGPUCVF-------" << "SUGPUCVFA------" << "SUGPUCVFR------" << "SUGPUCVFU------" << "SUGPUCVR-------" << "SUGPUCVRA------" << "SUGPUCVRM------" << "SUGPUCVRS------" << "SUGPUCVRU------" << "SUGPUCVRUC-----" << "SUGPUCVRUE-----";
-    codes << "SUGPUCVRUH-----" << "SUGPUCVRUL-----" << "SUGPUCVRUM-----" << "SUGPUCVRW------" << "SUGPUCVS-------" << "SUGPUCVU-------" << "SUGPUCVUF------" << "SUGPUCVUR------" << "SUGPUCVV-------" << "SUGPUH---------" << "SUGPUS---------";
-    codes << "SUGPUSA--------" << "SUGPUSAC-------" << "SUGPUSAF-------" << "SUGPUSAFC------" << "SUGPUSAFT------" << "SUGPUSAJ-------" << "SUGPUSAJC------" << "SUGPUSAJT------" << "SUGPUSAL-------" << "SUGPUSALC------" << "SUGPUSALT------";
-    codes << "SUGPUSAM-------" << "SUGPUSAMC------" << "SUGPUSAMT------" << "SUGPUSAO-------" << "SUGPUSAOC------" << "SUGPUSAOT------" << "SUGPUSAP-------" << "SUGPUSAPB------" << "SUGPUSAPBC-----" << "SUGPUSAPBT-----" << "SUGPUSAPC------";
-    codes << "SUGPUSAPM------" << "SUGPUSAPMC-----" << "SUGPUSAPMT-----" << "SUGPUSAPT------" << "SUGPUSAQ-------" << "SUGPUSAQC------" << "SUGPUSAQT------" << "SUGPUSAR-------" << "SUGPUSARC------" << "SUGPUSART------" << "SUGPUSAS-------";
-    codes << "SUGPUSASC------" << "SUGPUSAST------" << "SUGPUSAT-------" << "SUGPUSAW-------" << "SUGPUSAWC------" << "SUGPUSAWT------" << "SUGPUSAX-------" << "SUGPUSAXC------" << "SUGPUSAXT------" << "SUGPUSM--------" << "SUGPUSMC-------";
-    codes << "SUGPUSMD-------" << "SUGPUSMDC------" << "SUGPUSMDT------" << "SUGPUSMM-------" << "SUGPUSMMC------" << "SUGPUSMMT------" << "SUGPUSMP-------" << "SUGPUSMPC------" << "SUGPUSMPT------" << "SUGPUSMT-------" << "SUGPUSMV-------";
-    codes << "SUGPUSMVC------" << "SUGPUSMVT------" << "SUGPUSS--------" << "SUGPUSS1-------" << "SUGPUSS1C------" << "SUGPUSS1T------" << "SUGPUSS2-------" << "SUGPUSS2C------" << "SUGPUSS2T------" << "SUGPUSS3-------" << "SUGPUSS3A------";
-    codes << "SUGPUSS3AC-----" << "SUGPUSS3AT-----" << "SUGPUSS3C------" << "SUGPUSS3T------" << "SUGPUSS4-------" << "SUGPUSS4C------" << "SUGPUSS4T------" << "SUGPUSS5-------" << "SUGPUSS5C------" << "SUGPUSS5T------" << "SUGPUSS6-------";
-    codes << "SUGPUSS6C------" << "SUGPUSS6T------" << "SUGPUSS7-------" << "SUGPUSS7C------" << "SUGPUSS7T------" << "SUGPUSS8-------" << "SUGPUSS8C------" << "SUGPUSS8T------" << "SUGPUSS9-------" << "SUGPUSS9C------" << "SUGPUSS9T------";
-    codes << "SUGPUSSC-------" << "SUGPUSSL-------" << "SUGPUSSLC------" << "SUGPUSSLT------" << "SUGPUSST-------" << "SUGPUSSW-------" << "SUGPUSSWC------" << "SUGPUSSWP------" << "SUGPUSSWPC-----" << "SUGPUSSWPT-----" << "SUGPUSSWT------";
-    codes << "SUGPUSSX-------" << "SUGPUSSXC------" << "SUGPUSSXT------" << "SUGPUST--------" << "SUGPUSTA-------" << "SUGPUSTAC------" << "SUGPUSTAT------" << "SUGPUSTC-------" << "SUGPUSTI-------" << "SUGPUSTIC------" << "SUGPUSTIT------";
-    codes << "SUGPUSTM-------" << "SUGPUSTMC------" << "SUGPUSTMT------" << "SUGPUSTR-------" << "SUGPUSTRC------" << "SUGPUSTRT------" << "SUGPUSTS-------" << "SUGPUSTSC------" << "SUGPUSTST------" << "SUGPUSTT-------" << "SUGPUSX--------";
-    codes << "SUGPUSXC-------" << "SUGPUSXE-------" << "SUGPUSXEC------" << "SUGPUSXET------" << "SUGPUSXH-------" << "SUGPUSXHC------" << "SUGPUSXHT------" << "SUGPUSXO-------" << "SUGPUSXOC------" << "SUGPUSXOM------" << "SUGPUSXOMC-----";
-    codes << "SUGPUSXOMT-----" << "SUGPUSXOT------" << "SUGPUSXR-------" << "SUGPUSXRC------" << "SUGPUSXRT------" << "SUGPUSXT-------" << "SUGPUU---------" << "SUGPUUA--------" << "SUGPUUAB-------" << "SUGPUUABR------" << "SUGPUUAC-------";
-    codes << "SUGPUUACC------" << "SUGPUUACCK-----" << "SUGPUUACCM-----" << "SUGPUUACR------" << "SUGPUUACRS-----" << "SUGPUUACRW-----" << "SUGPUUACS------" << "SUGPUUACSA-----" << "SUGPUUACSM-----" << "SUGPUUAD-------" << "SUGPUUAN-------";
-    codes << "SUGPUUE--------" << "SUGPUUI--------" << "SUGPUUL--------" << "SUGPUULC-------" << "SUGPUULD-------" << "SUGPUULF-------" << "SUGPUULM-------" << "SUGPUULS-------" << "SUGPUUM--------" << "SUGPUUMA-------" << "SUGPUUMC-------";
-    codes << "SUGPUUMJ-------" << "SUGPUUMMO------" << "SUGPUUMO-------" << "SUGPUUMQ-------" << "SUGPUUMR-------" << "SUGPUUMRG------" << "SUGPUUMRS------" << "SUGPUUMRSS-----" << "SUGPUUMRX------" << "SUGPUUMS-------" << "SUGPUUMSE------";
-    codes << "SUGPUUMSEA-----" << "SUGPUUMSEC-----" << "SUGPUUMSED-----" << "SUGPUUMSEI-----" << "SUGPUUMSEJ-----" << "SUGPUUMSET-----" << "SUGPUUMT-------" << "SUGPUUP--------" << "SUGPUUS--------" << "SUGPUUSA-------" << "SUGPUUSC-------";
-    codes << "SUGPUUSCL------" << "SUGPUUSF-------" << "SUGPUUSM-------" << "SUGPUUSML------" << "SUGPUUSMN------" << "SUGPUUSMS------" << "SUGPUUSO-------" << "SUGPUUSR-------" << "SUGPUUSRS------" << "SUGPUUSRT------" << "SUGPUUSRW------";
-    codes << "SUGPUUSS-------" << "SUGPUUSW-------" << "SUGPUUSX-------" << "SUPP-----------" << "SUPP-----------" << "SUPPL----------" << "SUPPS----------" << "SUPPT----------" << "SUPPV----------" << "SUSP-----------" << "SUSPC----------";
-    codes << "SUSPCA---------" << "SUSPCALA-------" << "SUSPCALC-------" << "SUSPCALS-------" << "SUSPCALSM------" << "SUSPCALST------" << "SUSPCD---------" << "SUSPCH---------" << "SUSPCL---------" << "SUSPCLBB-------" << "SUSPCLCC-------";
-    codes << "SUSPCLCV-------" << "SUSPCLDD-------" << "SUSPCLFF-------" << "SUSPCLLL-------" << "SUSPCLLLAS-----" << "SUSPCLLLMI-----" << "SUSPCLLLSU-----" << "SUSPCM---------" << "SUSPCMMA-------" << "SUSPCMMH-------" << "SUSPCMML-------";
-    codes << "SUSPCMMS-------" << "SUSPCP---------" << "SUSPCPSB-------" << "SUSPCPSU-------" << "SUSPCPSUG------" << "SUSPCPSUM------" << "SUSPCPSUT------" << "SUSPCU---------" << "SUSPCUM--------" << "SUSPCUN--------" << "SUSPCUR--------";
-    codes << "SUSPCUS--------" << "SUSPG----------" << "SUSPGC---------" << "SUSPGG---------" << "SUSPGT---------" << "SUSPGU---------" << "SUSPN----------" << "SUSPNF---------" << "SUSPNH---------" << "SUSPNI---------" << "SUSPNM---------";
-    codes << "SUSPNR---------" << "SUSPNS---------" << "SUSPO----------" << "SUSPXA---------" << "SUSPXAR--------" << "SUSPXAS--------" << "SUSPXF---------" << "SUSPXFDF-------" << "SUSPXFDR-------" << "SUSPXFTR-------" << "SUSPXH---------";
-    codes << "SUSPXL---------" << "SUSPXM---------" << "SUSPXMC--------" << "SUSPXMF--------" << "SUSPXMH--------" << "SUSPXMO--------" << "SUSPXMP--------" << "SUSPXMR--------" << "SUSPXMTO-------" << "SUSPXMTU-------" << "SUSPXP---------";
-    codes << "SUSPXR---------" << "SUUP-----------" << "SUUPE----------" << "SUUPND---------" << "SUUPS----------" << "SUUPS1---------" << "SUUPS2---------" << "SUUPS3---------" << "SUUPS4---------" << "SUUPSB---------" << "SUUPSC---------";
-    codes << "SUUPSCA--------" << "SUUPSCB--------" << "SUUPSCF--------" << "SUUPSCG--------" << "SUUPSCM--------" << "SUUPSF---------" << "SUUPSK---------" << "SUUPSL---------" << "SUUPSN---------" << "SUUPSNA--------" << "SUUPSNB--------";
-    codes << "SUUPSNF--------" << "SUUPSNG--------" << "SUUPSNM--------" << "SUUPSO---------" << "SUUPSOF--------" << "SUUPSR---------" << "SUUPSU---------" << "SUUPSUM--------" << "SUUPSUN--------" << "SUUPSUS--------" << "SUUPSX---------";
-    codes << "SUUPV----------" << "SUUPW----------" << "SUUPWD---------" << "SUUPWDM--------" << "SUUPWDMG-------" << "SUUPWDMM-------" << "SUUPWM---------" << "SUUPWMA--------" << "SUUPWMB--------" << "SUUPWMBD-------" << "SUUPWMC--------";
-    codes << "SUUPWMD--------" << "SUUPWME--------" << "SUUPWMF--------" << "SUUPWMFC-------" << "SUUPWMFD-------" << "SUUPWMFE-------" << "SUUPWMFO-------" << "SUUPWMFR-------" << "SUUPWMFX-------" << "SUUPWMG--------" << "SUUPWMGC-------";
-    codes << "SUUPWMGD-------" << "SUUPWMGE-------" << "SUUPWMGO-------" << "SUUPWMGR-------" << "SUUPWMGX-------" << "SUUPWMM--------" << "SUUPWMMC-------" << "SUUPWMMD-------" << "SUUPWMME-------" << "SUUPWMMO-------" << "SUUPWMMR-------";
-    codes << "SUUPWMMX-------" << "SUUPWMN--------" << "SUUPWMO--------" << "SUUPWMOD-------" << "SUUPWMR--------" << "SUUPWMS--------" << "SUUPWMSD-------" << "SUUPWMSX-------" << "SUUPWMX--------" << "SUUPWT---------" << "SUUPX----------";
-    */
-    return codes;
+    return codes.mid(skip);
 }
@@ -22,26 +22,140 @@ namespace Esri {
         class FeatureCollection;
         class FeatureCollectionLayer;
         class Feature;
+        class ServiceImageTiledLayer;
 
         class DictionaryRenderer;
+        class DictionarySymbolStyle;
+        class UniqueValue;
         class UniqueValueRenderer;
+        class Symbol;
     }
 }
 
+#include <QPoint>
+#include <QPointF>
 #include <QQuickItem>
+#include <QRectF>
+#include <QSet>
 #include <string>
 #include "qstringlist.h"
 
+#include "FeatureFeed.h"
+#include "LineGeneralizer.h"
+#include "LoadPipeline.h"
+#include "RenderTelemetry.h"
+#include "ResidencyLru.h"
+#include "SessionSnapshot.h"
+#include "ShardPlanner.h"
+#include "SharedSymbolCache.h"
+#include "SidcConverter.h"
+#include "SidcPatternSpace.h"
+#include "SidcWorkload.h"
+#include "SymbolCache.h"
+#include "SymbolEngine.h"
+#include "SymbolFilter.h"
+#include "SymbolHitTester.h"
+#include "SymbolSearchIndex.h"
+#include "TilePyramid.h"
+#include "TrackPlayback.h"
+
+class QMouseEvent;
+class QTimer;
+class TileGenerator;
+
 class DisplayMilitarySymbols : public QQuickItem
 {
     Q_OBJECT
 
+    Q_PROPERTY(RenderTelemetry* telemetry READ telemetry CONSTANT)
+    Q_PROPERTY(QStringList shardKeys READ shardKeys NOTIFY shardsChanged)
+    Q_PROPERTY(double searchMs READ searchMs NOTIFY searched)
+    Q_PROPERTY(TrackPlayback* playback READ playback CONSTANT)
+
     public:
         DisplayMilitarySymbols(QQuickItem* parent = nullptr);
         ~DisplayMilitarySymbols();
 
         void componentComplete() override;
-        void GenerateSymbolCodes(int count = 0, int skip = 0);
+        static QStringList GenerateSymbolCodes(const SidcWorkload& workload, int count = 0, int skip = 0);
+
+        // Display count synthetic codes instead of the built-in catalog
+        void setWorkload(const SidcWorkload& workload, int count, int skip = 0);
+
+        // Display count codes sampled evenly from the expanded patterns
+        void setPatternSpace(const SidcPatternSpace& space, int count, int skip = 0);
+
+        // Split the catalog into one pair of tables per shard
+        void setPartition(ShardPlanner::Partition partition);
+
+        // Restore from this snapshot if it matches, instead of rebuilding
+        void setSnapshotPath(const QString& path);
+        Q_INVOKABLE bool saveSnapshot(const QString& path);
+
+        // Adds the 2525C and 2525D entity mappings of a CSV file to those
+        // the 2525D codes of the catalog and feed are converted with
+        bool setSidcTable(const QString& path, QString* errorMessage = nullptr);
+
+        // Catalog from, and both tables to, a columnar feature file
+        void setImportPath(const QString& path);
+        void setExportPath(const QString& path);
+        Q_INVOKABLE bool exportColumns(const QString& path);
+
+        // Keep only the features of the cells of the catalog nearest the
+        // view within bytes, 0 keeps every feature
+        void setMemoryBudget(qint64 bytes);
+        Q_INVOKABLE QVariantMap residencyStats() const;
+
+        // Fingerprint every symbol of both renderers against a baseline
+        Q_INVOKABLE void runRegression(const QString& baselinePath, const QString& reportPath);
+
+        QStringList shardKeys() const;
+        Q_INVOKABLE void setShardVisible(const QString& key, bool visible);
+
+        // Show only the symbols matching a filter such as "hostile & ground"
+        Q_INVOKABLE bool applyFilter(const QString& expression);
+
+        // Best matches of a type-ahead query by code or name, as maps of
+        // sidc and name
+        Q_INVOKABLE QVariantList search(const QString& text, int count = 10);
+        double searchMs() const;
+
+        // Pan to and select a symbol of the catalog
+        Q_INVOKABLE void showSymbol(const QString& sidc);
+
+        // Play back time stamped tracks from a file, or count synthetic
+        // tracks over a day, once the catalog is loaded
+        void setTracksPath(const QString& path);
+        void setSyntheticTracks(int count);
+        TrackPlayback* playback() const;
+
+        // Show count synthetic control measures, lines and areas of the
+        // tactical graphics, generalized to the map scale
+        void setTacticalGraphics(int count);
+
+        // Render the catalog into a pyramid of tiles under root once loaded
+        void setTileGeneration(const QString& root, int minLevel, int maxLevel);
+
+        // Draw the catalog from a tile pyramid, and its features only when
+        // zoomed in beyond the deepest level
+        void setTileCachePath(const QString& root);
+
+        // Allocations per stage, while profiling with --profile-allocations
+        Q_INVOKABLE QString allocationReport() const;
+
+        RenderTelemetry* telemetry() const;
+
+        // Adds, moves and removes symbols from any thread, applied on the
+        // GUI thread once per frame
+        FeatureFeed* feed() const;
+
+    signals:
+        void shardsChanged();
+        void searched();
+        void regressionFinished(int changes);
+        void tilesGenerated(int count);
+        void symbolHovered(const QString& sidc);
+        void symbolSelected(const QString& sidc);
 
     private:
         Esri::ArcGISRuntime::Map*             m_map = nullptr;
@@ -52,20 +166,192 @@ class DisplayMilitarySymbols : public QQuickItem
 
         QStringList* codes = nullptr;
 
-        Esri::ArcGISRuntime::FeatureCollectionTable* m_dTable = nullptr;
-        Esri::ArcGISRuntime::FeatureCollectionTable* m_uTable = nullptr;
+        // Tables and unique values of one shard of the catalog
+        struct Shard {
+            QString key;
+            Esri::ArcGISRuntime::FeatureCollectionTable* dTable = nullptr;
+            Esri::ArcGISRuntime::FeatureCollectionTable* uTable = nullptr;
+            Esri::ArcGISRuntime::UniqueValueRenderer* uRend = nullptr;
+            QList<Esri::ArcGISRuntime::UniqueValue*> values;
+
+            // Codes with a unique value, or one held back in values
+            QSet<QString> codes;
+        };
 
-        Esri::ArcGISRuntime::FeatureCollection* m_dCollection = nullptr;
-        Esri::ArcGISRuntime::FeatureCollection* m_uCollection = nullptr;
+        // Result of the layout stage
+        struct CatalogLayout {
+            QStringList codes;
+            QVector<QPointF> positions;
+            double spacing = 0.0;
+            QList<CatalogShard> shards;
+        };
 
-        Esri::ArcGISRuntime::FeatureCollectionLayer* m_dLayer = nullptr;
-        Esri::ArcGISRuntime::FeatureCollectionLayer* m_uLayer = nullptr;
+        // Result of the snapshot stage, falls back to a rebuild if not ok
+        struct SnapshotRestore {
+            bool ok = false;
+            QString error;
+            CatalogLayout layout;
+            QHash<QString, QString> symbols;
+            SnapshotState state;
+        };
 
+        // Features of one shard handed from the project to the ingest stage
+        struct FeatureBatch {
+            int shard = 0;
+            QVector<int> ordinals;
+            QVector<QPointF> dPoints;
+            QVector<QPointF> uPoints;
+        };
+
+        ShardPlanner::Partition m_partition = ShardPlanner::ByDimension;
+        QList<Shard> m_shards;
+
+        CatalogSymbolEngine::Layers m_layers;
+
+        Esri::ArcGISRuntime::DictionarySymbolStyle* m_style = nullptr;
         Esri::ArcGISRuntime::DictionaryRenderer* m_dRend = nullptr;
-        Esri::ArcGISRuntime::UniqueValueRenderer* m_uRend = nullptr;
+        Esri::ArcGISRuntime::Symbol* m_defaultSymbol = nullptr;
+
+        // Features of each ordinal of the layout, while its cell is resident
+        struct Resident {
+            Esri::ArcGISRuntime::Feature* dFeature = nullptr;
+            Esri::ArcGISRuntime::Feature* uFeature = nullptr;
+            int symbol = -1;
+        };
+
+        QVector<Resident> m_residents;
+        int m_residentCount = 0;
+
+        // Cells of CellSpan by CellSpan grid positions, evicted and
+        // materialized as a whole
+        ResidencyLru m_residency;
+        QHash<int, QVector<int>> m_cells;
+        QVector<int> m_ordinalCells;
+        QVector<int> m_ordinalShards;
+        QPointF m_cellOrigin;
+        double m_cellSize = 0.0;
+        int m_cellColumns = 0;
+        int m_cellRows = 0;
+        QTimer* m_residencyTimer = nullptr;
+
+        RenderTelemetry* m_telemetry = nullptr;
+        LoadPipeline* m_pipeline = nullptr;
+        CatalogLayout m_layout;
+        int m_ingested = 0;
+
+        QString m_stylePath;
+        QString m_snapshotPath;
+        QString m_importPath;
+        QString m_exportPath;
+
+        bool m_loaded = false;
+        QString m_regressionBaseline;
+        QString m_regressionReport;
+
+        // Symbols resolved by any local instance with the same style
+        SharedSymbolCache m_sharedSymbols;
+        SymbolCache m_symbolCache;
+        int m_pendingIngest = 0;
+
+        SidcWorkload m_workload;
+        int m_workloadCount = 0;
+        int m_workloadSkip = 0;
+
+        SidcPatternSpace m_patternSpace;
+        bool m_usePatterns = false;
+
+        // The style only knows 2525C, codes of 2525D are converted first
+        SidcConverter m_converter;
+
+        // Hit testing groups, one per table
+        enum HitGroup { DictionaryGroup = 0, UniqueValueGroup = 1 };
+        SymbolHitTester m_hitTester;
+        SymbolFilter m_filter;
+        QString m_hoveredSidc;
+
+        // Built from the catalog once loaded
+        SymbolSearchIndex m_search;
+        double m_searchMs = 0.0;
+
+        // Symbols of the feed, kept in a shard of their own
+        struct FeedFeature {
+            Esri::ArcGISRuntime::Feature* dFeature = nullptr;
+            Esri::ArcGISRuntime::Feature* uFeature = nullptr;
+            QString sidc;
+            QPointF position;
+            int symbol = -1;
+        };
+
+        FeatureFeed* m_feed = nullptr;
+        QHash<QString, FeedFeature> m_feedFeatures;
+        int m_feedShard = -1;
+
+        TrackPlayback* m_playback = nullptr;
+        QString m_tracksPath;
+        int m_syntheticTracks = 0;
+
+        // Changes that arrived before the catalog was loaded
+        QVector<FeatureUpdate> m_feedBacklog;
+
+        // Line or area of the tactical graphics, with its vertices
+        // simplified for each band of m_graphicBands
+        struct TacticalGraphic {
+            QString sidc;
+            bool area = false;
+            QVector<QVector<QPointF>> levels;
+            Esri::ArcGISRuntime::Feature* feature = nullptr;
+        };
+
+        QVector<TacticalGraphic> m_graphics;
+        Esri::ArcGISRuntime::FeatureCollectionTable* m_lineTable = nullptr;
+        Esri::ArcGISRuntime::FeatureCollectionTable* m_areaTable = nullptr;
+        ScaleBands m_graphicBands = ScaleBands(1000.0, 100000000.0, 16);
+        int m_graphicBand = -1;
+        int m_graphicCount = 0;
+
+        // Tile pyramid rendered from, or drawn instead of, the catalog
+        QString m_tileRoot;
+        int m_tileMinLevel = 0;
+        int m_tileMaxLevel = 0;
+        TileGenerator* m_tileGenerator = nullptr;
+        QString m_tileCachePath;
+        TilePyramid m_tilePyramid;
+        Esri::ArcGISRuntime::ServiceImageTiledLayer* m_tileLayer = nullptr;
+
+        SymbolHitTester::Hit hitTest(const QMouseEvent& mouseEvent);
+        void selectFeature(Esri::ArcGISRuntime::Feature* feature);
 
-        QList<Esri::ArcGISRuntime::Feature*> m_dFeatures;
-        QList<Esri::ArcGISRuntime::Feature*> m_uFeatures;
+        void startLoad();
+        void loadCatalog();
+        void restoreSnapshot(const SnapshotRestore& restore);
+        static SnapshotRestore readColumns(const QString& path, ShardPlanner::Partition partition);
+        static CatalogLayout layoutCatalog(const QStringList& catalog, const QRectF& extent, ShardPlanner::Partition partition);
+        void startIngest(const CatalogLayout& layout);
+        void createShard(const CatalogShard& plan);
+        void ingestBatch(const FeatureBatch& batch);
+        void materialize(int shardIndex, int ordinal, const QPointF& dPosition, const QPointF& uPosition);
+        void materializeCell(int cell);
+        void evictCell(int cell);
+        void updateResidency();
+        void flushUniqueValues();
+        QPoint cellAt(const QPointF& position) const;
+        static int cellKey(const QPoint& cell);
+        void symbolize(Shard& shard, const QString& code, Esri::ArcGISRuntime::Feature* dFeature);
+        void applyRenderers();
+        void buildSearchIndex();
+        void loadTracks();
+        void loadGraphics();
+        void createGraphics(const QVector<TacticalGraphic>& graphics);
+        void generalizeGraphics();
+        static QVector<TacticalGraphic> generateGraphics(int count, const QRectF& extent, const ScaleBands& bands);
+        QRectF catalogExtent() const;
+        quint64 catalogFingerprint() const;
+        QByteArray workloadKey() const;
+        void addTileLayer();
+        void startTileGeneration();
+        void applyFeedUpdates(const QVector<FeatureUpdate>& updates);
+        void placeFeedFeature(FeedFeature& feedFeature, const QString& sidc, const QPointF& position);
+        void startRegression();
 
 
 };
@@ -29,14 +29,19 @@ equals(QT_MAJOR_VERSION, 5) {
 
 ARCGIS_RUNTIME_VERSION = 100.2.1
 include($$PWD/arcgisruntime.pri)
+include($$PWD/../Common/Common.pri)
 
 HEADERS += \
     AppInfo.h \
-    DisplayMilitarySymbols.h
+    DisplayMilitarySymbols.h \
+    SymbolRegression.h \
+    TileGenerator.h
 
 SOURCES += \
     main.cpp \
-    DisplayMilitarySymbols.cpp
+    DisplayMilitarySymbols.cpp \
+    SymbolRegression.cpp \
+    TileGenerator.cpp
 
 RESOURCES += \
     qml/qml.qrc \
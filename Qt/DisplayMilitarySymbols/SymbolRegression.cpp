@@ -0,0 +1,287 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "Symbol.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFutureWatcher>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QThread>
+#include <QTimer>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+#include "SymbolRegression.h"
+
+using namespace Esri::ArcGISRuntime;
+
+namespace {
+    // Swatch size and pixel density, large enough for the frame details
+    const float SwatchSize = 64.0f;
+    const float SwatchScale = 1.0f;
+
+    // A swatch not rendered by then is recorded as failed
+    const int SwatchTimeoutMs = 10000;
+
+    // Swatches requested from the runtime at a time
+    int maxInFlight() {
+        return qMax(2, QThread::idealThreadCount() * 2);
+    }
+}
+
+SymbolRegression::SymbolRegression(QObject* parent /* = nullptr */):
+    QObject(parent)
+{
+}
+
+SymbolRegression::~SymbolRegression()
+{
+    m_pool.waitForDone();
+}
+
+void SymbolRegression::addSymbol(const QString& sidc, const QString& renderer, Symbol* symbol) {
+    symbol->setParent(this);
+
+    Job job;
+    job.sidc = sidc;
+    job.renderer = renderer;
+    job.symbol = symbol;
+    m_pending.enqueue(job);
+}
+
+void SymbolRegression::setImageThreshold(int bits) {
+    m_threshold = bits;
+}
+
+void SymbolRegression::start(const QString& baselinePath, const QString& reportPath) {
+    m_baselinePath = baselinePath;
+    m_reportPath = reportPath;
+
+    qDebug() << "Fingerprinting " << m_pending.size() << " symbols";
+    launchSwatches();
+}
+
+void SymbolRegression::launchSwatches() {
+    while (m_inFlight < maxInFlight() && !m_pending.isEmpty()) {
+        const Job job = m_pending.dequeue();
+        m_inFlight++;
+        m_rendering.insert(job.symbol);
+
+        connect(job.symbol, &Symbol::createSwatchCompleted, this, [this, job](QUuid, QImage image) {
+            swatchCompleted(job, image);
+        });
+
+        // Either of these may be the only answer, a null image marks the
+        // swatch as failed
+        connect(job.symbol, &Symbol::errorOccurred, this, [this, job](Error error) {
+            qDebug() << "Swatch of " << job.sidc << " failed: " << error.message();
+            swatchCompleted(job, QImage());
+        });
+        QTimer::singleShot(SwatchTimeoutMs, job.symbol, [this, job]() {
+            qDebug() << "Swatch of " << job.sidc << " timed out";
+            swatchCompleted(job, QImage());
+        });
+
+        job.symbol->createSwatch(QColor(Qt::white), SwatchSize, SwatchSize, SwatchScale);
+    }
+
+    if (m_inFlight == 0 && m_hashing == 0 && m_pending.isEmpty())
+        finish();
+}
+
+void SymbolRegression::swatchCompleted(const Job& job, const QImage& image) {
+    // Only the first of completion, error and timeout counts
+    if (!m_rendering.remove(job.symbol))
+        return;
+
+    m_inFlight--;
+    m_hashing++;
+
+    // The JSON is read here, the hashing of both runs on the pool
+    const QByteArray json = job.symbol->toJson().toUtf8();
+    job.symbol->deleteLater();
+
+    Fingerprint fingerprint;
+    fingerprint.sidc = job.sidc;
+    fingerprint.renderer = job.renderer;
+    fingerprint.failed = image.isNull();
+
+    QFutureWatcher<Fingerprint>* watcher = new QFutureWatcher<Fingerprint>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        m_fingerprints.append(watcher->result());
+        m_hashing--;
+        launchSwatches();
+    });
+
+    watcher->setFuture(QtConcurrent::run(&m_pool, [fingerprint, json, image]() {
+        Fingerprint result = fingerprint;
+        result.jsonHash = QCryptographicHash::hash(json, QCryptographicHash::Sha1).toHex();
+        if (!result.failed)
+            result.imageHash = perceptualHash(image);
+        return result;
+    }));
+
+    launchSwatches();
+}
+
+void SymbolRegression::finish() {
+    std::sort(m_fingerprints.begin(), m_fingerprints.end(), [](const Fingerprint& a, const Fingerprint& b) {
+        return key(a.sidc, a.renderer) < key(b.sidc, b.renderer);
+    });
+
+    // Never part of a baseline, always reported
+    QList<Fingerprint> rendered;
+    QStringList changes;
+    for (const Fingerprint& current : m_fingerprints) {
+        if (current.failed)
+            changes << QString("%1\t%2\tfailed").arg(current.sidc, current.renderer);
+        else
+            rendered.append(current);
+    }
+
+    QHash<QString, Fingerprint> baseline;
+    if (!readBaseline(m_baselinePath, &baseline)) {
+        // First run, record the baseline
+        if (!writeBaseline(m_baselinePath, rendered))
+            qDebug() << "Baseline not written: " << m_baselinePath;
+        else
+            qDebug() << "Baseline of " << rendered.size() << " symbols written to " << m_baselinePath << ", " << changes.size() << " failed";
+
+        emit finished(changes.size());
+        return;
+    }
+
+    for (const Fingerprint& current : m_fingerprints) {
+        const QString currentKey = key(current.sidc, current.renderer);
+        auto it = baseline.constFind(currentKey);
+        if (current.failed) {
+            if (it != baseline.constEnd())
+                baseline.erase(it);
+            continue;
+        }
+
+        if (it == baseline.constEnd()) {
+            changes << QString("%1\t%2\tadded").arg(current.sidc, current.renderer);
+            continue;
+        }
+
+        const int distance = hammingDistance(current.imageHash, it.value().imageHash);
+        if (distance > m_threshold)
+            changes << QString("%1\t%2\timage\t%3 bits").arg(current.sidc, current.renderer).arg(distance);
+        else if (current.jsonHash != it.value().jsonHash)
+            changes << QString("%1\t%2\tjson").arg(current.sidc, current.renderer);
+
+        baseline.erase(it);
+    }
+
+    for (const Fingerprint& missing : baseline)
+        changes << QString("%1\t%2\tremoved").arg(missing.sidc, missing.renderer);
+
+    QSaveFile file(m_reportPath);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QTextStream stream(&file);
+        stream << "# " << m_fingerprints.size() << " symbols, " << changes.size() << " changed\n";
+        for (const QString& change : changes)
+            stream << change << "\n";
+        stream.flush();
+        file.commit();
+    }
+
+    qDebug() << changes.size() << " of " << m_fingerprints.size() << " symbols changed, see " << m_reportPath;
+    emit finished(changes.size());
+}
+
+quint64 SymbolRegression::perceptualHash(const QImage& image) {
+    if (image.isNull())
+        return 0;
+
+    // Grayscale 9x8, each bit tells whether a pixel is brighter than its
+    // right neighbour
+    const QImage small = image.convertToFormat(QImage::Format_ARGB32)
+                              .scaled(9, 8, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    quint64 hash = 0;
+    int bit = 0;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            if (qGray(small.pixel(x, y)) > qGray(small.pixel(x + 1, y)))
+                hash |= quint64(1) << bit;
+            bit++;
+        }
+    }
+
+    return hash;
+}
+
+int SymbolRegression::hammingDistance(quint64 a, quint64 b) {
+    quint64 bits = a ^ b;
+
+    int count = 0;
+    while (bits) {
+        bits &= bits - 1;
+        count++;
+    }
+
+    return count;
+}
+
+QString SymbolRegression::key(const QString& sidc, const QString& renderer) {
+    return sidc + '/' + renderer;
+}
+
+bool SymbolRegression::readBaseline(const QString& path, QHash<QString, Fingerprint>* fingerprints) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return false;
+
+    QTextStream stream(&file);
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine();
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        const QStringList fields = line.split('\t');
+        if (fields.size() != 4)
+            continue;
+
+        Fingerprint fingerprint;
+        fingerprint.sidc = fields.at(0);
+        fingerprint.renderer = fields.at(1);
+        fingerprint.jsonHash = fields.at(2).toLatin1();
+        fingerprint.imageHash = fields.at(3).toULongLong(nullptr, 16);
+        fingerprints->insert(key(fingerprint.sidc, fingerprint.renderer), fingerprint);
+    }
+
+    return true;
+}
+
+bool SymbolRegression::writeBaseline(const QString& path, const QList<Fingerprint>& fingerprints) {
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return false;
+
+    QTextStream stream(&file);
+    stream << "# sidc\trenderer\tjson sha1\timage dhash\n";
+    for (const Fingerprint& fingerprint : fingerprints) {
+        stream << fingerprint.sidc << '\t' << fingerprint.renderer << '\t'
+               << fingerprint.jsonHash << '\t' << QString::number(fingerprint.imageHash, 16) << '\n';
+    }
+    stream.flush();
+
+    return file.commit();
+}
@@ -0,0 +1,96 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef SYMBOLREGRESSION_H
+#define SYMBOLREGRESSION_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class Symbol;
+    }
+}
+
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QObject>
+#include <QQueue>
+#include <QSet>
+#include <QThreadPool>
+
+// Renders a swatch of every symbol, fingerprints it by the hash of its
+// JSON and a perceptual hash of its image, and compares the fingerprints
+// with a baseline. The runtime renders the swatches concurrently, the
+// hashes are computed on a pool of worker threads. A swatch that fails or
+// times out is reported as failed and counts as a change.
+class SymbolRegression : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Fingerprint {
+        QString sidc;
+        QString renderer;
+        QByteArray jsonHash;
+        quint64 imageHash = 0;
+        bool failed = false;
+    };
+
+    explicit SymbolRegression(QObject* parent = nullptr);
+    ~SymbolRegression();
+
+    // Takes ownership of the symbol
+    void addSymbol(const QString& sidc, const QString& renderer, Esri::ArcGISRuntime::Symbol* symbol);
+
+    // Differences in more bits than this count as a changed image
+    void setImageThreshold(int bits);
+
+    // Records the baseline if it does not exist yet, otherwise compares
+    // against it and writes the changed codes to reportPath
+    void start(const QString& baselinePath, const QString& reportPath);
+
+    // 64 bit difference hash of an image, robust to scaling and antialiasing
+    static quint64 perceptualHash(const QImage& image);
+    static int hammingDistance(quint64 a, quint64 b);
+
+signals:
+    void finished(int changes);
+
+private:
+    struct Job {
+        QString sidc;
+        QString renderer;
+        Esri::ArcGISRuntime::Symbol* symbol = nullptr;
+    };
+
+    void launchSwatches();
+    void swatchCompleted(const Job& job, const QImage& image);
+    void finish();
+
+    static QString key(const QString& sidc, const QString& renderer);
+    static bool readBaseline(const QString& path, QHash<QString, Fingerprint>* fingerprints);
+    static bool writeBaseline(const QString& path, const QList<Fingerprint>& fingerprints);
+
+    QQueue<Job> m_pending;
+    QSet<Esri::ArcGISRuntime::Symbol*> m_rendering;
+    int m_inFlight = 0;
+    int m_hashing = 0;
+    int m_threshold = 6;
+
+    QThreadPool m_pool;
+    QList<Fingerprint> m_fingerprints;
+
+    QString m_baselinePath;
+    QString m_reportPath;
+};
+
+#endif // SYMBOLREGRESSION_H
@@ -0,0 +1,190 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include "MapQuickView.h"
+#include "Layer.h"
+#include "Point.h"
+#include "SpatialReference.h"
+#include "TaskWatcher.h"
+#include "Viewpoint.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+
+#include "TileGenerator.h"
+
+using namespace Esri::ArcGISRuntime;
+
+namespace {
+    // Export anyway if a block has not finished drawing after this long
+    const int SettleTimeout = 10000;
+}
+
+TileGenerator::TileGenerator(MapQuickView* mapView, QObject* parent /* = nullptr */):
+    QObject(parent),
+    m_mapView(mapView)
+{
+    m_settleTimer.setSingleShot(true);
+    m_settleTimer.setInterval(SettleTimeout);
+    connect(&m_settleTimer, &QTimer::timeout, this, &TileGenerator::exportBlock);
+
+    connect(m_mapView, &MapQuickView::drawStatusChanged, this, [this](DrawStatus status) {
+        if (status == DrawStatus::Completed && m_settleTimer.isActive()) {
+            m_settleTimer.stop();
+            exportBlock();
+        }
+    });
+
+    connect(m_mapView, &MapQuickView::exportImageCompleted, this, [this](QUuid taskId, QImage image) {
+        if (taskId == m_exportTask)
+            writeBlock(image);
+    });
+}
+
+TileGenerator::~TileGenerator()
+{
+}
+
+void TileGenerator::setHiddenLayers(const QList<Layer*>& layers) {
+    m_hiddenLayers = layers;
+}
+
+void TileGenerator::start(const TilePyramid& pyramid, const QString& root) {
+    if (m_running)
+        return;
+
+    m_pyramid = pyramid;
+    m_root = root;
+    m_blocks.clear();
+    m_total = 0;
+    m_written = 0;
+
+    QString error;
+    if (!m_pyramid.save(m_root, &error)) {
+        emit failed(error);
+        return;
+    }
+
+    // As many whole tiles as the view holds
+    const int columns = qMax(1, static_cast<int>(m_mapView->width()) / TilePyramid::TileSize);
+    const int rows = qMax(1, static_cast<int>(m_mapView->height()) / TilePyramid::TileSize);
+
+    for (int level = m_pyramid.minLevel(); level <= m_pyramid.maxLevel(); level++) {
+        const QVector<PyramidTile> tiles = m_pyramid.tiles(level);
+        if (tiles.isEmpty())
+            continue;
+
+        // The tiles of a level are a rectangle of the grid, rows first
+        const PyramidTile first = tiles.first();
+        const PyramidTile last = tiles.last();
+        for (int row = first.row; row <= last.row; row += rows) {
+            for (int column = first.column; column <= last.column; column += columns) {
+                Block block;
+                block.level = level;
+                block.column = column;
+                block.row = row;
+                block.columns = qMin(columns, last.column - column + 1);
+                block.rows = qMin(rows, last.row - row + 1);
+                m_blocks.append(block);
+            }
+        }
+
+        m_total += tiles.size();
+    }
+
+    m_hiddenVisible.clear();
+    for (Layer* layer : m_hiddenLayers) {
+        m_hiddenVisible.append(layer->isVisible());
+        layer->setVisible(false);
+    }
+
+    qDebug() << "Tile pyramid: " << m_total << " tiles in " << m_blocks.size() << " views";
+    m_running = true;
+    nextBlock();
+}
+
+void TileGenerator::nextBlock() {
+    if (m_blocks.isEmpty()) {
+        finish();
+        return;
+    }
+
+    m_current = m_blocks.takeFirst();
+
+    // Center the view on the block at the scale of its level
+    PyramidTile topLeft;
+    topLeft.level = m_current.level;
+    topLeft.column = m_current.column;
+    topLeft.row = m_current.row;
+
+    const double span = TilePyramid::TileSize * TilePyramid::resolution(m_current.level);
+    const QRectF bounds = TilePyramid::tileBounds(topLeft);
+    const double x = bounds.left() + (span * m_current.columns / 2.0);
+    const double y = bounds.bottom() - (span * m_current.rows / 2.0);
+
+    m_mapView->setViewpoint(Viewpoint(Point(x, y, SpatialReference::webMercator()), TilePyramid::scale(m_current.level)));
+
+    // Export once the block has finished drawing
+    m_settleTimer.start();
+}
+
+void TileGenerator::exportBlock() {
+    m_exportTask = m_mapView->exportImage().taskId();
+}
+
+void TileGenerator::writeBlock(const QImage& image) {
+    m_exportTask = QUuid();
+
+    // The image is in device pixels, the view and tiles in device
+    // independent pixels
+    const double ratio = image.width() / qMax(1.0, m_mapView->width());
+    const double size = TilePyramid::TileSize * ratio;
+    const double left = (image.width() - (size * m_current.columns)) / 2.0;
+    const double top = (image.height() - (size * m_current.rows)) / 2.0;
+
+    for (int row = 0; row < m_current.rows; row++) {
+        for (int column = 0; column < m_current.columns; column++) {
+            PyramidTile tile;
+            tile.level = m_current.level;
+            tile.column = m_current.column + column;
+            tile.row = m_current.row + row;
+
+            const QRect source(qRound(left + (column * size)), qRound(top + (row * size)), qRound(size), qRound(size));
+            QImage tileImage = image.copy(source);
+            if (tileImage.width() != TilePyramid::TileSize)
+                tileImage = tileImage.scaled(TilePyramid::TileSize, TilePyramid::TileSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+            const QString path = TilePyramid::tilePath(m_root, tile);
+            if (!QDir().mkpath(QFileInfo(path).path()) || !tileImage.save(path, "PNG")) {
+                qDebug() << "Tile not written: " << path;
+                continue;
+            }
+
+            m_written++;
+        }
+    }
+
+    emit progress(m_written, m_total);
+
+    // Let the current frame finish before moving the view
+    QTimer::singleShot(0, this, &TileGenerator::nextBlock);
+}
+
+void TileGenerator::finish() {
+    for (int i = 0; i < m_hiddenLayers.size(); i++)
+        m_hiddenLayers.at(i)->setVisible(m_hiddenVisible.at(i));
+
+    m_running = false;
+    qDebug() << "Tile pyramid: " << m_written << " of " << m_total << " tiles written to " << m_root;
+    emit finished(m_root, m_written);
+}
@@ -0,0 +1,85 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#ifndef TILEGENERATOR_H
+#define TILEGENERATOR_H
+
+namespace Esri {
+    namespace ArcGISRuntime {
+        class MapQuickView;
+        class Layer;
+    }
+}
+
+#include <QImage>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+#include <QUuid>
+#include <QVector>
+
+#include "TilePyramid.h"
+
+// Renders the layers of a map view into a tile pyramid on disk. The view
+// is moved over the pyramid block by block, each block as many tiles as
+// fit in the view, and every tile of a block is cut from one exported
+// image once the block has drawn.
+class TileGenerator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TileGenerator(Esri::ArcGISRuntime::MapQuickView* mapView, QObject* parent = nullptr);
+    ~TileGenerator();
+
+    // Hidden while rendering, such as the basemap
+    void setHiddenLayers(const QList<Esri::ArcGISRuntime::Layer*>& layers);
+
+    void start(const TilePyramid& pyramid, const QString& root);
+
+signals:
+    void progress(int written, int total);
+    void finished(const QString& root, int written);
+    void failed(const QString& error);
+
+private:
+    // Tiles of a level rendered from one view
+    struct Block {
+        int level = 0;
+        int column = 0;
+        int row = 0;
+        int columns = 1;
+        int rows = 1;
+    };
+
+    void nextBlock();
+    void exportBlock();
+    void writeBlock(const QImage& image);
+    void finish();
+
+    Esri::ArcGISRuntime::MapQuickView* m_mapView = nullptr;
+    QList<Esri::ArcGISRuntime::Layer*> m_hiddenLayers;
+    QList<bool> m_hiddenVisible;
+
+    TilePyramid m_pyramid;
+    QString m_root;
+    QVector<Block> m_blocks;
+    Block m_current;
+    int m_total = 0;
+    int m_written = 0;
+
+    QTimer m_settleTimer;
+    QUuid m_exportTask;
+    bool m_running = false;
+};
+
+#endif // TILEGENERATOR_H
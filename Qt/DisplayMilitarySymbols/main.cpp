@@ -15,6 +15,7 @@
 #include <QGuiApplication>
 #include <QQuickView>
 #include <QCommandLineParser>
+#include <QDebug>
 #include <QDir>
 #include <QMessageBox>
 #include <QQmlEngine>
@@ -27,8 +28,10 @@
 
 #include "MapQuickView.h"
 
+#include "AllocationProfiler.h"
 #include "AppInfo.h"
 #include "DisplayMilitarySymbols.h"
+#include "RenderTelemetry.h"
 
 //------------------------------------------------------------------------------
 
@@ -41,6 +44,96 @@
 #define kArgShowDescription             "Show option maximized | minimized | fullscreen | normal | default"
 #define kArgShowDefault                 "show"
 
+#define kArgCountName                   "count"
+#define kArgCountValueName              "codes"
+#define kArgCountDescription            "Display a synthetic workload of this many symbol codes instead of the catalog"
+
+#define kArgSkipName                    "skip"
+#define kArgSkipValueName               "codes"
+#define kArgSkipDescription             "Skip this many codes of the workload or catalog"
+#define kArgSkipDefault                 "0"
+
+#define kArgSeedName                    "seed"
+#define kArgSeedValueName               "seed"
+#define kArgSeedDescription             "Seed of the synthetic workload"
+#define kArgSeedDefault                 "0"
+
+#define kArgDistributionName            "distribution"
+#define kArgDistributionValueName       "spec"
+#define kArgDistributionDescription     "Weights of the synthetic workload, e.g. affiliation=F:4,H:4;dimension=G:6,A:2;status=P:9,A:1;echelon=-:2,D:1"
+#define kArgDistributionDefault         "catalog"
+
+#define kArgPatternsName                "patterns"
+#define kArgPatternsValueName           "sidcFile"
+#define kArgPatternsDescription         "Sample --count codes (one per pattern by default) from the wildcard patterns of a SIDC.json file"
+
+#define kArgModifiersName               "modifiers"
+#define kArgModifiersValueName          "spec"
+#define kArgModifiersDescription        "Values of the wildcard modifiers of --patterns, e.g. modifier=-,A;echelon=D,E;country=--,US;order=-"
+
+#define kArgShardName                   "shard"
+#define kArgShardValueName              "partition"
+#define kArgShardDescription            "Split the catalog into tables by dimension | page | none"
+#define kArgShardDefault                "dimension"
+
+#define kArgMemoryBudgetName            "memory-budget"
+#define kArgMemoryBudgetValueName       "megabytes"
+#define kArgMemoryBudgetDescription     "Keep only the features nearest the view within this many megabytes, evicting the least recently seen"
+
+#define kArgProfileAllocationsName      "profile-allocations"
+#define kArgProfileAllocationsValueName "reportFile"
+#define kArgProfileAllocationsDescription "Count the allocations of every load stage and write them to reportFile on exit"
+
+#define kArgTracksName                  "tracks"
+#define kArgTracksValueName             "csvFile"
+#define kArgTracksDescription           "Play back time stamped tracks, lines of id,sidc,start,end,x,y"
+
+#define kArgSyntheticTracksName         "synthetic-tracks"
+#define kArgSyntheticTracksValueName    "count"
+#define kArgSyntheticTracksDescription  "Play back count synthetic tracks over a day, with codes from the workload options"
+
+#define kArgGraphicsName                "graphics"
+#define kArgGraphicsValueName           "count"
+#define kArgGraphicsDescription         "Show count synthetic tactical graphics, lines and areas generalized to the map scale"
+
+#define kArgGenerateTilesName           "generate-tiles"
+#define kArgGenerateTilesValueName      "folder"
+#define kArgGenerateTilesDescription    "Render the catalog into a tile pyramid in folder once loaded and exit"
+
+#define kArgTileLevelsName              "tile-levels"
+#define kArgTileLevelsValueName         "min-max"
+#define kArgTileLevelsDescription       "Levels of the generated tile pyramid"
+#define kArgTileLevelsDefault           "10-16"
+
+#define kArgTilesName                   "tiles"
+#define kArgTilesValueName              "folder"
+#define kArgTilesDescription            "Draw the catalog from the tile pyramid in folder, and its features only beyond the deepest level"
+
+#define kArgSnapshotName                "snapshot"
+#define kArgSnapshotValueName           "snapshotFile"
+#define kArgSnapshotDescription         "Restore the session from this snapshot if it matches, and save it on exit"
+
+#define kArgSidcTableName               "sidc-table"
+#define kArgSidcTableValueName          "csvFile"
+#define kArgSidcTableDescription        "Add the 2525C,2525D entity mappings of csvFile to those 2525D codes are converted with"
+
+#define kArgImportName                  "import"
+#define kArgImportValueName             "columnFile"
+#define kArgImportDescription           "Display the features of a columnar feature file instead of the catalog"
+
+#define kArgExportName                  "export"
+#define kArgExportValueName             "columnFile"
+#define kArgExportDescription           "Write both tables to a columnar feature file once loaded"
+
+#define kArgVerifyName                  "verify"
+#define kArgVerifyValueName             "baselineFile"
+#define kArgVerifyDescription           "Fingerprint every symbol against baselineFile, recording it if missing, and exit"
+
+#define kArgVerifyReportName            "verify-report"
+#define kArgVerifyReportValueName       "reportFile"
+#define kArgVerifyReportDescription     "Changed symbols found by --verify"
+#define kArgVerifyReportDefault         "symbol_regression.txt"
+
 #define kShowMaximized                  "maximized"
 #define kShowMinimized                  "minimized"
 #define kShowFullScreen                 "fullscreen"
@@ -96,6 +189,10 @@ int main(int argc, char *argv[])
     // Register the DisplayMilitarySymbols (QQuickItem) for QML
     qmlRegisterType<DisplayMilitarySymbols>("Esri.DisplayMilitarySymbols", 1, 0, "DisplayMilitarySymbols");
 
+    // Register the telemetry exposed by the item for the overlay
+    qmlRegisterUncreatableType<RenderTelemetry>("Esri.DisplayMilitarySymbols", 1, 0, "RenderTelemetry", "RenderTelemetry is provided by the app item");
+    qmlRegisterUncreatableType<TrackPlayback>("Esri.DisplayMilitarySymbols", 1, 0, "TrackPlayback", "TrackPlayback is provided by the app item");
+
     // Intialize application view
     QQuickView view;
     view.setResizeMode(QQuickView::SizeRootObjectToView);
@@ -124,15 +221,190 @@ int main(int argc, char *argv[])
 #if !defined(Q_OS_IOS) && !defined(Q_OS_ANDROID)
     // Process command line
     QCommandLineOption showOption(kArgShowName, kArgShowDescription, kArgShowValueName, kArgShowDefault);
+    QCommandLineOption countOption(kArgCountName, kArgCountDescription, kArgCountValueName);
+    QCommandLineOption skipOption(kArgSkipName, kArgSkipDescription, kArgSkipValueName, kArgSkipDefault);
+    QCommandLineOption seedOption(kArgSeedName, kArgSeedDescription, kArgSeedValueName, kArgSeedDefault);
+    QCommandLineOption distributionOption(kArgDistributionName, kArgDistributionDescription, kArgDistributionValueName, kArgDistributionDefault);
+    QCommandLineOption patternsOption(kArgPatternsName, kArgPatternsDescription, kArgPatternsValueName);
+    QCommandLineOption modifiersOption(kArgModifiersName, kArgModifiersDescription, kArgModifiersValueName);
+    QCommandLineOption shardOption(kArgShardName, kArgShardDescription, kArgShardValueName, kArgShardDefault);
+    QCommandLineOption memoryBudgetOption(kArgMemoryBudgetName, kArgMemoryBudgetDescription, kArgMemoryBudgetValueName);
+    QCommandLineOption profileAllocationsOption(kArgProfileAllocationsName, kArgProfileAllocationsDescription, kArgProfileAllocationsValueName);
+    QCommandLineOption tracksOption(kArgTracksName, kArgTracksDescription, kArgTracksValueName);
+    QCommandLineOption syntheticTracksOption(kArgSyntheticTracksName, kArgSyntheticTracksDescription, kArgSyntheticTracksValueName);
+    QCommandLineOption graphicsOption(kArgGraphicsName, kArgGraphicsDescription, kArgGraphicsValueName);
+    QCommandLineOption generateTilesOption(kArgGenerateTilesName, kArgGenerateTilesDescription, kArgGenerateTilesValueName);
+    QCommandLineOption tileLevelsOption(kArgTileLevelsName, kArgTileLevelsDescription, kArgTileLevelsValueName, kArgTileLevelsDefault);
+    QCommandLineOption tilesOption(kArgTilesName, kArgTilesDescription, kArgTilesValueName);
+    QCommandLineOption snapshotOption(kArgSnapshotName, kArgSnapshotDescription, kArgSnapshotValueName);
+    QCommandLineOption sidcTableOption(kArgSidcTableName, kArgSidcTableDescription, kArgSidcTableValueName);
+    QCommandLineOption importOption(kArgImportName, kArgImportDescription, kArgImportValueName);
+    QCommandLineOption exportOption(kArgExportName, kArgExportDescription, kArgExportValueName);
+    QCommandLineOption verifyOption(kArgVerifyName, kArgVerifyDescription, kArgVerifyValueName);
+    QCommandLineOption verifyReportOption(kArgVerifyReportName, kArgVerifyReportDescription, kArgVerifyReportValueName, kArgVerifyReportDefault);
 
     QCommandLineParser commandLineParser;
 
     commandLineParser.setApplicationDescription(kApplicationDescription);
     commandLineParser.addOption(showOption);
+    commandLineParser.addOption(countOption);
+    commandLineParser.addOption(skipOption);
+    commandLineParser.addOption(seedOption);
+    commandLineParser.addOption(distributionOption);
+    commandLineParser.addOption(patternsOption);
+    commandLineParser.addOption(modifiersOption);
+    commandLineParser.addOption(shardOption);
+    commandLineParser.addOption(memoryBudgetOption);
+    commandLineParser.addOption(profileAllocationsOption);
+    commandLineParser.addOption(tracksOption);
+    commandLineParser.addOption(syntheticTracksOption);
+    commandLineParser.addOption(graphicsOption);
+    commandLineParser.addOption(generateTilesOption);
+    commandLineParser.addOption(tileLevelsOption);
+    commandLineParser.addOption(tilesOption);
+    commandLineParser.addOption(snapshotOption);
+    commandLineParser.addOption(sidcTableOption);
+    commandLineParser.addOption(importOption);
+    commandLineParser.addOption(exportOption);
+    commandLineParser.addOption(verifyOption);
+    commandLineParser.addOption(verifyReportOption);
     commandLineParser.addHelpOption();
     commandLineParser.addVersionOption();
     commandLineParser.process(app);
 
+    // Before the style loads, so every stage of the catalog is counted
+    if (commandLineParser.isSet(profileAllocationsOption))
+    {
+        AllocationProfiler::setEnabled(true);
+
+        const QString reportPath = commandLineParser.value(profileAllocationsOption);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [reportPath]()
+        {
+            qDebug().noquote() << AllocationProfiler::report();
+
+            QString reportError;
+            if (!AllocationProfiler::writeReport(reportPath, &reportError))
+                qCritical("%s", qPrintable(reportError));
+        });
+    }
+
+    // The catalog is only built once the style has loaded, so the workload
+    // can still be set on the item here
+    DisplayMilitarySymbols* item = qobject_cast<DisplayMilitarySymbols*>(view.rootObject());
+    if (item && (commandLineParser.isSet(countOption) || commandLineParser.isSet(skipOption)))
+    {
+        SidcWorkload workload(commandLineParser.value(seedOption).toUInt());
+
+        QString distributionError;
+        if (!workload.setDistribution(commandLineParser.value(distributionOption), &distributionError))
+        {
+            qCritical("%s", qPrintable(distributionError));
+            return 1;
+        }
+
+        item->setWorkload(workload, commandLineParser.value(countOption).toInt(), commandLineParser.value(skipOption).toInt());
+    }
+
+    // The expansion of the patterns is never built, only sampled
+    if (item && commandLineParser.isSet(patternsOption))
+    {
+        SidcPatternSpace space;
+
+        QString patternsError;
+        if (!space.load(commandLineParser.value(patternsOption), &patternsError) ||
+            !space.setFilter(commandLineParser.value(modifiersOption), &patternsError))
+        {
+            qCritical("%s", qPrintable(patternsError));
+            return 1;
+        }
+
+        item->setPatternSpace(space, commandLineParser.value(countOption).toInt(), commandLineParser.value(skipOption).toInt());
+    }
+
+    ShardPlanner::Partition partition;
+    if (!ShardPlanner::partitionFromName(commandLineParser.value(shardOption), &partition))
+    {
+        qCritical("Unknown shard partition: %s", qPrintable(commandLineParser.value(shardOption)));
+        return 1;
+    }
+
+    if (item)
+        item->setPartition(partition);
+
+    if (item && commandLineParser.isSet(memoryBudgetOption))
+        item->setMemoryBudget(commandLineParser.value(memoryBudgetOption).toLongLong() * 1024 * 1024);
+
+    if (item && commandLineParser.isSet(tracksOption))
+        item->setTracksPath(commandLineParser.value(tracksOption));
+
+    if (item && commandLineParser.isSet(syntheticTracksOption))
+        item->setSyntheticTracks(commandLineParser.value(syntheticTracksOption).toInt());
+
+    if (item && commandLineParser.isSet(graphicsOption))
+        item->setTacticalGraphics(commandLineParser.value(graphicsOption).toInt());
+
+    if (item && commandLineParser.isSet(tilesOption))
+        item->setTileCachePath(commandLineParser.value(tilesOption));
+
+    // Render the tiles once the catalog is loaded, then quit
+    if (item && commandLineParser.isSet(generateTilesOption))
+    {
+        const QStringList levels = commandLineParser.value(tileLevelsOption).split('-');
+        bool minOk = false;
+        bool maxOk = false;
+        const int minLevel = levels.value(0).toInt(&minOk);
+        const int maxLevel = levels.value(1).toInt(&maxOk);
+        if (levels.size() != 2 || !minOk || !maxOk || minLevel < 0 || maxLevel > TilePyramid::MaxLevel || minLevel > maxLevel)
+        {
+            qCritical("Invalid tile levels: %s", qPrintable(commandLineParser.value(tileLevelsOption)));
+            return 1;
+        }
+
+        QObject::connect(item, &DisplayMilitarySymbols::tilesGenerated, &app, [&app](int count)
+        {
+            app.exit(count > 0 ? 0 : 1);
+        });
+        item->setTileGeneration(commandLineParser.value(generateTilesOption), minLevel, maxLevel);
+    }
+
+    if (item && commandLineParser.isSet(sidcTableOption))
+    {
+        QString tableError;
+        if (!item->setSidcTable(commandLineParser.value(sidcTableOption), &tableError))
+        {
+            qCritical("%s", qPrintable(tableError));
+            return 1;
+        }
+    }
+
+    if (item && commandLineParser.isSet(importOption))
+        item->setImportPath(commandLineParser.value(importOption));
+
+    if (item && commandLineParser.isSet(exportOption))
+        item->setExportPath(commandLineParser.value(exportOption));
+
+    // Verify the symbols once the catalog is loaded, then exit with 2 if
+    // any of them changed
+    if (item && commandLineParser.isSet(verifyOption))
+    {
+        QObject::connect(item, &DisplayMilitarySymbols::regressionFinished, &app, [&app](int changes)
+        {
+            app.exit(changes > 0 ? 2 : 0);
+        });
+        item->runRegression(commandLineParser.value(verifyOption), commandLineParser.value(verifyReportOption));
+    }
+
+    if (item && commandLineParser.isSet(snapshotOption))
+    {
+        const QString snapshotPath = commandLineParser.value(snapshotOption);
+        item->setSnapshotPath(snapshotPath);
+
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, item, [item, snapshotPath]()
+        {
+            item->saveSnapshot(snapshotPath);
+        });
+    }
+
     // Show app window
 
     auto showValue = commandLineParser.value(kArgShowName).toLower();
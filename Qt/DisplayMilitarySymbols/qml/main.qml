@@ -16,14 +16,146 @@ import QtQuick.Controls 1.4
 import Esri.DisplayMilitarySymbols 1.0
 
 DisplayMilitarySymbols {
+    id: app
     width: 800
     height: 600
 
+    property real scaleFactor: System.displayScaleFactor
+
     // Create MapQuickView here, and create its Map etc. in C++ code
     MapView {
         anchors.fill: parent
         objectName: "mapView"
         // set focus to enable keyboard navigation
         focus: true
+
+        TelemetryOverlay {
+            anchors {
+                top: parent.top
+                right: parent.right
+                margins: 8 * scaleFactor
+            }
+            telemetry: app.telemetry
+            scaleFactor: app.scaleFactor
+        }
+    }
+
+    Text {
+        id: symbolLabel
+        anchors {
+            left: parent.left
+            bottom: parent.bottom
+            margins: 8 * scaleFactor
+        }
+        font.family: "Courier"
+    }
+
+    TextField {
+        id: filterField
+        anchors {
+            top: parent.top
+            left: parent.left
+            margins: 8 * scaleFactor
+        }
+        width: 240 * scaleFactor
+        placeholderText: "filter, e.g. hostile & ground"
+        textColor: valid ? "black" : "red"
+
+        property bool valid: true
+
+        onAccepted: valid = applyFilter(text)
+    }
+
+    TextField {
+        id: searchField
+        anchors {
+            top: filterField.bottom
+            left: parent.left
+            margins: 8 * scaleFactor
+        }
+        width: 240 * scaleFactor
+        placeholderText: "search, e.g. SHGP or armour"
+
+        // Type-ahead, the first match is shown on enter
+        onTextChanged: searchResults.model = search(text, 8)
+        onAccepted: {
+            if (searchResults.count > 0)
+                showSymbol(searchResults.model[0].sidc)
+        }
+    }
+
+    Column {
+        id: searchColumn
+        anchors {
+            top: searchField.bottom
+            left: parent.left
+            margins: 8 * scaleFactor
+        }
+        spacing: 2 * scaleFactor
+        visible: searchField.text.length > 0
+
+        Repeater {
+            id: searchResults
+
+            Text {
+                text: modelData.sidc + "  " + modelData.name
+                font.family: "Courier"
+
+                MouseArea {
+                    anchors.fill: parent
+                    onClicked: showSymbol(modelData.sidc)
+                }
+            }
+        }
+
+        Text {
+            text: searchResults.count + " matches in " + app.searchMs.toFixed(3) + " ms"
+            color: "gray"
+        }
     }
+
+    Column {
+        anchors {
+            top: searchColumn.visible ? searchColumn.bottom : searchField.bottom
+            left: parent.left
+            margins: 8 * scaleFactor
+        }
+        spacing: 2 * scaleFactor
+
+        Repeater {
+            model: app.shardKeys
+
+            CheckBox {
+                text: modelData
+                checked: true
+                onClicked: setShardVisible(modelData, checked)
+            }
+        }
+    }
+
+    // Time scrubber of the track playback
+    Column {
+        anchors {
+            right: parent.right
+            bottom: parent.bottom
+            margins: 8 * scaleFactor
+        }
+        spacing: 2 * scaleFactor
+        visible: app.playback.trackCount > 0
+
+        Text {
+            text: new Date(app.playback.time).toISOString() + "  " + app.playback.lastDelta + " changes"
+            font.family: "Courier"
+        }
+
+        Slider {
+            width: 400 * scaleFactor
+            minimumValue: app.playback.start
+            maximumValue: app.playback.end
+            onValueChanged: app.playback.time = value
+        }
+    }
+
+    onSymbolHovered: symbolLabel.text = sidc
+    onSymbolSelected: symbolLabel.text = sidc
 }
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#  Copyright 2016 ESRI
+#
+#  All rights reserved under the copyright laws of the United States
+#  and applicable international laws, treaties, and conventions.
+#
+#  You may freely redistribute and use this sample code, with or
+#  without modification, provided you include the original copyright
+#  notice and use restrictions.
+#
+#  See the Sample code usage restrictions document for further information.
+#-------------------------------------------------
+
+# The shared library first, then the apps that link it and the tests
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    Common \
+    DisplayMilitarySymbols \
+    ChangeMilitarySymbolSize \
+    Tests/SidcConverterTest
+
+DisplayMilitarySymbols.depends = Common
+ChangeMilitarySymbolSize.depends = Common
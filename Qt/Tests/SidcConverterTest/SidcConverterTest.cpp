@@ -0,0 +1,97 @@
+// Copyright 2016 ESRI
+//
+// All rights reserved under the copyright laws of the United States
+// and applicable international laws, treaties, and conventions.
+//
+// You may freely redistribute and use this sample code, with or
+// without modification, provided you include the original copyright
+// notice and use restrictions.
+//
+// See the Sample code usage restrictions document for further information.
+//
+
+#include <QtTest>
+
+#include "SidcConverter.h"
+
+class SidcConverterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+    void hierarchyFallback();
+    void headquarters_data();
+    void headquarters();
+    void rejectsNonDigits();
+};
+
+void SidcConverterTest::roundTrip_data() {
+    QTest::addColumn<QString>("revisionC");
+    QTest::addColumn<QString>("revisionD");
+
+    QTest::newRow("friendly air") << "SFAPMF---------" << "10030100001101000000";
+    QTest::newRow("hostile echelon") << "SHGPUCI----C---" << "10061000131211000000";
+    QTest::newRow("exercise sea") << "SDSPCLCV-------" << "10133000001201000000";
+}
+
+void SidcConverterTest::roundTrip() {
+    QFETCH(QString, revisionC);
+    QFETCH(QString, revisionD);
+
+    SidcConverter converter;
+    SidcConverter::Stats stats;
+
+    QCOMPARE(converter.toRevisionD(revisionC, &stats), revisionD);
+    QCOMPARE(converter.toRevisionC(revisionD, &stats), revisionC);
+    QCOMPARE(stats.converted, qint64(2));
+    QCOMPARE(stats.generalized, qint64(0));
+    QCOMPARE(stats.invalid, qint64(0));
+}
+
+void SidcConverterTest::hierarchyFallback() {
+    SidcConverter converter;
+    SidcConverter::Stats stats;
+
+    // MFQX is not in the table, its parent MFQ is
+    QCOMPARE(converter.toRevisionD("SFAPMFQX-------", &stats), QString("10030100001103000000"));
+    QCOMPARE(stats.generalized, qint64(1));
+
+    // An unknown subtype falls back to its entity
+    QCOMPARE(converter.toRevisionC("10030100001101990000", &stats), QString("SFAPMF---------"));
+    QCOMPARE(stats.generalized, qint64(2));
+    QCOMPARE(stats.frameOnly, qint64(0));
+}
+
+void SidcConverterTest::headquarters_data() {
+    QTest::addColumn<QString>("revisionD");
+    QTest::addColumn<QString>("revisionC");
+
+    QTest::newRow("headquarters") << "10030102001101000000" << "SFAPMF----A----";
+    QTest::newRow("feint headquarters task force") << "10030107001101000000" << "SFAPMF----D----";
+    QTest::newRow("out of range 8") << "10030108001101000000" << QString();
+    QTest::newRow("out of range 9") << "10030109001101000000" << QString();
+}
+
+void SidcConverterTest::headquarters() {
+    QFETCH(QString, revisionD);
+    QFETCH(QString, revisionC);
+
+    SidcConverter converter;
+    SidcConverter::Stats stats;
+
+    QCOMPARE(converter.toRevisionC(revisionD, &stats), revisionC);
+    QCOMPARE(stats.invalid, qint64(revisionC.isNull() ? 1 : 0));
+}
+
+void SidcConverterTest::rejectsNonDigits() {
+    QVERIFY(SidcConverter::isRevisionD("10030100001101000000"));
+    QVERIFY(!SidcConverter::isRevisionD("1003010000110100000A"));
+    QVERIFY(!SidcConverter::isRevisionD("1003010000110100000"));
+    QVERIFY(!SidcConverter::isRevisionD(QString("1003010000110100000") + QChar(0x0660)));
+}
+
+QTEST_APPLESS_MAIN(SidcConverterTest)
+
+#include "SidcConverterTest.moc"
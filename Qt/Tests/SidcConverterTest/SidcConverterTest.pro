@@ -0,0 +1,40 @@
+#-------------------------------------------------
+#  Copyright 2016 ESRI
+#
+#  All rights reserved under the copyright laws of the United States
+#  and applicable international laws, treaties, and conventions.
+#
+#  You may freely redistribute and use this sample code, with or
+#  without modification, provided you include the original copyright
+#  notice and use restrictions.
+#
+#  See the Sample code usage restrictions document for further information.
+#-------------------------------------------------
+
+# Unit test of the SIDC conversions, run with make check. The converter
+# needs no ArcGIS Runtime, so it is compiled here instead of linking the
+# library.
+
+TEMPLATE = app
+
+QT += core concurrent testlib
+QT -= gui
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+TARGET = SidcConverterTest
+
+COMMON_DIR = $$PWD/../../Common
+
+INCLUDEPATH += $$COMMON_DIR
+DEPENDPATH += $$COMMON_DIR
+
+HEADERS += \
+    $$COMMON_DIR/SidcConverter.h
+
+SOURCES += \
+    SidcConverterTest.cpp \
+    $$COMMON_DIR/SidcConverter.cpp
+
+RESOURCES += \
+    $$COMMON_DIR/data/data.qrc